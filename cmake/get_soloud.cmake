@@ -35,6 +35,10 @@ function( add_soloud_backend name definition )
     target_link_libraries( soloud PUBLIC soloud_backend_${name} )
 endfunction()
 
+if( EDISONENGINE_HEADLESS )
+    add_soloud_backend( null NULL )
+endif()
+
 if( VCPKG_TOOLCHAIN )
     find_package( OpenAL CONFIG REQUIRED )
 else()
@@ -48,6 +48,7 @@ input_mapping = {
     Action.StepLeft: [GlfwKey.Q],
     Action.StepRight: [GlfwKey.E],
     Action.Screenshot: [GlfwKey.F12],
+    Action.ProfilerTrace: [GlfwKey.F9],
     Action.CheatDive: [GlfwKey.F10],  # only available in debug builds
 }
 
@@ -236,6 +237,22 @@ i18n = {
         "en": "Water Denoise",
         "de": "Wassergl~attung",
     },
+    I18n.OcclusionCulling: {
+        "en": "Occlusion Culling",
+        "de": "Verdeckungsberechnung",
+    },
+    I18n.ClusteredLighting: {
+        "en": "Clustered Lighting",
+        "de": "Gruppierte Beleuchtung",
+    },
+    I18n.UncappedFrameRate: {
+        "en": "Uncapped Frame Rate",
+        "de": "Unbegrenzte Bildrate",
+    },
+    I18n.VSync: {
+        "en": "VSync",
+        "de": "Vertikale Synchronisation",
+    },
 }
 
 print("Yay! Main script loaded.")
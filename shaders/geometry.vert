@@ -38,7 +38,7 @@ void main()
     gl_Position = u_projection * tmp;
     gpi.texCoord = a_texCoord;
     gpi.texIndex = a_texIndex;
-    gpi.color = a_color;
+    gpi.color = vec4(a_color.rgb * VERTEX_COLOR_SCALE, a_color.a);
 
     gpi.normal = normalize(mat3(mm) * a_normal);
     gpi.ssaoNormal = normalize(mat3(mv) * a_normal);
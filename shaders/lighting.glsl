@@ -14,6 +14,27 @@ readonly layout(std430, binding=3) buffer b_lights {
     Light lights[];
 };
 
+// clustered forward lighting, keep in sync with render::LightClusterGrid
+const uint LIGHT_CLUSTERS_X = 16;
+const uint LIGHT_CLUSTERS_Y = 9;
+const uint LIGHT_CLUSTERS_Z = 24;
+
+uniform int u_clusteredLighting;
+// whether the current node is affected by positional lights at all
+uniform int u_dynamicLighting;
+
+readonly layout(std430, binding=4) buffer b_clusteredLights {
+    Light clusteredLights[];
+};
+
+readonly layout(std430, binding=5) buffer b_lightClusters {
+    uvec2 lightClusters[];
+};
+
+readonly layout(std430, binding=6) buffer b_lightClusterIndices {
+    uint lightClusterIndices[];
+};
+
 float shadow_map_multiplier(in vec3 normal, in float shadow)
 {
     #ifdef ROOM_SHADOWING
@@ -72,28 +93,59 @@ float shadow_map_multiplier(in vec3 normal) {
     return shadow_map_multiplier(normal, 0.5);
 }
 
+float calc_light_contribution(in Light light, in vec3 normal, in vec3 pos, in float n)
+{
+    vec3 d = pos - light.position.xyz;
+    float r = length(d)/light.fadeDistance;
+    float intensity = light.brightness / (r*r + 1.0);
+    vec3 light_dir = normalize(d);
+    return pow(intensity * max(-dot(light_dir, normal), 0), n);
+}
+
+uvec2 find_light_cluster(in vec3 pos)
+{
+    vec4 viewPos = u_view * vec4(pos, 1);
+    vec4 clipPos = u_projection * viewPos;
+    vec2 tiles = vec2(LIGHT_CLUSTERS_X, LIGHT_CLUSTERS_Y);
+    vec2 tile = clamp(floor((clipPos.xy / clipPos.w + 1.0) * 0.5 * tiles), vec2(0), tiles - 1.0);
+    float depth = max(-viewPos.z, near_plane);
+    float slices = float(LIGHT_CLUSTERS_Z);
+    float slice = clamp(floor(log(depth / near_plane) / log(far_plane / near_plane) * slices), 0.0, slices - 1.0);
+    return lightClusters[uint(tile.x) + LIGHT_CLUSTERS_X * (uint(tile.y) + LIGHT_CLUSTERS_Y * uint(slice))];
+}
+
 /*
  * @param normal is the surface normal in world space
  * @param pos is the surface position in world space
  */
 float calc_positional_lighting(in vec3 normal, in vec3 pos, in float n)
 {
-    if (lights.length() <= 0 || normal == vec3(0))
+    if (normal == vec3(0))
+    {
+        return u_lightAmbient;
+    }
+
+    if (u_dynamicLighting == 0)
     {
         return u_lightAmbient;
     }
 
     normal = normalize(normal);
     float sum = u_lightAmbient;
-    for (int i=0; i<lights.length(); ++i)
+    if (u_clusteredLighting != 0)
     {
-        vec3 d = pos - lights[i].position.xyz;
-        float r = length(d)/lights[i].fadeDistance;
-        float intensity = lights[i].brightness / (r*r + 1.0);
-        vec3 light_dir = normalize(d);
-        sum += pow(intensity * max(-dot(light_dir, normal), 0), n);
+        uvec2 cluster = find_light_cluster(pos);
+        for (uint i=cluster.x; i<cluster.x+cluster.y; ++i)
+        {
+            sum += calc_light_contribution(clusteredLights[lightClusterIndices[i]], normal, pos, n);
+        }
+        return sum;
     }
 
+    for (int i=0; i<lights.length(); ++i)
+    {
+        sum += calc_light_contribution(lights[i], normal, pos, n);
+    }
     return sum;
 }
 
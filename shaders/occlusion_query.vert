@@ -0,0 +1,7 @@
+#include "vtx_input.glsl"
+#include "camera_interface.glsl"
+
+void main()
+{
+    gl_Position = u_viewProjection * vec4(a_position, 1);
+}
@@ -0,0 +1,59 @@
+#define VTX_INPUT_NORMAL
+#define VTX_INPUT_TEXCOORD
+
+#include "vtx_input.glsl"
+#include "csm_interface.glsl"
+#include "geometry_pipeline_interface.glsl"
+#include "camera_interface.glsl"
+
+// keep in sync with engine::ParticlePool
+struct SpriteFrame {
+    vec4 rect;
+    vec4 uv;
+    float texIndex;
+    float _pad[3];
+};
+
+readonly layout(std430, binding=7) buffer b_spriteFrames {
+    SpriteFrame spriteFrames[];
+};
+
+// xyz is the world position, w the sprite frame
+readonly layout(std430, binding=8) buffer b_spriteInstances {
+    vec4 spriteInstances[];
+};
+
+vec3 light_space_pos(in mat4 lightMVP, in vec3 pos)
+{
+    vec4 tmp = lightMVP * vec4(pos, 1);
+    return tmp.xyz / tmp.w * 0.5 + 0.5;
+}
+
+void main()
+{
+    vec4 instance = spriteInstances[gl_InstanceID];
+    SpriteFrame frame = spriteFrames[int(instance.w)];
+
+    // a_position is the quad corner in [0,1]^2; the sprite is an upright billboard like u_spritePole=1 in geometry.vert
+    // the horizontal offset is along the view's x axis, the vertical one along the world's y axis
+    vec2 offset = mix(frame.rect.xy, frame.rect.zw, a_position.xy);
+    vec3 viewRight = vec3(u_view[0][0], u_view[1][0], u_view[2][0]);
+    gpi.vertexPosWorld = instance.xyz + offset.x * viewRight + vec3(0, offset.y, 0);
+    vec4 tmp = u_view * vec4(gpi.vertexPosWorld, 1);
+
+    gl_Position = u_projection * tmp;
+    gpi.texCoord = mix(frame.uv.xy, frame.uv.zw, a_texCoord);
+    gpi.texIndex = frame.texIndex;
+    gpi.color = vec4(a_color.rgb * VERTEX_COLOR_SCALE, a_color.a);
+
+    gpi.normal = a_normal;
+    gpi.ssaoNormal = a_normal;
+    gpi.vertexPos = tmp.xyz;
+    float dist = 16 * clamp(1.0 - dot(normalize(u_csmLightDir), gpi.normal), 0.0, 1.0);
+    vec3 pos = gpi.vertexPosWorld + dist * gpi.normal;
+    gpi.vertexPosLight1 = light_space_pos(u_lightMVP1, pos);
+    gpi.vertexPosLight2 = light_space_pos(u_lightMVP2, pos);
+    gpi.vertexPosLight3 = light_space_pos(u_lightMVP3, pos);
+    gpi.vertexPosLight4 = light_space_pos(u_lightMVP4, pos);
+    gpi.vertexPosLight5 = light_space_pos(u_lightMVP5, pos);
+}
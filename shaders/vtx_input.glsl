@@ -6,6 +6,8 @@ layout(location=1) in vec3 a_normal;
 
 #ifdef VTX_INPUT_TEXCOORD
 layout(location=2) in vec4 a_color;
+// vertex colors are stored as normalized RGBA8 where 127 means 1.0 to allow for overbright shading
+const float VERTEX_COLOR_SCALE = 255.0 / 127.0;
 layout(location=3) in vec2 a_texCoord;
 layout(location=4) in float a_texIndex;
 #endif
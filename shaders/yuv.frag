@@ -0,0 +1,33 @@
+#include "flat_pipeline_interface.glsl"
+
+layout(binding=0) uniform sampler2D u_y;
+layout(binding=1) uniform sampler2D u_u;
+layout(binding=2) uniform sampler2D u_v;
+// the fraction of the screen covered by the video in each direction
+uniform vec2 u_scale;
+layout(location=0) out vec4 out_color;
+
+vec3 srgbToLinear(in vec3 c)
+{
+    return mix(c / 12.92, pow((c + 0.055) / 1.055, vec3(2.4)), step(vec3(0.04045), c));
+}
+
+void main()
+{
+    vec2 uv = (fpi.texCoord - 0.5) / u_scale + 0.5;
+    if (any(lessThan(uv, vec2(0))) || any(greaterThan(uv, vec2(1))))
+    {
+        out_color = vec4(0, 0, 0, 1);
+        return;
+    }
+
+    // limited range BT.601, to which the video player's filter graph converts; keep in sync with yuvToRgb in
+    // yuvconversion.h
+    float y = (texture(u_y, uv).r * 255.0 - 16.0) / 219.0;
+    float cb = (texture(u_u, uv).r * 255.0 - 128.0) / 224.0;
+    float cr = (texture(u_v, uv).r * 255.0 - 128.0) / 224.0;
+    vec3 rgb = clamp(vec3(y + 1.402 * cr, y - 0.344136 * cb - 0.714136 * cr, y + 1.772 * cb), 0.0, 1.0);
+
+    // the framebuffer expects linear colors
+    out_color = vec4(srgbToLinear(rgb), 1);
+}
@@ -0,0 +1,183 @@
+#include "bufferedstream.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <gsl-lite.hpp>
+
+namespace audio
+{
+namespace
+{
+// how long the decoder thread sleeps when the buffer is full, or the stream has ended
+constexpr auto PollInterval = std::chrono::milliseconds{10};
+} // namespace
+
+StreamStatistics& getStreamStatistics()
+{
+  static StreamStatistics statistics;
+  return statistics;
+}
+
+BufferedStreamInstance::BufferedStreamInstance(std::unique_ptr<StreamDecoder>&& decoder)
+    : m_decoder{std::move(decoder)}
+    , m_channels{static_cast<size_t>(m_decoder->getChannels())}
+    , m_sampleRate{m_decoder->getSampleRate()}
+    , m_buffer{BufferFrames * m_channels}
+    , m_chunk(ChunkFrames * m_channels)
+    , m_head(HeadFrames * m_channels)
+    , m_headFrames{decodeHead()}
+{
+  // the buffer capacity must be a power of two holding whole frames
+  Expects(m_channels == 1 || m_channels == 2);
+
+  // the head also serves as the prefill, so playback starts without waiting for the decoder thread
+  if(m_headFrames < HeadFrames)
+    m_decoderEnded = true;
+
+  m_thread = std::thread{&BufferedStreamInstance::decodeLoop, this};
+}
+
+BufferedStreamInstance::~BufferedStreamInstance()
+{
+  {
+    std::lock_guard lock{m_wakeupMutex};
+    m_stop = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
+bool BufferedStreamInstance::decodeChunk()
+{
+  const auto frames = m_decoder->decode(m_chunk.data(), ChunkFrames);
+  if(frames == 0)
+  {
+    m_decoderEnded = true;
+    return false;
+  }
+
+  [[maybe_unused]] const auto written = m_buffer.write(m_chunk.data(), frames * m_channels);
+  BOOST_ASSERT(written == frames * m_channels);
+  return true;
+}
+
+size_t BufferedStreamInstance::decodeHead()
+{
+  size_t frames = 0;
+  while(frames < HeadFrames)
+  {
+    const auto decoded = m_decoder->decode(&m_head[frames * m_channels], HeadFrames - frames);
+    if(decoded == 0)
+      break;
+    frames += decoded;
+  }
+  return frames;
+}
+
+void BufferedStreamInstance::decodeLoop()
+{
+  size_t seekDone = 0;
+
+  while(!m_stop)
+  {
+    if(const auto seekRequested = m_seekRequested.load(std::memory_order_acquire); seekRequested != seekDone)
+    {
+      m_decoder->seek(m_seekFrame.load(std::memory_order_relaxed));
+      m_decoderEnded = false;
+      m_seekWritePosition = m_buffer.getWritePosition();
+      seekDone = seekRequested;
+      m_seekDone.store(seekDone, std::memory_order_release);
+    }
+
+    if(m_decoderEnded || m_buffer.getWriteAvailable() < m_chunk.size())
+    {
+      std::unique_lock lock{m_wakeupMutex};
+      m_wakeup.wait_for(lock, PollInterval, [this, seekDone]() {
+        return m_stop.load() || m_seekRequested.load(std::memory_order_acquire) != seekDone;
+      });
+      continue;
+    }
+
+    decodeChunk();
+  }
+}
+
+unsigned int BufferedStreamInstance::getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int aBufferSize)
+{
+  size_t frames = 0;
+  const auto deinterleave = [this, aBuffer, aBufferSize, &frames](const float* data, size_t n) {
+    // spans always hold whole frames, as the buffer capacity is a multiple of the channel count
+    BOOST_ASSERT(n % m_channels == 0);
+    for(; n > 0; n -= m_channels, ++frames)
+    {
+      for(size_t c = 0; c < m_channels; ++c)
+        aBuffer[c * aBufferSize + frames] = *data++;
+    }
+  };
+
+  if(m_headPosition < m_headFrames)
+  {
+    const auto n = std::min(size_t{aSamplesToRead}, m_headFrames - m_headPosition);
+    deinterleave(&m_head[m_headPosition * m_channels], n * m_channels);
+    m_headPosition += n;
+  }
+
+  const auto seekPending = isSeekPending();
+  if(!seekPending)
+  {
+    // dropping the audio from before the seek while the head is played leaves room for the decoder
+    m_buffer.discardUntil(m_seekWritePosition.load(std::memory_order_relaxed));
+    if(m_headPosition >= m_headFrames)
+      m_buffer.consume((aSamplesToRead - frames) * m_channels, deinterleave);
+  }
+
+  for(size_t c = 0; c < m_channels; ++c)
+    std::fill_n(&aBuffer[c * aBufferSize + frames], aSamplesToRead - frames, 0.0f);
+
+  if(frames == aSamplesToRead)
+    return aSamplesToRead;
+
+  if(hasEnded())
+    return static_cast<unsigned int>(frames);
+
+  // SoLoud treats short reads of looping voices as the end of the stream, so missing audio is padded with silence;
+  // a seek beyond the head is expected to take a moment, so it is not an underrun
+  if(!seekPending)
+  {
+    ++getStreamStatistics().underruns;
+    getStreamStatistics().underrunFrames += aSamplesToRead - frames;
+  }
+  return aSamplesToRead;
+}
+
+bool BufferedStreamInstance::isSeekPending() const
+{
+  return m_seekDone.load(std::memory_order_acquire) != m_seekRequested.load(std::memory_order_relaxed);
+}
+
+bool BufferedStreamInstance::hasEnded()
+{
+  if(m_headPosition < m_headFrames || isSeekPending())
+    return false;
+
+  return m_decoderEnded.load(std::memory_order_acquire) && m_buffer.getReadAvailable() == 0;
+}
+
+SoLoud::result BufferedStreamInstance::seek(SoLoud::time aSeconds, float* /*mScratch*/, unsigned int /*mScratchSize*/)
+{
+  // within the head, it is played while the decoder seeks to the frame following it
+  const auto frame = static_cast<size_t>(aSeconds * m_sampleRate);
+  m_headPosition = std::min(frame, m_headFrames);
+  m_seekFrame.store(std::max(frame, m_headFrames), std::memory_order_relaxed);
+  m_seekRequested.fetch_add(1, std::memory_order_release);
+  // the mixer must not block on the mutex; if the notification is missed, the decoder notices the seek after at most
+  // PollInterval
+  m_wakeup.notify_one();
+  return SoLoud::SO_NO_ERROR;
+}
+
+SoLoud::result BufferedStreamInstance::rewind()
+{
+  return seek(0, nullptr, 0);
+}
+} // namespace audio
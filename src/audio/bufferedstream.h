@@ -0,0 +1,108 @@
+#pragma once
+
+#include "util/ringbuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <soloud_audiosource.h>
+#include <thread>
+#include <vector>
+
+namespace audio
+{
+//! Decodes a stream into interleaved samples; only ever used by the decoder thread of a BufferedStreamInstance
+class StreamDecoder
+{
+public:
+  virtual ~StreamDecoder() = default;
+
+  [[nodiscard]] virtual int getChannels() const = 0;
+  [[nodiscard]] virtual int getSampleRate() const = 0;
+
+  //! Decodes up to @a frames interleaved frames into @a buffer, returns the number of decoded frames, which is 0 at the
+  //! end of the stream
+  virtual size_t decode(float* buffer, size_t frames) = 0;
+
+  virtual void seek(size_t frame) = 0;
+};
+
+struct StreamStatistics
+{
+  //! The number of mixer reads which found less decoded audio than requested, except while a seek is pending
+  std::atomic<size_t> underruns{0};
+  //! The number of frames replaced by silence because of underruns
+  std::atomic<size_t> underrunFrames{0};
+};
+
+//! Statistics over all buffered streams
+extern StreamStatistics& getStreamStatistics();
+
+//! Decodes ahead on a background thread, so that the mixer thread only copies samples from a ring buffer and never
+//! touches the disk or allocates memory. SoLoud takes the channel count and sample rate from the audio source, which
+//! must match the decoder.
+//!
+//! The start of the stream is kept decoded, so that rewinding, and thus looping, is gapless: the mixer plays the kept
+//! frames while the decoder thread seeks to the frame following them.
+class BufferedStreamInstance final : public SoLoud::AudioSourceInstance
+{
+public:
+  explicit BufferedStreamInstance(std::unique_ptr<StreamDecoder>&& decoder);
+
+  ~BufferedStreamInstance() override;
+
+  unsigned int getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int aBufferSize) override;
+
+  bool hasEnded() override;
+
+  SoLoud::result seek(SoLoud::time aSeconds, float* mScratch, unsigned int mScratchSize) override;
+
+  SoLoud::result rewind() override;
+
+  //! The number of frames decoded at once
+  static constexpr size_t ChunkFrames = 4096;
+  //! The number of frames decoded ahead; about 1.5 seconds at 44.1 kHz
+  static constexpr size_t BufferFrames = 65536;
+  //! The number of frames at the start of the stream which are kept decoded
+  static constexpr size_t HeadFrames = 2 * ChunkFrames;
+
+private:
+  const std::unique_ptr<StreamDecoder> m_decoder;
+  const size_t m_channels;
+  const int m_sampleRate;
+  util::RingBuffer<float> m_buffer;
+  //! Decoder thread side: the interleaved frames of the chunk being decoded
+  std::vector<float> m_chunk;
+  //! The interleaved frames at the start of the stream, decoded once on construction
+  std::vector<float> m_head;
+  const size_t m_headFrames;
+  //! Mixer side: the next frame to play from m_head; the ring buffer is played once all of them are played
+  size_t m_headPosition = 0;
+
+  // seeks are requested by the mixer and performed by the decoder thread; when a seek is done, the decoder publishes
+  // the write position from which on the buffer holds audio from the new position
+  std::atomic<size_t> m_seekFrame{0};
+  std::atomic<size_t> m_seekRequested{0};
+  std::atomic<size_t> m_seekDone{0};
+  std::atomic<size_t> m_seekWritePosition{0};
+  //! Set by the decoder thread when it reached the end of the stream since the last seek
+  std::atomic<bool> m_decoderEnded{false};
+
+  std::atomic<bool> m_stop{false};
+  std::mutex m_wakeupMutex{};
+  std::condition_variable m_wakeup{};
+  std::thread m_thread;
+
+  //! Decodes and buffers a chunk, returns false at the end of the stream
+  bool decodeChunk();
+
+  //! Decodes the start of the stream into m_head, returns the number of decoded frames
+  size_t decodeHead();
+
+  //! Mixer side: whether the decoder thread has not yet performed the last requested seek
+  [[nodiscard]] bool isSeekPending() const;
+
+  void decodeLoop();
+};
+} // namespace audio
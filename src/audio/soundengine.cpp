@@ -1,11 +1,16 @@
 #include "soundengine.h"
 
+#include "util/profiler.h"
+
+#include <algorithm>
 #include <glm/gtx/string_cast.hpp>
+#include <utility>
 
 namespace audio
 {
 void SoundEngine::update()
 {
+  UTIL_PROFILE_ZONE("sound-update");
   if(m_listener != nullptr)
   {
     const auto pos = m_listener->getPosition();
@@ -20,63 +25,121 @@ void SoundEngine::update()
     BOOST_LOG_TRIVIAL(warning) << "No listener set";
   }
 
-  for(auto& [emitter, sourcesAndVoices] : m_voices)
+  for(size_t i = 0; i < MaxVoices; ++i)
   {
-    glm::vec3 pos;
-    if(emitter != nullptr)
-      pos = emitter->getPosition();
-
-    for(auto& [source, voices] : sourcesAndVoices)
-    {
-      auto old = std::move(voices);
-      std::copy_if(old.begin(), old.end(), std::back_inserter(voices), [](const auto& h) { return h->isValid(); });
+    if(m_voices[i].voice != nullptr && !m_voices[i].voice->isValid())
+      releaseVoice(i);
+  }
 
-      if(emitter == nullptr)
-        continue;
+  // the heads of the lists are visited once each, so every emitter is queried for its position only once
+  for(const auto& record : m_voices)
+  {
+    if(record.voice == nullptr || record.emitter == nullptr || record.previous != detail::NoVoice)
+      continue;
 
-      for(const auto& voice : voices)
-      {
-        voice->setPosition(pos);
-      }
-    }
+    const auto pos = record.emitter->getPosition();
+    for(auto i = record.emitter->m_firstVoice; i != detail::NoVoice; i = m_voices[i].next)
+      m_voices[i].voice->setPosition(pos);
   }
 
   m_soLoud->update3dAudio();
 }
 
-std::vector<gsl::not_null<std::shared_ptr<Voice>>>
-  SoundEngine::getVoicesForAudioSource(Emitter* emitter, const std::shared_ptr<SoLoud::AudioSource>& audioSource) const
+std::shared_ptr<Voice> SoundEngine::findVoice(Emitter* emitter,
+                                              const std::shared_ptr<SoLoud::AudioSource>& audioSource) const
 {
-  const auto it1 = m_voices.find(emitter);
-  if(it1 == m_voices.end())
-    return {};
-
-  const auto it2 = it1->second.find(audioSource);
-  if(it2 == it1->second.end())
-    return {};
+  const auto first = emitter == nullptr ? m_unboundVoices : emitter->m_firstVoice;
+  for(auto i = first; i != detail::NoVoice; i = m_voices[i].next)
+  {
+    if(m_voices[i].source == audioSource.get())
+      return m_voices[i].voice;
+  }
 
-  return it2->second;
+  return nullptr;
 }
 
 bool SoundEngine::stop(const std::shared_ptr<SoLoud::AudioSource>& audioSource, Emitter* emitter)
 {
-  auto it1 = m_voices.find(emitter);
-  if(it1 == m_voices.end())
-    return false;
+  bool any = false;
+  for(auto i = getFirstVoice(emitter); i != detail::NoVoice;)
+  {
+    const auto next = m_voices[i].next;
+    if(m_voices[i].source == audioSource.get())
+    {
+      m_voices[i].voice->stop();
+      releaseVoice(i);
+      any = true;
+    }
+    i = next;
+  }
 
-  const auto it2 = it1->second.find(audioSource);
-  if(it2 == it1->second.end())
-    return false;
+  return any;
+}
 
-  bool any = !it2->second.empty();
-  for(const auto& src : it2->second)
+void SoundEngine::trackVoice(const std::shared_ptr<Voice>& voice, const SoLoud::AudioSource* source, Emitter* emitter)
+{
+  if(m_freeVoices == detail::NoVoice)
   {
-    src->stop();
+    const auto oldest = std::min_element(m_voices.begin(), m_voices.end(), [](const auto& a, const auto& b) {
+      return a.serial < b.serial;
+    });
+    BOOST_LOG_TRIVIAL(debug) << "Voice pool exhausted, stopping the oldest voice";
+    oldest->voice->stop();
+    releaseVoice(static_cast<size_t>(std::distance(m_voices.begin(), oldest)));
   }
 
-  it1->second.erase(it2);
+  const auto index = m_freeVoices;
+  auto& record = m_voices[index];
+  m_freeVoices = record.next;
+
+  auto& first = getFirstVoice(emitter);
+  record.voice = voice;
+  record.source = source;
+  record.emitter = emitter;
+  record.serial = ++m_voiceSerial;
+  record.previous = detail::NoVoice;
+  record.next = first;
+  if(first != detail::NoVoice)
+    m_voices[first].previous = index;
+  first = index;
+}
 
-  return any;
+void SoundEngine::releaseVoice(const size_t index)
+{
+  auto& record = m_voices[index];
+  BOOST_ASSERT(record.voice != nullptr);
+
+  if(record.previous != detail::NoVoice)
+    m_voices[record.previous].next = record.next;
+  else
+    getFirstVoice(record.emitter) = record.next;
+  if(record.next != detail::NoVoice)
+    m_voices[record.next].previous = record.previous;
+
+  record = VoiceRecord{};
+  record.next = std::exchange(m_freeVoices, index);
+}
+
+void SoundEngine::resetVoices()
+{
+  for(auto& emitter : m_emitters)
+    emitter->m_firstVoice = detail::NoVoice;
+  m_unboundVoices = detail::NoVoice;
+
+  m_freeVoices = detail::NoVoice;
+  for(size_t i = MaxVoices; i > 0; --i)
+  {
+    m_voices[i - 1] = VoiceRecord{};
+    m_voices[i - 1].next = std::exchange(m_freeVoices, i - 1);
+  }
+}
+
+void SoundEngine::transferVoices(Emitter* from, Emitter* to)
+{
+  dropEmitter(to);
+  to->m_firstVoice = std::exchange(from->m_firstVoice, detail::NoVoice);
+  for(auto i = to->m_firstVoice; i != detail::NoVoice; i = m_voices[i].next)
+    m_voices[i].emitter = to;
 }
 
 gsl::not_null<std::shared_ptr<Voice>> SoundEngine::play(const std::shared_ptr<SoLoud::AudioSource>& audioSource,
@@ -87,10 +150,10 @@ gsl::not_null<std::shared_ptr<Voice>> SoundEngine::play(const std::shared_ptr<So
   std::shared_ptr<Voice> voice;
   if(emitter != nullptr)
   {
+    Voice::init3dParams(*audioSource);
     const auto pos = emitter->getPosition();
     voice = std::make_shared<Voice>(
       m_soLoud, audioSource, m_soLoud->play3d(*audioSource, pos.x, pos.y, pos.z, 0, 0, 0, volume, true));
-    voice->init3dParams();
   }
   else
   {
@@ -99,23 +162,19 @@ gsl::not_null<std::shared_ptr<Voice>> SoundEngine::play(const std::shared_ptr<So
   Ensures(voice != nullptr);
 
   voice->setRelativePlaySpeed(pitch);
-  m_voices[emitter][audioSource].emplace_back(voice);
-  m_soLoud->update3dAudio();
+  trackVoice(voice, audioSource.get(), emitter);
   voice->play();
   return voice;
 }
 
 void SoundEngine::dropEmitter(Emitter* emitter)
 {
-  const auto it = m_voices.find(emitter);
-  if(it == m_voices.end())
-    return;
-
-  for(const auto& [source, voices] : it->second)
-    for(const auto& voice : voices)
-      voice->stop();
-
-  m_voices.erase(it);
+  auto& first = getFirstVoice(emitter);
+  while(first != detail::NoVoice)
+  {
+    m_voices[first].voice->stop();
+    releaseVoice(first);
+  }
 }
 
 SoundEngine::~SoundEngine()
@@ -147,7 +206,7 @@ void SoundEngine::reset()
   BOOST_LOG_TRIVIAL(debug) << "Resetting sound engine";
   m_soLoud->setGlobalVolume(0.0f);
   m_soLoud->stopAll();
-  m_voices.clear();
+  resetVoices();
   m_listener = nullptr;
   m_emitters.clear();
   m_listeners.clear();
@@ -156,12 +215,17 @@ void SoundEngine::reset()
 SoundEngine::SoundEngine()
     : m_soLoud{std::make_shared<SoLoud::Soloud>()}
 {
+#ifdef EDISONENGINE_HEADLESS
+  Expects(m_soLoud->init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::NULLDRIVER) == SoLoud::SO_NO_ERROR);
+#else
   Expects(m_soLoud->init() == SoLoud::SO_NO_ERROR);
+#endif
   BOOST_LOG_TRIVIAL(info) << "SoLoud version " << m_soLoud->getVersion() << " initialized";
   BOOST_LOG_TRIVIAL(info) << "Backend " << m_soLoud->getBackendString() << " with " << m_soLoud->getBackendChannels()
                           << " channels at " << m_soLoud->getBackendSamplerate() << " Hz and buffer size "
                           << m_soLoud->getBackendBufferSize();
 
+  resetVoices();
   m_soLoud->setGlobalVolume(0.0f);
   m_underwaterFilter.setParams(SoLoud::BiquadResonantFilter::LOWPASS, 250, 1);
 }
@@ -233,6 +297,7 @@ Emitter& Emitter::operator=(const Emitter& rhs)
 
   if(m_engine != rhs.m_engine)
   {
+    m_engine->dropEmitter(this);
     m_engine->m_emitters.erase(this);
     m_engine = rhs.m_engine;
     m_engine->m_emitters.emplace(this);
@@ -245,14 +310,17 @@ Emitter::Emitter(Emitter&& rhs)
 {
   m_engine->m_emitters.erase(&rhs);
   m_engine->m_emitters.emplace(this);
+  m_engine->transferVoices(&rhs, this);
 }
 
 Emitter& Emitter::operator=(Emitter&& rhs)
 {
+  m_engine->dropEmitter(this);
   m_engine->m_emitters.erase(this);
   m_engine->m_emitters.erase(&rhs);
   m_engine = std::exchange(rhs.m_engine, nullptr);
   m_engine->m_emitters.emplace(this);
+  m_engine->transferVoices(&rhs, this);
   return *this;
 }
 } // namespace audio
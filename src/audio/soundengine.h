@@ -3,16 +3,23 @@
 #include "util.h"
 #include "voice.h"
 
+#include <array>
 #include <glm/glm.hpp>
 #include <gsl-lite.hpp>
+#include <limits>
 #include <soloud_biquadresonantfilter.h>
-#include <unordered_map>
 #include <unordered_set>
 
 namespace audio
 {
 class SoundEngine;
 
+namespace detail
+{
+//! Terminates the intrusive voice lists of the sound engine
+constexpr size_t NoVoice = std::numeric_limits<size_t>::max();
+} // namespace detail
+
 class Emitter
 {
   friend class SoundEngine;
@@ -35,6 +42,8 @@ public:
 
 private:
   mutable SoundEngine* m_engine = nullptr;
+  //! The most recently played voice of this emitter, see SoundEngine::VoiceRecord
+  size_t m_firstVoice = detail::NoVoice;
 };
 
 class Listener
@@ -70,6 +79,9 @@ class SoundEngine final
   friend class Listener;
 
 public:
+  //! The maximum number of voices tracked at once; when exceeded, the oldest voice is stopped
+  static constexpr size_t MaxVoices = 256;
+
   SoundEngine();
 
   ~SoundEngine();
@@ -84,8 +96,9 @@ public:
 
   bool stop(const std::shared_ptr<SoLoud::AudioSource>& audioSource, Emitter* emitter);
 
-  std::vector<gsl::not_null<std::shared_ptr<Voice>>>
-    getVoicesForAudioSource(Emitter* emitter, const std::shared_ptr<SoLoud::AudioSource>& audioSource) const;
+  //! Returns the most recently played voice of @a audioSource on @a emitter, or @c nullptr if there is none
+  [[nodiscard]] std::shared_ptr<Voice> findVoice(Emitter* emitter,
+                                                 const std::shared_ptr<SoLoud::AudioSource>& audioSource) const;
 
   [[nodiscard]] const auto& getSoLoud() const noexcept
   {
@@ -120,16 +133,44 @@ public:
   }
 
 private:
+  //! A tracked voice; the index of a record is the handle of the voice within the engine. The voices of an emitter
+  //! (or of no emitter) form a doubly linked list through the records, and free records are linked through @a next.
+  struct VoiceRecord
+  {
+    std::shared_ptr<Voice> voice{};
+    const SoLoud::AudioSource* source = nullptr;
+    Emitter* emitter = nullptr;
+    //! Increases with every played voice, to find the oldest one when the pool is exhausted
+    uint64_t serial = 0;
+    size_t previous = detail::NoVoice;
+    size_t next = detail::NoVoice;
+  };
+
   gsl::not_null<std::shared_ptr<SoLoud::Soloud>> m_soLoud;
-  std::unordered_map<
-    Emitter*,
-    std::unordered_map<std::shared_ptr<SoLoud::AudioSource>, std::vector<gsl::not_null<std::shared_ptr<audio::Voice>>>>>
-    m_voices;
+  std::array<VoiceRecord, MaxVoices> m_voices{};
+  size_t m_freeVoices = detail::NoVoice;
+  //! The voices not bound to an emitter
+  size_t m_unboundVoices = detail::NoVoice;
+  uint64_t m_voiceSerial = 0;
   const Listener* m_listener = nullptr;
 
   std::unordered_set<Emitter*> m_emitters;
   std::unordered_set<Listener*> m_listeners;
 
   SoLoud::BiquadResonantFilter m_underwaterFilter{};
+
+  [[nodiscard]] size_t& getFirstVoice(Emitter* emitter) noexcept
+  {
+    return emitter == nullptr ? m_unboundVoices : emitter->m_firstVoice;
+  }
+
+  void trackVoice(const std::shared_ptr<Voice>& voice, const SoLoud::AudioSource* source, Emitter* emitter);
+
+  void releaseVoice(size_t index);
+
+  void resetVoices();
+
+  //! Moves the voices of @a from to @a to, dropping the voices @a to had
+  void transferVoices(Emitter* from, Emitter* to);
 };
 } // namespace audio
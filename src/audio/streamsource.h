@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bufferedstream.h"
 #include "sndfile/helpers.h"
 
 #include <boost/log/trivial.hpp>
@@ -9,55 +10,17 @@
 #include <gsl-lite.hpp>
 #include <sndfile.h>
 #include <soloud_audiosource.h>
+#include <soloud_wavstream.h>
 
 namespace audio
 {
-namespace sndfile
-{
-inline size_t readStereo(float* sampleBuffer, const size_t frameCount, SNDFILE* sndFile, const int channels)
-{
-  size_t processedFrames = 0;
-  std::vector<float> interleaved;
-  while(processedFrames < frameCount)
-  {
-    const auto requestedFrames = frameCount - processedFrames;
-    interleaved.resize(requestedFrames * channels);
-    const auto readFrames = sf_readf_float(sndFile, interleaved.data(), requestedFrames);
-
-    auto srcPtr = interleaved.cbegin();
-    for(sf_count_t i = 0; i < readFrames; ++i)
-    {
-      for(int c = 0; c < channels; ++c)
-      {
-        // deinterlace
-        BOOST_ASSERT(srcPtr != interleaved.cend());
-        sampleBuffer[c * frameCount] = *srcPtr++;
-      }
-      ++processedFrames;
-      ++sampleBuffer;
-    }
-
-    if(readFrames <= 0)
-      break;
-  }
-
-  for(int c = 0; c < channels; ++c)
-  {
-    std::fill_n(&sampleBuffer[c * frameCount], frameCount - processedFrames, 0.0f);
-  }
-
-  return processedFrames;
-}
-} // namespace sndfile
-
-class WadStreamInstance final : public SoLoud::AudioSourceInstance
+class WadStreamDecoder final : public StreamDecoder
 {
 private:
   std::ifstream m_wadFile;
   SF_INFO m_sfInfo{};
   SNDFILE* m_sndFile = nullptr;
   std::unique_ptr<sndfile::InputStreamViewWrapper> m_wrapper;
-  bool m_hasEnded{false};
 
   // CDAUDIO.WAD step size defines CDAUDIO's header stride, on which each track
   // info is placed. Also CDAUDIO count specifies static amount of tracks existing
@@ -67,10 +30,10 @@ private:
   static constexpr size_t WADCount = 130;
 
 public:
-  WadStreamInstance(const std::filesystem::path& filename, const size_t trackIndex)
+  WadStreamDecoder(const std::filesystem::path& filename, const size_t trackIndex)
       : m_wadFile{filename, std::ios::in | std::ios::binary}
   {
-    BOOST_LOG_TRIVIAL(trace) << "Creating WAD stream source from " << filename << ", track " << trackIndex;
+    BOOST_LOG_TRIVIAL(trace) << "Creating WAD stream decoder for " << filename << ", track " << trackIndex;
 
     memset(&m_sfInfo, 0, sizeof(m_sfInfo));
 
@@ -101,34 +64,37 @@ public:
       BOOST_LOG_TRIVIAL(error) << "Failed to open WAD file: " << sf_strerror(nullptr);
       BOOST_THROW_EXCEPTION(std::runtime_error("Failed to open WAD file"));
     }
+  }
 
-    mChannels = m_sfInfo.channels;
-    mBaseSamplerate = m_sfInfo.samplerate;
+  ~WadStreamDecoder() override
+  {
+    sf_close(m_sndFile);
   }
 
-  unsigned int getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int /*aBufferSize*/) override
+  WadStreamDecoder(const WadStreamDecoder&) = delete;
+  WadStreamDecoder(WadStreamDecoder&&) = delete;
+  WadStreamDecoder& operator=(const WadStreamDecoder&) = delete;
+  WadStreamDecoder& operator=(WadStreamDecoder&&) = delete;
+
+  [[nodiscard]] int getChannels() const override
   {
-    auto tmp = sndfile::readStereo(aBuffer, aSamplesToRead, m_sndFile, m_sfInfo.channels == 1);
-    if(tmp <= 0)
-      m_hasEnded = true;
-    return tmp;
+    return m_sfInfo.channels;
   }
 
-  bool hasEnded() override
+  [[nodiscard]] int getSampleRate() const override
   {
-    return m_hasEnded;
+    return m_sfInfo.samplerate;
   }
 
-  SoLoud::result seek(SoLoud::time aSeconds, float* /*mScratch*/, unsigned int /*mScratchSize*/) override
+  size_t decode(float* buffer, const size_t frames) override
   {
-    sf_seek(m_sndFile, m_sfInfo.samplerate * aSeconds, SF_SEEK_SET);
-    return SoLoud::SO_NO_ERROR;
+    const auto readFrames = sf_readf_float(m_sndFile, buffer, gsl::narrow<sf_count_t>(frames));
+    return readFrames <= 0 ? 0 : static_cast<size_t>(readFrames);
   }
 
-  SoLoud::result rewind() override
+  void seek(const size_t frame) override
   {
-    sf_seek(m_sndFile, 0, SF_SEEK_SET);
-    return SoLoud::SO_NO_ERROR;
+    sf_seek(m_sndFile, gsl::narrow<sf_count_t>(frame), SF_SEEK_SET);
   }
 };
 
@@ -139,15 +105,96 @@ public:
       : m_filename{filename}
       , m_trackIndex{trackIndex}
   {
+    // SoLoud takes the stream format from the source
+    const WadStreamDecoder decoder{m_filename, m_trackIndex};
+    mChannels = decoder.getChannels();
+    mBaseSamplerate = static_cast<float>(decoder.getSampleRate());
   }
 
   SoLoud::AudioSourceInstance* createInstance() override
   {
-    return new WadStreamInstance{m_filename, m_trackIndex};
+    return new BufferedStreamInstance{std::make_unique<WadStreamDecoder>(m_filename, m_trackIndex)};
   }
 
 private:
   const std::filesystem::path m_filename;
   const size_t m_trackIndex;
 };
+
+//! Decodes a stream supported by SoLoud, e.g. an Ogg Vorbis soundtrack file
+class WavStreamDecoder final : public StreamDecoder
+{
+public:
+  explicit WavStreamDecoder(const std::shared_ptr<SoLoud::WavStream>& stream)
+      : m_stream{stream}
+      , m_instance{stream->createInstance()}
+  {
+    m_instance->init(*m_stream, 0);
+  }
+
+  [[nodiscard]] int getChannels() const override
+  {
+    return static_cast<int>(m_stream->mChannels);
+  }
+
+  [[nodiscard]] int getSampleRate() const override
+  {
+    return static_cast<int>(m_stream->mBaseSamplerate);
+  }
+
+  size_t decode(float* buffer, const size_t frames) override
+  {
+    if(m_instance->hasEnded())
+      return 0;
+
+    const auto channels = static_cast<size_t>(getChannels());
+    m_planar.resize(frames * channels);
+    const auto readFrames = m_instance->getAudio(
+      m_planar.data(), gsl::narrow<unsigned int>(frames), gsl::narrow<unsigned int>(frames));
+
+    // interleave
+    for(size_t i = 0; i < readFrames; ++i)
+      for(size_t c = 0; c < channels; ++c)
+        *buffer++ = m_planar[c * frames + i];
+
+    return readFrames;
+  }
+
+  void seek(const size_t frame) override
+  {
+    m_instance->seek(
+      static_cast<double>(frame) / getSampleRate(), m_scratch.data(), gsl::narrow<unsigned int>(m_scratch.size()));
+  }
+
+private:
+  // large enough for a mixer granule of all channels
+  static constexpr size_t ScratchSize = 4096;
+
+  const std::shared_ptr<SoLoud::WavStream> m_stream;
+  const std::unique_ptr<SoLoud::AudioSourceInstance> m_instance;
+  std::vector<float> m_planar{};
+  std::vector<float> m_scratch = std::vector<float>(ScratchSize);
+};
+
+//! A stream supported by SoLoud, decoded ahead on a background thread
+class BufferedWavStream final : public SoLoud::AudioSource
+{
+public:
+  explicit BufferedWavStream(const std::filesystem::path& filename)
+  {
+    if(m_stream->load(filename.string().c_str()) != SoLoud::SO_NO_ERROR)
+      BOOST_LOG_TRIVIAL(warning) << "Failed to load stream " << filename;
+
+    mChannels = m_stream->mChannels;
+    mBaseSamplerate = m_stream->mBaseSamplerate;
+  }
+
+  SoLoud::AudioSourceInstance* createInstance() override
+  {
+    return new BufferedStreamInstance{std::make_unique<WavStreamDecoder>(m_stream)};
+  }
+
+private:
+  const std::shared_ptr<SoLoud::WavStream> m_stream = std::make_shared<SoLoud::WavStream>();
+};
 } // namespace audio
@@ -0,0 +1,399 @@
+#define BOOST_TEST_MODULE audio_test
+
+#include "bufferedstream.h"
+#include "soundengine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <boost/test/included/unit_test.hpp>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace audio;
+using namespace std::chrono_literals;
+
+namespace
+{
+//! The state of a FakeDecoder, shared with the test while the decoder is owned by the stream
+struct FakeDecoderState
+{
+  //! The next frame to decode
+  std::atomic<size_t> position{0};
+  //! While set, decoding blocks at this frame
+  std::atomic<size_t> stallAt{std::numeric_limits<size_t>::max()};
+  std::atomic<size_t> seeks{0};
+  //! While set, seeking blocks
+  std::atomic<bool> seekStalled{false};
+  //! Set when the end of the stream is decoded, i.e. after everything before it was buffered
+  std::atomic<bool> ended{false};
+};
+
+//! A mono stream of @a frames frames, each having its index as the sample value
+class FakeDecoder final : public StreamDecoder
+{
+public:
+  static constexpr int SampleRate = 1000;
+
+  FakeDecoder(const size_t frames, std::shared_ptr<FakeDecoderState> state)
+      : m_frames{frames}
+      , m_state{std::move(state)}
+  {
+  }
+
+  [[nodiscard]] int getChannels() const override
+  {
+    return 1;
+  }
+
+  [[nodiscard]] int getSampleRate() const override
+  {
+    return SampleRate;
+  }
+
+  size_t decode(float* buffer, size_t frames) override
+  {
+    while(m_state->position >= m_state->stallAt)
+      std::this_thread::sleep_for(1ms);
+
+    const auto position = m_state->position.load();
+    if(position == m_frames)
+    {
+      m_state->ended = true;
+      return 0;
+    }
+
+    frames = std::min({frames, m_frames - position, m_state->stallAt - position});
+    std::iota(buffer, buffer + frames, static_cast<float>(position));
+    m_state->position += frames;
+    return frames;
+  }
+
+  void seek(const size_t frame) override
+  {
+    while(m_state->seekStalled)
+      std::this_thread::sleep_for(1ms);
+
+    m_state->position = std::min(frame, m_frames);
+    m_state->ended = false;
+    ++m_state->seeks;
+  }
+
+private:
+  const size_t m_frames;
+  const std::shared_ptr<FakeDecoderState> m_state;
+};
+
+template<typename F>
+void waitUntil(const F& condition)
+{
+  const auto timeout = std::chrono::steady_clock::now() + 5s;
+  while(!condition())
+  {
+    BOOST_REQUIRE(std::chrono::steady_clock::now() < timeout);
+    std::this_thread::sleep_for(1ms);
+  }
+}
+
+//! Reads @a frames frames, returns the read samples, and the number of frames reported by the stream in @a read
+std::vector<float> readFrames(BufferedStreamInstance& stream, const size_t frames, unsigned int& read)
+{
+  std::vector<float> buffer(frames, -1.0f);
+  read = stream.getAudio(buffer.data(), static_cast<unsigned int>(frames), static_cast<unsigned int>(frames));
+  return buffer;
+}
+
+//! Waits until the decoder thread performed the seeks requested so far, and buffered everything up to the end
+void waitUntilBuffered(const FakeDecoderState& state, const size_t seeks)
+{
+  waitUntil([&state, seeks]() { return state.seeks == seeks && state.ended; });
+}
+
+std::vector<float> getRange(const size_t first, const size_t count)
+{
+  std::vector<float> range(count);
+  std::iota(range.begin(), range.end(), static_cast<float>(first));
+  return range;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(buffered_stream_tests)
+
+BOOST_AUTO_TEST_CASE(test_plays_until_end)
+{
+  constexpr size_t Frames = 3 * BufferedStreamInstance::HeadFrames + 123;
+  const auto state = std::make_shared<FakeDecoderState>();
+  BufferedStreamInstance stream{std::make_unique<FakeDecoder>(Frames, state)};
+  waitUntilBuffered(*state, 0);
+
+  const size_t underruns = getStreamStatistics().underruns;
+  unsigned int read = 0;
+  for(size_t position = 0; position < Frames; position += 1000)
+  {
+    const auto count = std::min(size_t{1000}, Frames - position);
+    const auto samples = readFrames(stream, count, read);
+    BOOST_REQUIRE_EQUAL(read, count);
+    BOOST_REQUIRE(samples == getRange(position, count));
+  }
+
+  waitUntil([&stream]() { return stream.hasEnded(); });
+  const auto samples = readFrames(stream, 100, read);
+  BOOST_CHECK_EQUAL(read, 0u);
+  BOOST_CHECK(samples == std::vector<float>(100, 0.0f));
+  BOOST_CHECK_EQUAL(getStreamStatistics().underruns.load(), underruns);
+}
+
+BOOST_AUTO_TEST_CASE(test_seek)
+{
+  constexpr size_t Frames = 4 * BufferedStreamInstance::HeadFrames;
+  constexpr size_t Target = 3 * BufferedStreamInstance::HeadFrames;
+  const auto state = std::make_shared<FakeDecoderState>();
+  BufferedStreamInstance stream{std::make_unique<FakeDecoder>(Frames, state)};
+  waitUntilBuffered(*state, 0);
+
+  const size_t underruns = getStreamStatistics().underruns;
+  state->seekStalled = true;
+  stream.seek(static_cast<double>(Target) / FakeDecoder::SampleRate, nullptr, 0);
+  // until the decoder thread performed the seek, silence is played, which is not an underrun
+  unsigned int read = 0;
+  BOOST_CHECK(readFrames(stream, 10, read) == std::vector<float>(10, 0.0f));
+  BOOST_CHECK_EQUAL(read, 10u);
+  BOOST_CHECK(!stream.hasEnded());
+  state->seekStalled = false;
+  waitUntilBuffered(*state, 1);
+
+  const auto samples = readFrames(stream, Frames - Target, read);
+  BOOST_CHECK_EQUAL(read, Frames - Target);
+  BOOST_CHECK(samples == getRange(Target, Frames - Target));
+  BOOST_CHECK_EQUAL(getStreamStatistics().underruns.load(), underruns);
+
+  // seeking within the head doesn't wait for the decoder thread
+  state->stallAt = 0;
+  stream.seek(100.0 / FakeDecoder::SampleRate, nullptr, 0);
+  BOOST_CHECK(readFrames(stream, 1000, read) == getRange(100, 1000));
+  BOOST_CHECK_EQUAL(read, 1000u);
+  state->stallAt = std::numeric_limits<size_t>::max();
+}
+
+BOOST_AUTO_TEST_CASE(test_loop_is_gapless)
+{
+  constexpr size_t Frames = 2 * BufferedStreamInstance::HeadFrames;
+  const auto state = std::make_shared<FakeDecoderState>();
+  BufferedStreamInstance stream{std::make_unique<FakeDecoder>(Frames, state)};
+  waitUntilBuffered(*state, 0);
+
+  unsigned int read = 0;
+  BOOST_CHECK(readFrames(stream, Frames, read) == getRange(0, Frames));
+  BOOST_CHECK_EQUAL(read, Frames);
+  waitUntil([&stream]() { return stream.hasEnded(); });
+
+  // this is what SoLoud does when a looping voice ends; the decoder thread is stalled, so only the head can be played
+  const size_t underruns = getStreamStatistics().underruns;
+  state->stallAt = BufferedStreamInstance::HeadFrames + 1;
+  stream.rewind();
+  BOOST_CHECK(!stream.hasEnded());
+  BOOST_CHECK(readFrames(stream, BufferedStreamInstance::HeadFrames, read)
+              == getRange(0, BufferedStreamInstance::HeadFrames));
+  BOOST_CHECK_EQUAL(read, BufferedStreamInstance::HeadFrames);
+  BOOST_CHECK_EQUAL(getStreamStatistics().underruns.load(), underruns);
+
+  // the decoder continues after the head
+  state->stallAt = std::numeric_limits<size_t>::max();
+  waitUntilBuffered(*state, 1);
+  BOOST_CHECK(readFrames(stream, Frames - BufferedStreamInstance::HeadFrames, read)
+              == getRange(BufferedStreamInstance::HeadFrames, Frames - BufferedStreamInstance::HeadFrames));
+  BOOST_CHECK_EQUAL(getStreamStatistics().underruns.load(), underruns);
+}
+
+BOOST_AUTO_TEST_CASE(test_underrun_is_padded)
+{
+  constexpr size_t Frames = 4 * BufferedStreamInstance::HeadFrames;
+  const auto state = std::make_shared<FakeDecoderState>();
+  state->stallAt = BufferedStreamInstance::HeadFrames;
+  BufferedStreamInstance stream{std::make_unique<FakeDecoder>(Frames, state)};
+
+  unsigned int read = 0;
+  BOOST_CHECK(readFrames(stream, BufferedStreamInstance::HeadFrames, read)
+              == getRange(0, BufferedStreamInstance::HeadFrames));
+
+  const size_t underruns = getStreamStatistics().underruns;
+  const size_t underrunFrames = getStreamStatistics().underrunFrames;
+  BOOST_CHECK(readFrames(stream, 100, read) == std::vector<float>(100, 0.0f));
+  BOOST_CHECK_EQUAL(read, 100u);
+  BOOST_CHECK(!stream.hasEnded());
+  BOOST_CHECK_EQUAL(getStreamStatistics().underruns.load(), underruns + 1);
+  BOOST_CHECK_EQUAL(getStreamStatistics().underrunFrames.load(), underrunFrames + 100);
+
+  // the padding is not skipped when the decoder catches up
+  state->stallAt = std::numeric_limits<size_t>::max();
+  waitUntilBuffered(*state, 0);
+  BOOST_CHECK(readFrames(stream, 1000, read) == getRange(BufferedStreamInstance::HeadFrames, 1000));
+  BOOST_CHECK_EQUAL(read, 1000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#ifdef EDISONENGINE_HEADLESS
+namespace
+{
+//! Plays silence forever; the null driver never mixes, so voices stay valid until they are stopped
+class SilenceInstance final : public SoLoud::AudioSourceInstance
+{
+public:
+  unsigned int getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int aBufferSize) override
+  {
+    for(unsigned int c = 0; c < mChannels; ++c)
+      std::fill_n(&aBuffer[c * aBufferSize], aSamplesToRead, 0.0f);
+    return aSamplesToRead;
+  }
+
+  bool hasEnded() override
+  {
+    return false;
+  }
+};
+
+class Silence final : public SoLoud::AudioSource
+{
+public:
+  SoLoud::AudioSourceInstance* createInstance() override
+  {
+    return new SilenceInstance();
+  }
+};
+
+class TestEmitter final : public Emitter
+{
+public:
+  explicit TestEmitter(const gsl::not_null<SoundEngine*>& engine)
+      : Emitter{engine}
+  {
+  }
+
+  [[nodiscard]] glm::vec3 getPosition() const override
+  {
+    return position;
+  }
+
+  glm::vec3 position{0.0f};
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(sound_engine_tests)
+
+BOOST_AUTO_TEST_CASE(test_pool_exhaustion_stops_oldest_voice)
+{
+  SoundEngine engine;
+  TestEmitter emitter{&engine};
+  const auto oldSource = std::make_shared<Silence>();
+  const auto newSource = std::make_shared<Silence>();
+
+  const std::shared_ptr<Voice> oldest = engine.play(oldSource, 1, 1, &emitter);
+  std::vector<std::shared_ptr<Voice>> voices;
+  for(size_t i = 1; i < SoundEngine::MaxVoices; ++i)
+    voices.emplace_back(engine.play(newSource, 1, 1, &emitter));
+  BOOST_CHECK(oldest->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(&emitter, oldSource), oldest);
+
+  // the pool is full, so the next voice replaces the oldest one
+  const std::shared_ptr<Voice> newest = engine.play(newSource, 1, 1, &emitter);
+  BOOST_CHECK(!oldest->isValid());
+  BOOST_CHECK(engine.findVoice(&emitter, oldSource) == nullptr);
+  BOOST_CHECK(newest->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(&emitter, newSource), newest);
+  BOOST_CHECK(std::all_of(voices.begin(), voices.end(), [](const auto& voice) { return voice->isValid(); }));
+
+  // all voices, including the one in the reused record, are still linked to the emitter
+  BOOST_CHECK(engine.stop(newSource, &emitter));
+  BOOST_CHECK(!newest->isValid());
+  BOOST_CHECK(std::none_of(voices.begin(), voices.end(), [](const auto& voice) { return voice->isValid(); }));
+  BOOST_CHECK(engine.findVoice(&emitter, newSource) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_stop_keeps_other_voices_of_emitter)
+{
+  SoundEngine engine;
+  TestEmitter emitter{&engine};
+  TestEmitter other{&engine};
+  const auto a = std::make_shared<Silence>();
+  const auto b = std::make_shared<Silence>();
+  const auto c = std::make_shared<Silence>();
+
+  const std::shared_ptr<Voice> voiceA = engine.play(a, 1, 1, &emitter);
+  const std::shared_ptr<Voice> voiceB = engine.play(b, 1, 1, &emitter);
+  const std::shared_ptr<Voice> voiceC = engine.play(c, 1, 1, &emitter);
+  const std::shared_ptr<Voice> otherB = engine.play(b, 1, 1, &other);
+  const std::shared_ptr<Voice> unboundB = engine.play(b, 1, 1, nullptr);
+
+  // b is in the middle of the emitter's list
+  BOOST_CHECK(engine.stop(b, &emitter));
+  BOOST_CHECK(!voiceB->isValid());
+  BOOST_CHECK(engine.findVoice(&emitter, b) == nullptr);
+  BOOST_CHECK(!engine.stop(b, &emitter));
+
+  BOOST_CHECK(voiceA->isValid());
+  BOOST_CHECK(voiceC->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(&emitter, a), voiceA);
+  BOOST_CHECK_EQUAL(engine.findVoice(&emitter, c), voiceC);
+  BOOST_CHECK(otherB->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(&other, b), otherB);
+  BOOST_CHECK(unboundB->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(nullptr, b), unboundB);
+
+  // the head and the tail of the list
+  BOOST_CHECK(engine.stop(c, &emitter));
+  BOOST_CHECK(engine.stop(a, &emitter));
+  BOOST_CHECK(!voiceA->isValid());
+  BOOST_CHECK(!voiceC->isValid());
+  BOOST_CHECK(otherB->isValid());
+  BOOST_CHECK(unboundB->isValid());
+
+  // the released records are reused
+  const std::shared_ptr<Voice> voiceD = engine.play(a, 1, 1, &emitter);
+  BOOST_CHECK_EQUAL(engine.findVoice(&emitter, a), voiceD);
+  engine.update();
+  BOOST_CHECK(voiceD->isValid());
+}
+
+BOOST_AUTO_TEST_CASE(test_moved_emitter_keeps_voices)
+{
+  SoundEngine engine;
+  const auto a = std::make_shared<Silence>();
+  const auto b = std::make_shared<Silence>();
+
+  auto source = std::make_unique<TestEmitter>(&engine);
+  const std::shared_ptr<Voice> voiceA = engine.play(a, 1, 1, source.get());
+  const std::shared_ptr<Voice> voiceB = engine.play(b, 1, 1, source.get());
+
+  TestEmitter target{&engine};
+  const std::shared_ptr<Voice> replaced = engine.play(a, 1, 1, &target);
+
+  // the voices of the target are dropped, the ones of the source are moved
+  target = std::move(*source);
+  BOOST_CHECK(!replaced->isValid());
+  BOOST_CHECK_EQUAL(engine.findVoice(&target, a), voiceA);
+  BOOST_CHECK_EQUAL(engine.findVoice(&target, b), voiceB);
+  BOOST_CHECK(engine.findVoice(source.get(), a) == nullptr);
+
+  // destroying the moved-from emitter doesn't affect the moved voices
+  source.reset();
+  BOOST_CHECK(voiceA->isValid());
+  BOOST_CHECK(voiceB->isValid());
+
+  TestEmitter moved{std::move(target)};
+  moved.position = glm::vec3{1.0f, 2.0f, 3.0f};
+  engine.update();
+  BOOST_CHECK_EQUAL(engine.findVoice(&moved, a), voiceA);
+  BOOST_CHECK_EQUAL(engine.findVoice(&moved, b), voiceB);
+  BOOST_CHECK(engine.stop(a, &moved));
+  BOOST_CHECK(!voiceA->isValid());
+  BOOST_CHECK(voiceB->isValid());
+
+  engine.dropEmitter(&moved);
+  BOOST_CHECK(!voiceB->isValid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
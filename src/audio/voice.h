@@ -63,10 +63,12 @@ public:
     m_soLoud->set3dSourcePosition(m_voiceHandle, pos.x, pos.y, pos.z);
   }
 
-  void init3dParams()
+  //! Sets the 3D parameters on the source, so that SoLoud applies them when a 3D voice starts instead of requiring
+  //! another 3D update
+  static void init3dParams(SoLoud::AudioSource& source)
   {
-    m_soLoud->set3dSourceAttenuation(m_voiceHandle, SoLoud::AudioSource::LINEAR_DISTANCE, 1);
-    m_soLoud->set3dSourceMinMaxDistance(m_voiceHandle, 0, MaxDistance);
+    source.set3dAttenuation(SoLoud::AudioSource::LINEAR_DISTANCE, 1);
+    source.set3dMinMaxDistance(0, MaxDistance);
   }
 
   void play()
@@ -1,6 +1,8 @@
+#include "core/magic.h"
 #include "engine/engine.h"
 #include "engine/player.h"
 #include "engine/script/reflection.h"
+#include "hid/inputrecording.h"
 
 #include <boost/exception/diagnostic_information.hpp>
 #include <boost/log/core.hpp>
@@ -9,18 +11,9 @@
 #include <boost/stacktrace.hpp>
 #include <csignal>
 #include <iostream>
-
-[[maybe_unused]] void gsl::fail_fast_assert_handler(char const* const expression,
-                                                    char const* const message,
-                                                    char const* const file,
-                                                    int line)
-{
-  BOOST_LOG_TRIVIAL(error) << "Expectation failed at " << file << ":" << line;
-  BOOST_LOG_TRIVIAL(error) << "  - expression " << expression;
-  BOOST_LOG_TRIVIAL(error) << "  - message " << message;
-  BOOST_LOG_TRIVIAL(error) << "Stacktrace:\n" << boost::stacktrace::stacktrace();
-  BOOST_THROW_EXCEPTION(gsl::fail_fast(message));
-}
+#include <optional>
+#include <random>
+#include <string>
 
 namespace
 {
@@ -31,6 +24,47 @@ void stacktrace_handler(int signum)
   std::raise(SIGABRT);
 }
 
+//! Parses "--benchmark <level sequence index> [steps]", "--replay <recording>" or "--demo <level sequence index>"
+std::optional<engine::BenchmarkSettings> parseBenchmarkArgs(const int argc, char** argv)
+{
+  if(argc < 3)
+    return std::nullopt;
+
+  const std::string mode{argv[1]};
+  engine::BenchmarkSettings settings;
+  if(mode == "--benchmark")
+  {
+    settings.levelSequenceIndex = std::stoul(argv[2]);
+    // one minute of game time by default
+    settings.steps = argc >= 4 ? std::stoul(argv[3]) : static_cast<size_t>(core::FrameRate.get()) * 60;
+  }
+  else if(mode == "--replay")
+  {
+    settings.replay = std::make_shared<const hid::InputRecording>(hid::InputRecording::load(argv[2]));
+    settings.levelSequenceIndex = settings.replay->getLevelSequenceIndex();
+  }
+  else if(mode == "--demo")
+  {
+    settings.levelSequenceIndex = std::stoul(argv[2]);
+    settings.replayDemo = true;
+  }
+  else
+  {
+    return std::nullopt;
+  }
+
+  return settings;
+}
+
+//! Parses "--record <level sequence index> <recording>"
+std::optional<std::pair<size_t, std::filesystem::path>> parseRecordArgs(const int argc, char** argv)
+{
+  if(argc < 4 || std::string{argv[1]} != "--record")
+    return std::nullopt;
+
+  return std::pair{std::stoul(argv[2]), std::filesystem::path{argv[3]}};
+}
+
 void terminateHandler();
 const std::terminate_handler oldTerminateHandler = std::set_terminate(&terminateHandler);
 void terminateHandler()
@@ -42,7 +76,7 @@ void terminateHandler()
 }
 } // namespace
 
-int main()
+int main(int argc, char** argv)
 {
   std::signal(SIGSEGV, &stacktrace_handler);
   std::signal(SIGABRT, &stacktrace_handler);
@@ -54,6 +88,36 @@ int main()
   engine::Engine engine{std::filesystem::current_path()};
   size_t levelSequenceIndex = 0;
   const size_t levelSequenceLength = pybind11::len(pybind11::globals()["level_sequence"]);
+
+  const auto getLevelSequenceItem = [&levelSequenceLength](const size_t index) {
+    Expects(index < levelSequenceLength);
+    return gsl::not_null{
+      pybind11::globals()["level_sequence"][pybind11::cast(index)].cast<engine::script::LevelSequenceItem*>()};
+  };
+
+  if(const auto benchmark = parseBenchmarkArgs(argc, argv))
+  {
+    engine.runLevelSequenceItemBenchmark(
+      *getLevelSequenceItem(benchmark->levelSequenceIndex), *benchmark, std::make_shared<engine::Player>());
+    return EXIT_SUCCESS;
+  }
+
+  if(const auto record = parseRecordArgs(argc, argv))
+  {
+    const auto& [recordIndex, recordingPath] = *record;
+    const auto recording = std::make_shared<hid::InputRecording>(recordIndex, std::random_device{}());
+    engine.setInputRecording(recording);
+    engine.runLevelSequenceItem(*getLevelSequenceItem(recordIndex), std::make_shared<engine::Player>());
+    engine.setInputRecording(nullptr);
+    if(!recording->isValid())
+    {
+      BOOST_LOG_TRIVIAL(error) << "Menus were used while recording, not writing " << recordingPath;
+      return EXIT_FAILURE;
+    }
+    recording->save(recordingPath);
+    return EXIT_SUCCESS;
+  }
+
   enum class Mode
   {
     Title,
@@ -2,21 +2,19 @@
 
 #include "engine/engine.h"
 #include "engine/objects/laraobject.h"
-#include "engine/script/reflection.h"
 #include "engine/world.h"
 #include "serialization/quantity.h"
 #include "serialization/serialization.h"
 
 namespace engine::ai
 {
-void updateMood(const World& world, const objects::ObjectState& objectState, const AiInfo& aiInfo, const bool violent)
+void updateMood(World& world, const objects::ObjectState& objectState, const AiInfo& aiInfo, const bool violent)
 {
   if(objectState.creatureInfo == nullptr)
     return;
 
   CreatureInfo& creatureInfo = *objectState.creatureInfo;
-  if(!creatureInfo.pathFinder.nodes[objectState.box].traversable
-     && creatureInfo.pathFinder.visited.count(objectState.box) != 0)
+  if(creatureInfo.pathFinder.isKnownUntraversable(world, objectState.box))
   {
     creatureInfo.pathFinder.required_box = nullptr;
   }
@@ -119,8 +117,7 @@ void updateMood(const World& world, const objects::ObjectState& objectState, con
   switch(creatureInfo.mood)
   {
   case Mood::Attack:
-    if(util::rand15()
-       >= pybind11::globals()["getObjectInfo"](objectState.type.get()).cast<script::ObjectInfo>().target_update_chance)
+    if(util::rand15() >= world.getObjectInfo(objectState.type).target_update_chance)
       break;
 
     creatureInfo.pathFinder.target = world.getObjectManager().getLara().m_state.position.position;
@@ -246,11 +243,9 @@ AiInfo::AiInfo(World& world, objects::ObjectState& objectState)
   world.getObjectManager().getLara().m_state.box = world.getObjectManager().getLara().m_state.getCurrentSector()->box;
   enemy_zone = world.getObjectManager().getLara().m_state.box->*zoneRef;
   enemy_unreachable = (!objectState.creatureInfo->pathFinder.canVisit(*world.getObjectManager().getLara().m_state.box)
-                       || (!objectState.creatureInfo->pathFinder.nodes[objectState.box].traversable
-                           && objectState.creatureInfo->pathFinder.visited.count(objectState.box) != 0));
+                       || objectState.creatureInfo->pathFinder.isKnownUntraversable(world, objectState.box));
 
-  auto objectInfo = pybind11::globals()["getObjectInfo"](objectState.type.get()).cast<script::ObjectInfo>();
-  const core::Length pivotLength{objectInfo.pivot_length};
+  const core::Length pivotLength{world.getObjectInfo(objectState.type).pivot_length};
   const auto d = world.getObjectManager().getLara().m_state.position.position
                  - (objectState.position.position + util::pitch(pivotLength, objectState.rotation.Y));
   const auto pivotAngle = core::angleFromAtan(d.X, d.Z);
@@ -78,6 +78,6 @@ std::shared_ptr<CreatureInfo> create(const serialization::TypeId<std::shared_ptr
 
 void serialize(std::shared_ptr<CreatureInfo>& data, const serialization::Serializer<World>& ser);
 
-void updateMood(const World& world, const objects::ObjectState& objectState, const AiInfo& aiInfo, bool violent);
+void updateMood(World& world, const objects::ObjectState& objectState, const AiInfo& aiInfo, bool violent);
 } // namespace ai
 } // namespace engine
@@ -10,33 +10,39 @@
 #include "serialization/unordered_map.h"
 #include "serialization/unordered_set.h"
 #include "serialization/vector.h"
+#include "util/parallelfor.h"
+
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace engine::ai
 {
-PathFinder::PathFinder(const World& world)
+namespace
+{
+BoxIndex getBoxIndex(const World& world, const loader::file::Box* box)
 {
-  for(const auto& box : world.getBoxes())
-    nodes.emplace(&box, PathFinderNode{});
+  const auto index = std::distance(world.getBoxes().data(), box);
+  Expects(index >= 0 && static_cast<size_t>(index) < world.getBoxes().size());
+  return gsl::narrow_cast<BoxIndex>(index);
 }
+} // namespace
 
-namespace
-{
-gsl::span<const uint16_t> getOverlaps(const World& world, const uint16_t idx)
+PathFinder::PathFinder(const World& world)
+    : search{std::make_shared<PathSearchState>(world.getBoxes().size())}
 {
-  const auto first = &world.getOverlaps().at(idx);
-  auto last = first;
-  const auto endOfUniverse = &world.getOverlaps().back() + 1;
+}
 
-  while(last < endOfUniverse && (*last & 0x8000u) == 0)
-  {
-    ++last;
-  }
+bool PathFinder::isKnownUntraversable(const World& world, const loader::file::Box* box) const
+{
+  if(box == nullptr)
+    return false;
 
-  return gsl::span{first, last + 1};
+  const auto index = getBoxIndex(world, box);
+  return !search->traversable.test(index) && search->visited.test(index);
 }
-} // namespace
 
-bool PathFinder::calculateTarget(const World& world, core::TRVec& moveTarget, const objects::ObjectState& objectState)
+bool PathFinder::calculateTarget(World& world, core::TRVec& moveTarget, const objects::ObjectState& objectState)
 {
   updatePath(world);
 
@@ -208,11 +214,11 @@ bool PathFinder::calculateTarget(const World& world, core::TRVec& moveTarget, co
       return true;
     }
 
-    const auto nextBox = nodes[here].exit_box;
-    if(nextBox == nullptr || !canVisit(*nextBox))
+    const auto nextBox = search->exitBoxes[getBoxIndex(world, here)];
+    if(nextBox == PathSearchState::NoBox || !canVisit(world.getBoxes()[nextBox]))
       break;
 
-    here = nextBox;
+    here = &world.getBoxes()[nextBox];
   }
 
   BOOST_ASSERT(here != nullptr);
@@ -248,78 +254,117 @@ bool PathFinder::calculateTarget(const World& world, core::TRVec& moveTarget, co
   return false;
 }
 
-void PathFinder::updatePath(const World& world)
+template<typename TState, typename TCanVisit>
+void PathFinder::searchPath(const World& world, TState& state, const TCanVisit& canVisit) const
+{
+  static constexpr size_t MaxExpansions = 5;
+
+  expandPathSearch(state,
+                   world.getBoxes(),
+                   world.getBoxGraph(),
+                   loader::file::Box::getZoneRef(world.roomsAreSwapped(), fly, step),
+                   step,
+                   drop,
+                   canVisit,
+                   MaxExpansions);
+}
+
+void PathFinder::updatePath(World& world)
 {
+  auto& cache = world.getPathSearchCache();
   if(required_box != nullptr && required_box != target_box)
   {
     target_box = required_box;
-
-    nodes[target_box].exit_box = nullptr;
-    nodes[target_box].traversable = true;
-    expansions.clear();
-    expansions.emplace_back(target_box);
-    visited.clear();
-    visited.emplace(target_box);
+    search = cache.acquire(getSearchKey(world), *search);
   }
 
   Expects(target_box != nullptr);
-  searchPath(world);
-}
+  if(!cache.beginExpansion(*search))
+    return;
 
-void PathFinder::searchPath(const World& world)
-{
-  const auto zoneRef = loader::file::Box::getZoneRef(world.roomsAreSwapped(), fly, step);
-
-  static constexpr uint8_t MaxExpansions = 5;
-
-  for(uint8_t i = 0; i < MaxExpansions && !expansions.empty(); ++i)
+  if(auto precomputed = cache.takePrecomputed(search);
+     precomputed.has_value()
+     && precomputed->inputs.matches(getSearchKey(world), world.roomsAreSwapped(), world.getBoxes()))
   {
-    const auto current = expansions.front();
-    expansions.pop_front();
-    const auto& currentNode = nodes[current];
-    const auto searchZone = current->*zoneRef;
-
-    for(const auto overlapBoxIdx : getOverlaps(world, current->overlap_index))
-    {
-      const auto* successorBox = &world.getBoxes().at(overlapBoxIdx & 0x7FFFu);
-
-      if(successorBox == current)
-        continue;
-
-      if(searchZone != successorBox->*zoneRef)
-        continue; // cannot switch zones
+    precomputed->expansion.apply(*search);
+    return;
+  }
 
-      const auto boxHeightDiff = successorBox->floor - current->floor;
-      if(boxHeightDiff > step || boxHeightDiff < drop)
-        continue; // can't reach from this box, but still maybe from another one
+  searchPath(world, *search, [this](const loader::file::Box& box) { return canVisit(box); });
+}
 
-      auto& successorNode = nodes[successorBox];
+PathSearchKey PathFinder::getSearchKey(const World& world) const
+{
+  return PathSearchKey{getBoxIndex(world, target_box), step, drop, fly, cannotVisitBlocked, cannotVisitBlockable};
+}
 
-      if(!currentNode.traversable)
-      {
-        if(visited.emplace(successorBox).second)
-          successorNode.traversable = false;
-      }
-      else
-      {
-        if(successorNode.traversable && visited.count(successorBox) != 0)
-          continue; // already visited and marked reachable
+void searchPaths(World& world, const std::vector<gsl::not_null<PathFinder*>>& pathFinders)
+{
+  // below this, recording and checking the expansion costs more than the parallel expansion saves
+  static constexpr size_t MinParallelSearches = 2;
 
-        // mark as visited and check if traversable (may switch traversable to true)
-        visited.emplace(successorBox);
-        successorNode.traversable = canVisit(*successorBox);
-        if(successorNode.traversable)
-          successorNode.exit_box = current; // success! connect both boxes
+  struct Pending
+  {
+    gsl::not_null<PathFinder*> pathFinder;
+    PrecomputedExpansion precomputed;
+  };
 
-        if(std::find(expansions.begin(), expansions.end(), successorBox) == expansions.end())
-          expansions.emplace_back(successorBox);
-      }
-    }
+  // shared searches are only expanded once
+  auto& cache = world.getPathSearchCache();
+  std::vector<Pending> pending;
+  std::unordered_set<const PathSearchState*> searches;
+  for(const auto& pathFinder : pathFinders)
+  {
+    if(pathFinder->target_box == nullptr || cache.isExpanded(*pathFinder->search)
+       || !searches.emplace(pathFinder->search.get()).second)
+      continue;
+
+    pending.emplace_back(Pending{
+      pathFinder,
+      PrecomputedExpansion{PathSearchExpansion{*pathFinder->search},
+                           PathSearchInputs{pathFinder->getSearchKey(world), world.roomsAreSwapped(), {}}}});
   }
+
+  if(pending.size() < MinParallelSearches)
+    return;
+
+  util::parallelFor(pending.size(), [&world, &pending](const size_t i) {
+    const auto& pathFinder = pending[i].pathFinder;
+    auto& precomputed = pending[i].precomputed;
+    const auto canVisit = [&world, &pathFinder, &precomputed](const loader::file::Box& box) {
+      // the only box state the expansion depends on that may change during the frame
+      precomputed.inputs.blockedBoxes.emplace_back(getBoxIndex(world, &box), box.blocked);
+      return pathFinder->canVisit(box);
+    };
+    pathFinder->searchPath(world, precomputed.expansion, canVisit);
+  });
+
+  for(auto& [pathFinder, precomputed] : pending)
+    cache.storePrecomputed(pathFinder->search, std::move(precomputed));
 }
 
 void PathFinder::serialize(const serialization::Serializer<World>& ser)
 {
+  // the search state is serialized in its former per-box node layout for savegame compatibility
+  const auto& levelBoxes = ser.context.getBoxes();
+  std::unordered_map<const loader::file::Box*, PathFinderNode> nodes;
+  std::deque<const loader::file::Box*> expansions;
+  std::unordered_set<const loader::file::Box*> visited;
+  if(!ser.loading)
+  {
+    for(size_t i = 0; i < levelBoxes.size(); ++i)
+    {
+      const auto exitBox = search->exitBoxes[i];
+      nodes.emplace(&levelBoxes[i],
+                    PathFinderNode{exitBox == PathSearchState::NoBox ? nullptr : &levelBoxes[exitBox],
+                                   search->traversable.test(i)});
+      if(search->visited.test(i))
+        visited.emplace(&levelBoxes[i]);
+    }
+    for(const auto box : search->getQueue())
+      expansions.emplace_back(&levelBoxes[box]);
+  }
+
   ser(S_NV("nodes", nodes),
       S_NV("boxes", boxes),
       S_NV("expansions", expansions),
@@ -332,6 +377,22 @@ void PathFinder::serialize(const serialization::Serializer<World>& ser)
       S_NV("targetBox", target_box),
       S_NV("requiredBox", required_box),
       S_NV("target", target));
+
+  if(ser.loading)
+  {
+    search = std::make_shared<PathSearchState>(levelBoxes.size());
+    for(const auto& [box, node] : nodes)
+    {
+      const auto index = getBoxIndex(ser.context, box);
+      search->exitBoxes[index]
+        = node.exit_box == nullptr ? PathSearchState::NoBox : getBoxIndex(ser.context, node.exit_box);
+      search->traversable.set(index, node.traversable);
+    }
+    for(const auto& box : visited)
+      search->visited.set(getBoxIndex(ser.context, box));
+    for(const auto& box : expansions)
+      search->enqueue(getBoxIndex(ser.context, box));
+  }
 }
 
 void PathFinderNode::serialize(const serialization::Serializer<World>& ser)
@@ -1,13 +1,10 @@
 #pragma once
 
 #include "loader/file/datatypes.h"
+#include "pathsearch.h"
 #include "serialization/serialization_fwd.h"
 #include "util/helpers.h"
 
-#include <deque>
-#include <unordered_map>
-#include <unordered_set>
-
 namespace engine
 {
 class World;
@@ -19,6 +16,7 @@ struct ObjectState;
 
 namespace ai
 {
+//! The savegame representation of a box in the path search state
 struct PathFinderNode
 {
   /**
@@ -33,11 +31,9 @@ struct PathFinderNode
 
 struct PathFinder
 {
-  std::unordered_map<const loader::file::Box*, PathFinderNode> nodes;
+  //! May be shared with other path finders with the same target and movement limits
+  std::shared_ptr<PathSearchState> search;
   std::vector<gsl::not_null<const loader::file::Box*>> boxes;
-  std::deque<const loader::file::Box*> expansions;
-  //! Contains all boxes where the "traversable" state has been determined
-  std::unordered_set<const loader::file::Box*> visited;
 
   bool cannotVisitBlocked = true;
   bool cannotVisitBlockable = false;
@@ -83,7 +79,10 @@ struct PathFinder
     }
   }
 
-  bool calculateTarget(const World& world, core::TRVec& moveTarget, const objects::ObjectState& objectState);
+  bool calculateTarget(World& world, core::TRVec& moveTarget, const objects::ObjectState& objectState);
+
+  //! Whether the search has already determined that @a box cannot be traversed
+  [[nodiscard]] bool isKnownUntraversable(const World& world, const loader::file::Box* box) const;
 
   /**
      * @brief Incrementally calculate all paths to a specific box.
@@ -94,11 +93,23 @@ struct PathFinder
      * calls to actually calculate the full path.  Until a full path is found, the nodes partially retain the old
      * paths from a previous search.
      */
-  void updatePath(const World& world);
+  void updatePath(World& world);
 
-  void searchPath(const World& world);
+  //! Expands @a state, which is either this path finder's search or a PathSearchExpansion of it
+  template<typename TState, typename TCanVisit>
+  void searchPath(const World& world, TState& state, const TCanVisit& canVisit) const;
+
+  [[nodiscard]] PathSearchKey getSearchKey(const World& world) const;
 
   void serialize(const serialization::Serializer<World>& ser);
 };
+
+//! Records expansions of the searches of all @a pathFinders in parallel, before any of them is updated in this frame.
+//!
+//! The live searches are not modified. Each expansion is only applied by the updatePath call that would have expanded
+//! the search anyway, and only if the inputs of the expansion did not change in the meantime, e.g. by a door closing
+//! or by a path finder switching its target. Otherwise, the search is expanded there as before, so the objects see
+//! the same search states in the same order as without the precomputation.
+void searchPaths(World& world, const std::vector<gsl::not_null<PathFinder*>>& pathFinders);
 } // namespace ai
 } // namespace engine
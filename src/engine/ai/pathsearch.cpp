@@ -0,0 +1,252 @@
+#include "pathsearch.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <stdexcept>
+
+namespace engine::ai
+{
+BoxGraph::BoxGraph(const std::vector<uint16_t>& overlapIndices, const std::vector<uint16_t>& overlaps)
+{
+  m_offsets.reserve(overlapIndices.size() + 1);
+  m_offsets.emplace_back(0);
+  for(const auto overlapIndex : overlapIndices)
+  {
+    for(size_t i = overlapIndex; i < overlaps.size(); ++i)
+    {
+      const auto box = gsl::narrow_cast<BoxIndex>(overlaps[i] & 0x7fffu);
+      if(box >= overlapIndices.size())
+        BOOST_THROW_EXCEPTION(std::out_of_range("Box overlap references an invalid box"));
+
+      m_overlaps.emplace_back(box);
+      if((overlaps[i] & 0x8000u) != 0)
+        break;
+    }
+    m_offsets.emplace_back(gsl::narrow<uint32_t>(m_overlaps.size()));
+  }
+}
+
+PathSearchState::PathSearchState(const size_t boxCount)
+    : exitBoxes(boxCount, NoBox)
+    , traversable(boxCount)
+    , visited(boxCount)
+    , m_queue(boxCount, NoBox)
+    , m_queued(boxCount)
+{
+  traversable.set();
+}
+
+void PathSearchState::restart(const BoxIndex target)
+{
+  exitBoxes[target] = NoBox;
+  traversable.set(target);
+  clearQueue();
+  enqueue(target);
+  visited.reset();
+  visited.set(target);
+}
+
+void PathSearchState::enqueue(const BoxIndex box)
+{
+  if(m_queued.test(box))
+    return;
+
+  BOOST_ASSERT(m_queueSize < m_queue.size());
+  m_queue[(m_queueHead + m_queueSize) % m_queue.size()] = box;
+  ++m_queueSize;
+  m_queued.set(box);
+}
+
+BoxIndex PathSearchState::dequeue()
+{
+  Expects(m_queueSize > 0);
+  const auto box = m_queue[m_queueHead];
+  m_queueHead = (m_queueHead + 1) % m_queue.size();
+  --m_queueSize;
+  m_queued.reset(box);
+  return box;
+}
+
+std::vector<BoxIndex> PathSearchState::getQueue() const
+{
+  std::vector<BoxIndex> result;
+  result.reserve(m_queueSize);
+  for(size_t i = 0; i < m_queueSize; ++i)
+    result.emplace_back(m_queue[(m_queueHead + i) % m_queue.size()]);
+  return result;
+}
+
+void PathSearchState::clearQueue()
+{
+  m_queueHead = 0;
+  m_queueSize = 0;
+  m_queued.reset();
+}
+
+const PathSearchExpansion::Change* PathSearchExpansion::findChange(const BoxIndex box) const
+{
+  const auto it
+    = std::find_if(m_changes.begin(), m_changes.end(), [box](const Change& change) { return change.box == box; });
+  return it == m_changes.end() ? nullptr : &*it;
+}
+
+PathSearchExpansion::Change& PathSearchExpansion::getChange(const BoxIndex box)
+{
+  const auto it
+    = std::find_if(m_changes.begin(), m_changes.end(), [box](const Change& change) { return change.box == box; });
+  if(it != m_changes.end())
+    return *it;
+
+  return m_changes.emplace_back(
+    Change{box, m_base->exitBoxes[box], m_base->traversable.test(box), m_base->visited.test(box)});
+}
+
+bool PathSearchExpansion::isTraversable(const BoxIndex box) const
+{
+  const auto change = findChange(box);
+  return change != nullptr ? change->traversable : m_base->traversable.test(box);
+}
+
+bool PathSearchExpansion::isVisited(const BoxIndex box) const
+{
+  const auto change = findChange(box);
+  return change != nullptr ? change->visited : m_base->visited.test(box);
+}
+
+void PathSearchExpansion::setTraversable(const BoxIndex box, const bool value)
+{
+  getChange(box).traversable = value;
+}
+
+void PathSearchExpansion::setVisited(const BoxIndex box)
+{
+  getChange(box).visited = true;
+}
+
+void PathSearchExpansion::setExitBox(const BoxIndex box, const BoxIndex exitBox)
+{
+  getChange(box).exitBox = exitBox;
+}
+
+bool PathSearchExpansion::isQueued(const BoxIndex box) const
+{
+  if(std::find(m_enqueued.begin() + gsl::narrow<std::ptrdiff_t>(m_enqueuedHead), m_enqueued.end(), box)
+     != m_enqueued.end())
+    return true;
+
+  if(!m_base->m_queued.test(box))
+    return false;
+
+  // the boxes taken from the base's queue are the first ones in it
+  for(size_t i = 0; i < m_baseDequeued; ++i)
+  {
+    if(m_base->m_queue[(m_base->m_queueHead + i) % m_base->m_queue.size()] == box)
+      return false;
+  }
+  return true;
+}
+
+void PathSearchExpansion::enqueue(const BoxIndex box)
+{
+  if(isQueued(box))
+    return;
+
+  m_enqueued.emplace_back(box);
+  m_queueOperations.emplace_back(box);
+}
+
+BoxIndex PathSearchExpansion::dequeue()
+{
+  Expects(!isQueueEmpty());
+  m_queueOperations.emplace_back(PathSearchState::NoBox);
+  if(m_baseDequeued < m_base->m_queueSize)
+  {
+    const auto box = m_base->m_queue[(m_base->m_queueHead + m_baseDequeued) % m_base->m_queue.size()];
+    ++m_baseDequeued;
+    return box;
+  }
+
+  return m_enqueued[m_enqueuedHead++];
+}
+
+void PathSearchExpansion::apply(PathSearchState& state) const
+{
+  Expects(&state == m_base);
+
+  for(const auto& change : m_changes)
+  {
+    state.exitBoxes[change.box] = change.exitBox;
+    state.traversable.set(change.box, change.traversable);
+    state.visited.set(change.box, change.visited);
+  }
+
+  // replaying the operations in order leaves the ring buffer exactly as expanding in place would
+  for(const auto box : m_queueOperations)
+  {
+    if(box == PathSearchState::NoBox)
+    {
+      [[maybe_unused]] const auto dequeued = state.dequeue();
+    }
+    else
+    {
+      state.enqueue(box);
+    }
+  }
+}
+
+std::shared_ptr<PathSearchState> PathSearchCache::acquire(const PathSearchKey& key, const PathSearchState& previous)
+{
+  auto& search = m_searches[key];
+  if(auto existing = search.lock())
+    return existing;
+
+  auto state = std::make_shared<PathSearchState>(previous);
+  state->m_expansionFrame.reset();
+  state->restart(key.target);
+  search = state;
+  return state;
+}
+
+bool PathSearchCache::beginExpansion(PathSearchState& state) const
+{
+  if(state.m_expansionFrame == m_frame)
+    return false;
+
+  state.m_expansionFrame = m_frame;
+  return true;
+}
+
+void PathSearchCache::storePrecomputed(const std::shared_ptr<PathSearchState>& state, PrecomputedExpansion&& expansion)
+{
+  Expects(state != nullptr && !isExpanded(*state));
+  m_precomputed.insert_or_assign(state.get(), std::pair{std::weak_ptr{state}, std::move(expansion)});
+}
+
+std::optional<PrecomputedExpansion> PathSearchCache::takePrecomputed(const std::shared_ptr<PathSearchState>& state)
+{
+  const auto it = m_precomputed.find(state.get());
+  if(it == m_precomputed.end())
+    return std::nullopt;
+
+  auto [source, expansion] = std::move(it->second);
+  m_precomputed.erase(it);
+  if(source.lock() != state)
+    return std::nullopt;
+  return std::move(expansion);
+}
+
+void PathSearchCache::nextFrame()
+{
+  ++m_frame;
+  m_precomputed.clear();
+
+  for(auto it = m_searches.begin(); it != m_searches.end();)
+  {
+    if(it->second.expired())
+      it = m_searches.erase(it);
+    else
+      ++it;
+  }
+}
+} // namespace engine::ai
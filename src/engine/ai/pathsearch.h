@@ -0,0 +1,331 @@
+#pragma once
+
+#include "core/units.h"
+
+#include <algorithm>
+#include <boost/dynamic_bitset.hpp>
+#include <cstdint>
+#include <gsl-lite.hpp>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace engine::ai
+{
+using BoxIndex = uint16_t;
+
+//! The overlaps of all boxes of a level in compressed sparse row layout, built once when the level is loaded
+class BoxGraph final
+{
+public:
+  BoxGraph() = default;
+
+  //! @param overlapIndices The overlap index of each box
+  //! @param overlaps The overlap lists of the level; each list is terminated by an entry with the high bit set
+  BoxGraph(const std::vector<uint16_t>& overlapIndices, const std::vector<uint16_t>& overlaps);
+
+  //! The indices of the boxes overlapping with the given box, in level data order
+  [[nodiscard]] gsl::span<const BoxIndex> getOverlaps(const BoxIndex box) const
+  {
+    Expects(size_t{box} + 1 < m_offsets.size());
+    return gsl::span{m_overlaps.data() + m_offsets[box], m_overlaps.data() + m_offsets[size_t{box} + 1]};
+  }
+
+  [[nodiscard]] size_t getBoxCount() const noexcept
+  {
+    return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+  }
+
+private:
+  std::vector<uint32_t> m_offsets;
+  std::vector<BoxIndex> m_overlaps;
+};
+
+//! The state of an incremental breadth-first path search over all boxes of a level, stored in flat arrays indexed by
+//! the box index.
+class PathSearchState final
+{
+  friend class PathSearchCache;
+  friend class PathSearchExpansion;
+
+public:
+  static constexpr BoxIndex NoBox = std::numeric_limits<BoxIndex>::max();
+
+  explicit PathSearchState(size_t boxCount = 0);
+
+  //! The next box on the path to the target, or NoBox
+  std::vector<BoxIndex> exitBoxes;
+  boost::dynamic_bitset<> traversable;
+  //! Contains all boxes where the "traversable" state has been determined
+  boost::dynamic_bitset<> visited;
+
+  //! Starts a new search towards @a target, keeping the paths of the previous search until they are replaced
+  void restart(BoxIndex target);
+
+  [[nodiscard]] bool isTraversable(const BoxIndex box) const
+  {
+    return traversable.test(box);
+  }
+
+  [[nodiscard]] bool isVisited(const BoxIndex box) const
+  {
+    return visited.test(box);
+  }
+
+  void setTraversable(const BoxIndex box, const bool value)
+  {
+    traversable.set(box, value);
+  }
+
+  void setVisited(const BoxIndex box)
+  {
+    visited.set(box);
+  }
+
+  void setExitBox(const BoxIndex box, const BoxIndex exitBox)
+  {
+    exitBoxes[box] = exitBox;
+  }
+
+  [[nodiscard]] bool isQueueEmpty() const noexcept
+  {
+    return m_queueSize == 0;
+  }
+
+  [[nodiscard]] bool isQueued(const BoxIndex box) const
+  {
+    return m_queued.test(box);
+  }
+
+  //! Does nothing if the box is already queued
+  void enqueue(BoxIndex box);
+  [[nodiscard]] BoxIndex dequeue();
+
+  //! The queued boxes, in expansion order
+  [[nodiscard]] std::vector<BoxIndex> getQueue() const;
+
+  void clearQueue();
+
+private:
+  //! Ring buffer; as every box is queued at most once, it never needs to grow
+  std::vector<BoxIndex> m_queue;
+  size_t m_queueHead = 0;
+  size_t m_queueSize = 0;
+  boost::dynamic_bitset<> m_queued;
+
+  //! The last PathSearchCache frame in which this search was expanded
+  std::optional<uint32_t> m_expansionFrame{};
+};
+
+//! The parameters that determine the result of a path search
+struct PathSearchKey
+{
+  BoxIndex target;
+  core::Length step;
+  core::Length drop;
+  core::Length fly;
+  bool cannotVisitBlocked;
+  bool cannotVisitBlockable;
+
+  [[nodiscard]] bool operator<(const PathSearchKey& rhs) const
+  {
+    return std::tie(target, step, drop, fly, cannotVisitBlocked, cannotVisitBlockable)
+           < std::tie(rhs.target, rhs.step, rhs.drop, rhs.fly, rhs.cannotVisitBlocked, rhs.cannotVisitBlockable);
+  }
+
+  [[nodiscard]] bool operator==(const PathSearchKey& rhs) const
+  {
+    return std::tie(target, step, drop, fly, cannotVisitBlocked, cannotVisitBlockable)
+           == std::tie(rhs.target, rhs.step, rhs.drop, rhs.fly, rhs.cannotVisitBlocked, rhs.cannotVisitBlockable);
+  }
+};
+
+//! An expansion of a PathSearchState that is recorded instead of being done in place. It only reads the state, so
+//! expansions of different searches can be done in parallel, and applying it later only touches the boxes it changed.
+class PathSearchExpansion final
+{
+public:
+  explicit PathSearchExpansion(const PathSearchState& base)
+      : m_base{&base}
+  {
+  }
+
+  [[nodiscard]] bool isTraversable(BoxIndex box) const;
+  [[nodiscard]] bool isVisited(BoxIndex box) const;
+  void setTraversable(BoxIndex box, bool value);
+  void setVisited(BoxIndex box);
+  void setExitBox(BoxIndex box, BoxIndex exitBox);
+
+  [[nodiscard]] bool isQueueEmpty() const noexcept
+  {
+    return m_baseDequeued == m_base->m_queueSize && m_enqueuedHead == m_enqueued.size();
+  }
+
+  [[nodiscard]] bool isQueued(BoxIndex box) const;
+  //! Does nothing if the box is already queued
+  void enqueue(BoxIndex box);
+  [[nodiscard]] BoxIndex dequeue();
+
+  //! Applies the recorded changes to the state this expansion is based on, which must not have changed since
+  void apply(PathSearchState& state) const;
+
+private:
+  struct Change
+  {
+    BoxIndex box;
+    BoxIndex exitBox;
+    bool traversable;
+    bool visited;
+  };
+
+  const PathSearchState* m_base;
+  //! An expansion only touches a few boxes, so they are searched linearly
+  std::vector<Change> m_changes;
+  //! The number of boxes taken from the front of the base's queue
+  size_t m_baseDequeued = 0;
+  //! The boxes queued by this expansion; the ones before m_enqueuedHead have been taken again
+  std::vector<BoxIndex> m_enqueued;
+  size_t m_enqueuedHead = 0;
+  //! The queue operations in order, NoBox stands for a dequeue
+  std::vector<BoxIndex> m_queueOperations;
+
+  [[nodiscard]] const Change* findChange(BoxIndex box) const;
+  Change& getChange(BoxIndex box);
+};
+
+//! Everything besides the search state itself that an expansion depended on
+struct PathSearchInputs
+{
+  PathSearchKey key;
+  bool roomsAreSwapped;
+  //! The boxes whose "blocked" flag was read, with the value that was read
+  std::vector<std::pair<BoxIndex, bool>> blockedBoxes;
+
+  //! Whether an expansion with @a currentKey would read the same flags now, and would thus have the same result
+  template<typename TBox>
+  [[nodiscard]] bool
+    matches(const PathSearchKey& currentKey, const bool currentRoomsAreSwapped, const std::vector<TBox>& boxes) const
+  {
+    if(!(key == currentKey) || roomsAreSwapped != currentRoomsAreSwapped)
+      return false;
+
+    return std::all_of(blockedBoxes.begin(), blockedBoxes.end(), [&boxes](const auto& boxAndBlocked) {
+      return boxes[boxAndBlocked.first].blocked == boxAndBlocked.second;
+    });
+  }
+};
+
+//! An expansion of a search done ahead of time, see PathSearchExpansion
+struct PrecomputedExpansion
+{
+  PathSearchExpansion expansion;
+  PathSearchInputs inputs;
+};
+
+//! Shares path searches between all searchers with the same target and movement limits, e.g. a pack of wolves
+//! chasing Lara, so that the search is only done once.
+class PathSearchCache final
+{
+public:
+  //! Returns the search for @a key, and starts a new one if no other searcher uses it.
+  //!
+  //! A new search is based on a copy of @a previous, so that it keeps the paths of the previous search until they
+  //! are replaced, as if @a previous was restarted.
+  [[nodiscard]] std::shared_ptr<PathSearchState> acquire(const PathSearchKey& key, const PathSearchState& previous);
+
+  //! Returns true only for the first call per frame and search; shared searches are only expanded once per frame
+  [[nodiscard]] bool beginExpansion(PathSearchState& state) const;
+
+  //! Whether @a state has already been expanded in this frame
+  [[nodiscard]] bool isExpanded(const PathSearchState& state) const noexcept
+  {
+    return state.m_expansionFrame == m_frame;
+  }
+
+  //! Stores an expansion of @a state, to be applied instead of expanding @a state in this frame
+  void storePrecomputed(const std::shared_ptr<PathSearchState>& state, PrecomputedExpansion&& expansion);
+
+  //! Removes and returns the expansion stored for @a state in this frame
+  [[nodiscard]] std::optional<PrecomputedExpansion> takePrecomputed(const std::shared_ptr<PathSearchState>& state);
+
+  //! Advances the frame and drops all precomputed expansions that have not been used
+  void nextFrame();
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return m_searches.size();
+  }
+
+private:
+  std::map<PathSearchKey, std::weak_ptr<PathSearchState>> m_searches;
+  //! The weak pointer detects a search that was released and replaced by a new one at the same address
+  std::unordered_map<const PathSearchState*, std::pair<std::weak_ptr<PathSearchState>, PrecomputedExpansion>>
+    m_precomputed;
+  uint32_t m_frame = 0;
+};
+
+//! Expands up to @a maxExpansions boxes of the search in @a state, which is a PathSearchState or a
+//! PathSearchExpansion.
+//!
+//! @param canVisit Called with a box to determine whether it may be entered at all
+template<typename TState, typename TBox, typename TZoneId, typename TCanVisit>
+void expandPathSearch(TState& state,
+                      const std::vector<TBox>& boxes,
+                      const BoxGraph& graph,
+                      const TZoneId TBox::*zoneRef,
+                      const core::Length& step,
+                      const core::Length& drop,
+                      const TCanVisit& canVisit,
+                      const size_t maxExpansions)
+{
+  for(size_t i = 0; i < maxExpansions && !state.isQueueEmpty(); ++i)
+  {
+    const auto current = state.dequeue();
+    const auto& currentBox = boxes[current];
+    const auto currentTraversable = state.isTraversable(current);
+    const auto searchZone = currentBox.*zoneRef;
+
+    for(const auto successor : graph.getOverlaps(current))
+    {
+      if(successor == current)
+        continue;
+
+      const auto& successorBox = boxes[successor];
+      if(searchZone != successorBox.*zoneRef)
+        continue; // cannot switch zones
+
+      const auto boxHeightDiff = successorBox.floor - currentBox.floor;
+      if(boxHeightDiff > step || boxHeightDiff < drop)
+        continue; // can't reach from this box, but still maybe from another one
+
+      if(!currentTraversable)
+      {
+        if(!state.isVisited(successor))
+        {
+          state.setVisited(successor);
+          state.setTraversable(successor, false);
+        }
+      }
+      else
+      {
+        if(state.isTraversable(successor) && state.isVisited(successor))
+          continue; // already visited and marked reachable
+
+        // mark as visited and check if traversable (may switch traversable to true)
+        state.setVisited(successor);
+        const bool successorTraversable = canVisit(successorBox);
+        state.setTraversable(successor, successorTraversable);
+        if(successorTraversable)
+          state.setExitBox(successor, current); // success! connect both boxes
+
+        state.enqueue(successor);
+      }
+    }
+  }
+}
+} // namespace engine::ai
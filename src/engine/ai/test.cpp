@@ -0,0 +1,457 @@
+#define BOOST_TEST_MODULE ai_test
+
+#include "pathsearch.h"
+#include "util/parallelfor.h"
+
+#include <algorithm>
+#include <boost/test/included/unit_test.hpp>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace engine::ai;
+
+namespace
+{
+struct TestBox
+{
+  core::Length floor = core::Length{0};
+  uint16_t zone = 0;
+  bool blocked = false;
+  uint16_t overlapIndex = 0;
+};
+
+struct ReferenceNode
+{
+  const TestBox* exitBox = nullptr;
+  bool traversable = true;
+};
+
+// the search state and algorithm of the former PathFinder
+struct ReferencePathFinder
+{
+  std::unordered_map<const TestBox*, ReferenceNode> nodes;
+  std::deque<const TestBox*> expansions;
+  std::unordered_set<const TestBox*> visited;
+
+  void restart(const TestBox* target)
+  {
+    nodes[target].exitBox = nullptr;
+    nodes[target].traversable = true;
+    expansions.clear();
+    expansions.emplace_back(target);
+    visited.clear();
+    visited.emplace(target);
+  }
+
+  void searchPath(const std::vector<TestBox>& boxes,
+                  const std::vector<uint16_t>& overlaps,
+                  const core::Length& step,
+                  const core::Length& drop,
+                  const size_t maxExpansions)
+  {
+    for(size_t i = 0; i < maxExpansions && !expansions.empty(); ++i)
+    {
+      const auto current = expansions.front();
+      expansions.pop_front();
+      const auto& currentNode = nodes[current];
+
+      for(size_t overlap = current->overlapIndex; overlap < overlaps.size(); ++overlap)
+      {
+        const auto* successorBox = &boxes.at(overlaps[overlap] & 0x7fffu);
+        const bool isLast = (overlaps[overlap] & 0x8000u) != 0;
+
+        if(successorBox != current && current->zone == successorBox->zone
+           && successorBox->floor - current->floor <= step && successorBox->floor - current->floor >= drop)
+        {
+          auto& successorNode = nodes[successorBox];
+
+          if(!currentNode.traversable)
+          {
+            if(visited.emplace(successorBox).second)
+              successorNode.traversable = false;
+          }
+          else if(!successorNode.traversable || visited.count(successorBox) == 0)
+          {
+            visited.emplace(successorBox);
+            successorNode.traversable = !successorBox->blocked;
+            if(successorNode.traversable)
+              successorNode.exitBox = current;
+
+            if(std::find(expansions.begin(), expansions.end(), successorBox) == expansions.end())
+              expansions.emplace_back(successorBox);
+          }
+        }
+
+        if(isLast)
+          break;
+      }
+    }
+  }
+};
+
+struct TestLevel
+{
+  std::vector<TestBox> boxes;
+  std::vector<uint16_t> overlaps;
+};
+
+TestLevel createLevel(std::mt19937& rng, const size_t boxCount)
+{
+  std::uniform_int_distribution<int> floor{-4, 4};
+  std::uniform_int_distribution<uint16_t> zone{0, 2};
+  std::bernoulli_distribution blocked{0.1};
+  std::uniform_int_distribution<size_t> overlapCount{1, 6};
+  std::uniform_int_distribution<uint16_t> anyBox{0, gsl::narrow<uint16_t>(boxCount - 1)};
+
+  TestLevel level;
+  for(size_t i = 0; i < boxCount; ++i)
+  {
+    TestBox box;
+    box.floor = core::Length{floor(rng) * 256};
+    box.zone = zone(rng);
+    box.blocked = blocked(rng);
+    box.overlapIndex = gsl::narrow<uint16_t>(level.overlaps.size());
+    level.boxes.emplace_back(box);
+
+    for(auto n = overlapCount(rng); n > 0; --n)
+    {
+      // neighbours are biased towards nearby indices to get connected areas
+      auto other = n % 2 == 0 ? anyBox(rng) : gsl::narrow_cast<uint16_t>((i + anyBox(rng) % 8) % boxCount);
+      level.overlaps.emplace_back(static_cast<uint16_t>(other | (n == 1 ? 0x8000u : 0u)));
+    }
+  }
+  return level;
+}
+
+void checkEqual(const std::vector<TestBox>& boxes, const ReferencePathFinder& reference, const PathSearchState& state)
+{
+  for(size_t i = 0; i < boxes.size(); ++i)
+  {
+    const auto it = reference.nodes.find(&boxes[i]);
+    const ReferenceNode node = it == reference.nodes.end() ? ReferenceNode{} : it->second;
+    const auto exitBox = state.exitBoxes[i] == PathSearchState::NoBox ? nullptr : &boxes[state.exitBoxes[i]];
+    BOOST_REQUIRE(exitBox == node.exitBox);
+    BOOST_REQUIRE_EQUAL(state.traversable.test(i), node.traversable);
+    BOOST_REQUIRE_EQUAL(state.visited.test(i), reference.visited.count(&boxes[i]) != 0);
+  }
+
+  const auto queue = state.getQueue();
+  BOOST_REQUIRE_EQUAL(queue.size(), reference.expansions.size());
+  for(size_t i = 0; i < queue.size(); ++i)
+    BOOST_REQUIRE(&boxes[queue[i]] == reference.expansions[i]);
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(path_search_tests)
+
+BOOST_AUTO_TEST_CASE(test_box_graph)
+{
+  const std::vector<uint16_t> overlaps{1, 0x8002u, 0x8000u, 0, 0x8001u};
+  const BoxGraph graph{{0, 2, 3}, overlaps};
+  BOOST_REQUIRE_EQUAL(graph.getBoxCount(), 3u);
+
+  const auto overlaps0 = graph.getOverlaps(0);
+  BOOST_REQUIRE_EQUAL(overlaps0.size(), 2u);
+  BOOST_CHECK_EQUAL(overlaps0[0], 1);
+  BOOST_CHECK_EQUAL(overlaps0[1], 2);
+
+  const auto overlaps1 = graph.getOverlaps(1);
+  BOOST_REQUIRE_EQUAL(overlaps1.size(), 1u);
+  BOOST_CHECK_EQUAL(overlaps1[0], 0);
+
+  const auto overlaps2 = graph.getOverlaps(2);
+  BOOST_REQUIRE_EQUAL(overlaps2.size(), 2u);
+  BOOST_CHECK_EQUAL(overlaps2[0], 0);
+  BOOST_CHECK_EQUAL(overlaps2[1], 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_queue)
+{
+  PathSearchState state{4};
+  state.enqueue(2);
+  state.enqueue(1);
+  state.enqueue(2);
+  BOOST_CHECK(state.isQueued(1));
+  BOOST_CHECK(state.isQueued(2));
+  BOOST_CHECK(!state.isQueued(0));
+  BOOST_CHECK_EQUAL(state.dequeue(), 2);
+  BOOST_CHECK(!state.isQueued(2));
+
+  // wraps around the end of the ring buffer
+  state.enqueue(3);
+  state.enqueue(0);
+  state.enqueue(2);
+  BOOST_CHECK(state.getQueue() == (std::vector<BoxIndex>{1, 3, 0, 2}));
+  BOOST_CHECK_EQUAL(state.dequeue(), 1);
+  BOOST_CHECK_EQUAL(state.dequeue(), 3);
+  BOOST_CHECK_EQUAL(state.dequeue(), 0);
+  BOOST_CHECK_EQUAL(state.dequeue(), 2);
+  BOOST_CHECK(state.isQueueEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(test_matches_legacy_search)
+{
+  static constexpr size_t MaxExpansions = 5;
+
+  std::mt19937 rng{42};
+  for(int levelIdx = 0; levelIdx < 50; ++levelIdx)
+  {
+    const auto level = createLevel(rng, 200);
+
+    std::vector<uint16_t> overlapIndices;
+    for(const auto& box : level.boxes)
+      overlapIndices.emplace_back(box.overlapIndex);
+    const BoxGraph graph{overlapIndices, level.overlaps};
+
+    const auto step = core::Length{levelIdx % 2 == 0 ? 256 : 512};
+    const auto drop = core::Length{levelIdx % 2 == 0 ? -256 : -1024};
+
+    ReferencePathFinder reference;
+    PathSearchState state{level.boxes.size()};
+    PathSearchState recorded{level.boxes.size()};
+    std::uniform_int_distribution<uint16_t> anyBox{0, gsl::narrow<uint16_t>(level.boxes.size() - 1)};
+    std::bernoulli_distribution retarget{0.05};
+    std::bernoulli_distribution toggleBlocked{0.02};
+
+    auto boxes = level.boxes;
+    for(int frame = 0; frame < 400; ++frame)
+    {
+      if(frame == 0 || retarget(rng))
+      {
+        const auto target = anyBox(rng);
+        reference.restart(&boxes[target]);
+        state.restart(target);
+        recorded.restart(target);
+      }
+
+      // doors opening and closing while searching
+      if(toggleBlocked(rng))
+      {
+        auto& box = boxes[anyBox(rng)];
+        box.blocked = !box.blocked;
+      }
+
+      reference.searchPath(boxes, level.overlaps, step, drop, MaxExpansions);
+      expandPathSearch(
+        state,
+        boxes,
+        graph,
+        &TestBox::zone,
+        step,
+        drop,
+        [](const TestBox& box) { return !box.blocked; },
+        MaxExpansions);
+
+      // recording the expansion and applying it afterwards has the same result as expanding in place
+      PathSearchExpansion expansion{recorded};
+      expandPathSearch(
+        expansion,
+        boxes,
+        graph,
+        &TestBox::zone,
+        step,
+        drop,
+        [](const TestBox& box) { return !box.blocked; },
+        MaxExpansions);
+      expansion.apply(recorded);
+
+      checkEqual(boxes, reference, state);
+      checkEqual(boxes, reference, recorded);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_shares_searches)
+{
+  const PathSearchState initial{4};
+  const PathSearchKey wolfKey{2, core::Length{256}, core::Length{-256}, core::Length{0}, true, false};
+  auto bearKey = wolfKey;
+  bearKey.drop = core::Length{-1024};
+
+  PathSearchCache cache;
+  const auto wolf1 = cache.acquire(wolfKey, initial);
+  const auto wolf2 = cache.acquire(wolfKey, initial);
+  const auto bear = cache.acquire(bearKey, initial);
+  BOOST_CHECK(wolf1 == wolf2);
+  BOOST_CHECK(wolf1 != bear);
+  BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+  // shared searches are only expanded once per frame
+  BOOST_CHECK(cache.beginExpansion(*wolf1));
+  BOOST_CHECK(!cache.beginExpansion(*wolf2));
+  BOOST_CHECK(cache.beginExpansion(*bear));
+  cache.nextFrame();
+  BOOST_CHECK(cache.beginExpansion(*wolf2));
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_restarts_from_previous_search)
+{
+  PathSearchState previous{4};
+  previous.exitBoxes[1] = 3;
+  previous.traversable.reset(0);
+  previous.visited.set(0);
+  previous.enqueue(3);
+
+  PathSearchCache cache;
+  const PathSearchKey key{2, core::Length{256}, core::Length{-256}, core::Length{0}, true, false};
+  {
+    const auto search = cache.acquire(key, previous);
+    // previous paths are kept
+    BOOST_CHECK_EQUAL(search->exitBoxes[1], 3);
+    BOOST_CHECK(!search->traversable.test(0));
+    // the search state is restarted
+    BOOST_CHECK(!search->visited.test(0));
+    BOOST_CHECK(search->visited.test(2));
+    BOOST_CHECK(search->getQueue() == std::vector<BoxIndex>{2});
+    // the previous search is not modified
+    BOOST_CHECK(previous.getQueue() == std::vector<BoxIndex>{3});
+  }
+
+  // unused searches are dropped
+  cache.nextFrame();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for)
+{
+  // the pool threads are reused by consecutive calls
+  for(const size_t threads : {0u, 1u, 3u, 16u, 3u, 16u})
+  {
+    std::vector<int> calls(100, 0);
+    util::parallelFor(
+      calls.size(), [&calls](const size_t i) { ++calls[i]; }, threads);
+    BOOST_CHECK(std::all_of(calls.begin(), calls.end(), [](const auto& n) { return n == 1; }));
+  }
+
+  util::parallelFor(
+    0, [](size_t) { BOOST_FAIL("called for an empty range"); }, 4);
+
+  BOOST_CHECK_THROW(util::parallelFor(
+                      10,
+                      [](const size_t i) {
+                        if(i == 7)
+                          BOOST_THROW_EXCEPTION(std::runtime_error("failed"));
+                      },
+                      4),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_expansion_replays_queue)
+{
+  PathSearchState base{4};
+  base.enqueue(1);
+  base.enqueue(3);
+  auto inPlace = base;
+
+  const auto run = [](auto& state) {
+    BOOST_CHECK_EQUAL(state.dequeue(), 1);
+    state.enqueue(2);
+    state.enqueue(3);
+    BOOST_CHECK(state.isQueued(3));
+    BOOST_CHECK(!state.isQueued(1));
+    // a box may be queued again after it was taken
+    state.enqueue(1);
+    BOOST_CHECK_EQUAL(state.dequeue(), 3);
+    BOOST_CHECK_EQUAL(state.dequeue(), 2);
+    state.enqueue(2);
+    state.setVisited(2);
+    state.setTraversable(2, false);
+    state.setExitBox(0, 2);
+  };
+
+  PathSearchExpansion expansion{base};
+  run(expansion);
+  run(inPlace);
+
+  // the base is only read while recording
+  BOOST_CHECK(base.getQueue() == (std::vector<BoxIndex>{1, 3}));
+  BOOST_CHECK(!base.visited.test(2));
+  BOOST_CHECK(expansion.isVisited(2));
+  BOOST_CHECK(!expansion.isTraversable(2));
+  BOOST_CHECK(expansion.isTraversable(0));
+
+  expansion.apply(base);
+  BOOST_CHECK(base.getQueue() == inPlace.getQueue());
+  BOOST_CHECK(base.getQueue() == (std::vector<BoxIndex>{1, 2}));
+  BOOST_CHECK(base.exitBoxes == inPlace.exitBoxes);
+  BOOST_CHECK(base.traversable == inPlace.traversable);
+  BOOST_CHECK(base.visited == inPlace.visited);
+  for(BoxIndex box = 0; box < 4; ++box)
+    BOOST_CHECK_EQUAL(base.isQueued(box), inPlace.isQueued(box));
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_applies_precomputed_expansions)
+{
+  PathSearchCache cache;
+  const PathSearchState initial{4};
+  const PathSearchKey key{2, core::Length{256}, core::Length{-256}, core::Length{0}, true, false};
+  const auto search = cache.acquire(key, initial);
+
+  PathSearchExpansion expansion{*search};
+  expansion.setExitBox(1, 2);
+  cache.storePrecomputed(search, PrecomputedExpansion{expansion, PathSearchInputs{key, false, {}}});
+
+  // the expansion is only handed out once
+  auto precomputed = cache.takePrecomputed(search);
+  BOOST_REQUIRE(precomputed.has_value());
+  BOOST_CHECK(!cache.takePrecomputed(search).has_value());
+
+  // applying keeps the claim for this frame
+  BOOST_REQUIRE(cache.beginExpansion(*search));
+  precomputed->expansion.apply(*search);
+  BOOST_CHECK_EQUAL(search->exitBoxes[1], 2);
+  BOOST_CHECK(cache.isExpanded(*search));
+  BOOST_CHECK(!cache.beginExpansion(*search));
+
+  // unused expansions are dropped with the frame
+  cache.nextFrame();
+  cache.storePrecomputed(search, PrecomputedExpansion{expansion, PathSearchInputs{key, false, {}}});
+  cache.nextFrame();
+  BOOST_CHECK(!cache.takePrecomputed(search).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(test_inputs_detect_changes)
+{
+  const PathSearchKey key{2, core::Length{256}, core::Length{-256}, core::Length{0}, true, false};
+  const PathSearchInputs inputs{key, false, {{3, false}, {1, true}}};
+
+  std::vector<TestBox> boxes(4);
+  boxes[1].blocked = true;
+  BOOST_CHECK(inputs.matches(key, false, boxes));
+
+  // only the flags that were read matter
+  boxes[0].blocked = true;
+  BOOST_CHECK(inputs.matches(key, false, boxes));
+  boxes[3].blocked = true;
+  BOOST_CHECK(!inputs.matches(key, false, boxes));
+  boxes[3].blocked = false;
+  boxes[1].blocked = false;
+  BOOST_CHECK(!inputs.matches(key, false, boxes));
+  boxes[1].blocked = true;
+
+  BOOST_CHECK(!inputs.matches(key, true, boxes));
+  auto retargeted = key;
+  retargeted.target = 3;
+  BOOST_CHECK(!inputs.matches(retargeted, false, boxes));
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_ignores_expansions_of_released_searches)
+{
+  PathSearchCache cache;
+  const PathSearchState initial{4};
+  const PathSearchKey key{2, core::Length{256}, core::Length{-256}, core::Length{0}, true, false};
+  auto search = cache.acquire(key, initial);
+  cache.storePrecomputed(search, PrecomputedExpansion{PathSearchExpansion{*search}, PathSearchInputs{key, false, {}}});
+  const auto released = search.get();
+  search.reset();
+
+  // a new search may be allocated at the same address
+  search = std::make_shared<PathSearchState>(initial);
+  if(search.get() == released)
+    BOOST_CHECK(!cache.takePrecomputed(search).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
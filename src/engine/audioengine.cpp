@@ -209,8 +209,7 @@ gsl::not_null<std::shared_ptr<audio::Voice>> AudioEngine::playStream(size_t trac
   }
   else
   {
-    auto wav = std::make_shared<SoLoud::WavStream>();
-    wav->load((m_rootPath / (boost::format("%03d.ogg") % trackId).str()).string().c_str());
+    auto wav = std::make_shared<audio::BufferedWavStream>(m_rootPath / (boost::format("%03d.ogg") % trackId).str());
     auto voice = m_soundEngine->playBackground(wav, m_streamVolume);
     voice->setProtect(true);
     return voice;
@@ -249,10 +248,9 @@ std::shared_ptr<audio::Voice> AudioEngine::playSoundEffect(const core::SoundEffe
   {
   case loader::file::PlaybackType::Looping:
     BOOST_LOG_TRIVIAL(trace) << "Play looping sound effect " << toString(id.get_as<TR1SoundEffect>());
-    if(auto voices = m_soundEngine->getVoicesForAudioSource(emitter, audioSource); !voices.empty())
+    if(auto voice = m_soundEngine->findVoice(emitter, audioSource); voice != nullptr)
     {
-      BOOST_ASSERT(voices.size() == 1);
-      return voices[0];
+      return voice;
     }
     else
     {
@@ -262,9 +260,8 @@ std::shared_ptr<audio::Voice> AudioEngine::playSoundEffect(const core::SoundEffe
     }
   case loader::file::PlaybackType::Restart:
     BOOST_LOG_TRIVIAL(trace) << "Play restarting sound effect " << toString(id.get_as<TR1SoundEffect>());
-    if(auto voices = m_soundEngine->getVoicesForAudioSource(emitter, audioSource); !voices.empty())
+    if(auto voice = m_soundEngine->findVoice(emitter, audioSource); voice != nullptr)
     {
-      auto voice = voices[0];
       if(!voice->isValid())
         return m_soundEngine->play(audioSource, pitch, volume, emitter);
 
@@ -282,10 +279,9 @@ std::shared_ptr<audio::Voice> AudioEngine::playSoundEffect(const core::SoundEffe
     }
   case loader::file::PlaybackType::Wait:
     BOOST_LOG_TRIVIAL(trace) << "Play single-instance sound effect " << toString(id.get_as<TR1SoundEffect>());
-    if(auto voices = m_soundEngine->getVoicesForAudioSource(emitter, audioSource); !voices.empty())
+    if(auto voice = m_soundEngine->findVoice(emitter, audioSource); voice != nullptr)
     {
-      BOOST_ASSERT(voices.size() == 1);
-      return voices[0];
+      return voice;
     }
     else
     {
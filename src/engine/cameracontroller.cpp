@@ -10,6 +10,7 @@
 #include "serialization/optional.h"
 #include "serialization/quantity.h"
 #include "serialization/serialization.h"
+#include "util/profiler.h"
 
 #include <utility>
 
@@ -369,6 +370,7 @@ void CameraController::handleCommandSequence(const floordata::FloorDataValue* cm
 // ReSharper disable once CppMemberFunctionMayBeConst
 std::unordered_set<const loader::file::Portal*> CameraController::tracePortals()
 {
+  UTIL_PROFILE_ZONE("trace-portals");
   for(const auto& room : m_world->getRooms())
     room.node->setVisible(false);
 
@@ -382,6 +384,7 @@ std::unordered_set<const loader::file::Portal*> CameraController::tracePortals()
 
 std::unordered_set<const loader::file::Portal*> CameraController::update()
 {
+  UTIL_PROFILE_ZONE("camera-update");
   m_rotationAroundLara.X = std::clamp(m_rotationAroundLara.X, -85_deg, +85_deg);
 
   if(m_mode == CameraMode::Cinematic)
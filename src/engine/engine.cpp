@@ -1,11 +1,13 @@
 #include "engine.h"
 
+#include "audio/bufferedstream.h"
 #include "audio/tracktype.h"
 #include "core/pybindmodule.h"
 #include "engine/ai/ai.h"
 #include "engine/audioengine.h"
 #include "floordata/floordata.h"
 #include "hid/inputhandler.h"
+#include "hid/inputrecording.h"
 #include "i18nprovider.h"
 #include "loader/file/level/level.h"
 #include "loader/file/rendermeshdata.h"
@@ -35,23 +37,64 @@
 #include "tracks_tr1.h"
 #include "ui/label.h"
 #include "ui/ui.h"
+#include "util/profiler.h"
 #include "world.h"
 
+#include <algorithm>
 #include <boost/locale/generator.hpp>
 #include <boost/locale/info.hpp>
 #include <boost/range/adaptor/map.hpp>
+#include <chrono>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <gl/font.h>
 #include <glm/gtx/norm.hpp>
+#include <iomanip>
 #include <locale>
 #include <numeric>
 #include <pybind11/embed.h>
 #include <pybind11/stl.h>
 
+#ifdef SOGLB_NULL_BACKEND
+#  include <gl/null/statistics.h>
+#endif
+
 namespace engine
 {
 namespace
 {
+constexpr unsigned int BenchmarkSeed = 1;
+const char* const BenchmarkStateFilename = "benchmark.yaml";
+const char* const BenchmarkTraceFilename = "benchmark.json";
+// the number of zones logged after a benchmark
+constexpr size_t BenchmarkZones = 20;
+
+//! FNV-1a, which is stable across platforms and engine versions
+uint64_t hashFile(const std::filesystem::path& path)
+{
+  std::ifstream file{path, std::ios::in | std::ios::binary};
+  Expects(file.is_open());
+
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for(auto c = file.get(); c != std::ifstream::traits_type::eof(); c = file.get())
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+std::string getTimestampFilename(const std::string& extension)
+{
+  auto time = std::time(nullptr);
+  auto localTime = std::localtime(&time);
+  auto filename = boost::format("%04d-%02d-%02d %02d-%02d-%02d") % (localTime->tm_year + 1900)
+                  % (localTime->tm_mon + 1) % localTime->tm_mday % localTime->tm_hour % localTime->tm_min
+                  % localTime->tm_sec;
+  return filename.str() + extension;
+}
+
 std::shared_ptr<pybind11::scoped_interpreter> createScriptEngine(const std::filesystem::path& rootPath)
 {
   auto interpreter = std::make_shared<pybind11::scoped_interpreter>();
@@ -122,8 +165,12 @@ std::pair<RunResult, std::optional<size_t>> Engine::run(World& world, bool isCut
         .value_or(false);
 
   m_presenter->apply(m_engineConfig.renderSettings);
+  if(m_inputRecording != nullptr)
+    std::srand(m_inputRecording->getSeed());
+
   std::shared_ptr<menu::MenuDisplay> menu;
   Throttler throttler;
+  FixedStepClock clock;
   core::Frame laraDeadTime = 0_frame;
   while(true)
   {
@@ -137,12 +184,12 @@ std::pair<RunResult, std::optional<size_t>> Engine::run(World& world, bool isCut
       return {RunResult::NextLevel, std::nullopt};
     }
 
-    throttler.wait();
-    if(!m_presenter->preFrame())
-      continue;
-
     if(menu != nullptr)
     {
+      throttler.wait();
+      if(!m_presenter->preFrame())
+        continue;
+
       ui::Ui ui{world.getPresenter().getMaterialManager()->getScreenSpriteTextured(),
                 world.getPresenter().getMaterialManager()->getScreenSpriteColorRect(),
                 world.getPalette()};
@@ -151,6 +198,8 @@ std::pair<RunResult, std::optional<size_t>> Engine::run(World& world, bool isCut
       m_presenter->getScreenOverlay().render(context);
       ui.render(m_presenter->getViewport());
       m_presenter->swapBuffers();
+      // the game is paused while the menu is open
+      clock.reset();
       switch(menu->result)
       {
       case menu::MenuResult::None: break;
@@ -166,66 +215,260 @@ std::pair<RunResult, std::optional<size_t>> Engine::run(World& world, bool isCut
       continue;
     }
 
-    if(!isCutscene)
+    // the simulation runs at a fixed rate; with an uncapped frame rate, the frames in between are interpolated,
+    // otherwise a frame is only rendered after a simulation step
+    const bool uncappedFrameRate = m_engineConfig.renderSettings.uncappedFrameRate;
+    auto steps = clock.advance();
+    if(steps == 0 && !uncappedFrameRate)
     {
-      if(world.getObjectManager().getLara().isDead())
+      std::this_thread::sleep_until(clock.getNextStepTime());
+      continue;
+    }
+
+    if(!m_presenter->beginFrame())
+    {
+      clock.reset();
+      std::this_thread::sleep_until(clock.getNextStepTime());
+      continue;
+    }
+
+    bool cinematicEnded = false;
+    bool screenshotRequested = false;
+    bool traceRequested = false;
+    for(; steps > 0 && menu == nullptr && !cinematicEnded; --steps)
+    {
+      m_presenter->updateInput();
+
+      if(!isCutscene)
       {
-        laraDeadTime += 1_frame;
-        if(laraDeadTime >= 300_frame || (laraDeadTime >= 60_frame && m_presenter->getInputHandler().hasAnyAction()))
+        if(world.getObjectManager().getLara().isDead())
         {
-          menu = std::make_shared<menu::MenuDisplay>(menu::InventoryMode::DeathMode, world);
-          menu->allowSave = false;
-          continue;
+          laraDeadTime += 1_frame;
+          if(laraDeadTime >= 300_frame || (laraDeadTime >= 60_frame && m_presenter->getInputHandler().hasAnyAction()))
+          {
+            menu = std::make_shared<menu::MenuDisplay>(menu::InventoryMode::DeathMode, world);
+            menu->allowSave = false;
+            invalidateInputRecording();
+            break;
+          }
         }
-      }
 
-      if(m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Menu))
-      {
-        menu = std::make_shared<menu::MenuDisplay>(menu::InventoryMode::GameMode, world);
-        menu->allowSave = allowSave;
-        continue;
-      }
+        if(m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Menu))
+        {
+          menu = std::make_shared<menu::MenuDisplay>(menu::InventoryMode::GameMode, world);
+          menu->allowSave = allowSave;
+          invalidateInputRecording();
+          break;
+        }
 
-      if(allowSave && m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Save))
-      {
-        world.save("quicksave.yaml");
-        throttler.reset();
+        if(allowSave && m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Save))
+        {
+          world.save("quicksave.yaml");
+          clock.reset();
+        }
+        else if(m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Load))
+        {
+          return {RunResult::RequestLoad, std::nullopt};
+        }
+
+        if(allAmmoCheat)
+          world.getPlayer().getInventory().fillAllAmmo();
+
+        if(m_inputRecording != nullptr)
+          m_inputRecording->record(m_presenter->getInputHandler().getInputState());
+        world.gameStep(godMode);
       }
-      else if(m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Load))
+      else
       {
-        return {RunResult::RequestLoad, std::nullopt};
+        cinematicEnded = !world.cinematicStep();
       }
 
-      if(allAmmoCheat)
-        world.getPlayer().getInventory().fillAllAmmo();
+      screenshotRequested |= m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Screenshot);
+      traceRequested |= m_presenter->getInputHandler().hasDebouncedAction(hid::Action::ProfilerTrace);
+    }
+
+    if(menu != nullptr)
+      continue;
 
-      world.gameLoop(godMode);
+    world.renderFrame(uncappedFrameRate ? clock.getAlpha() : 1.0f, !isCutscene);
+
+    if(screenshotRequested)
+    {
+      makeScreenshot();
     }
-    else
+
+    if(traceRequested)
     {
-      if(!world.cinematicLoop())
-        return {RunResult::NextLevel, std::nullopt};
+      captureProfilerTrace();
     }
 
-    if(m_presenter->getInputHandler().hasDebouncedAction(hid::Action::Screenshot))
+    if(cinematicEnded)
     {
-      makeScreenshot();
+      return {RunResult::NextLevel, std::nullopt};
     }
   }
 }
 
+uint64_t Engine::runBenchmark(World& world,
+                              const std::chrono::microseconds& loadTime,
+                              size_t steps,
+                              const hid::InputRecording* replay)
+{
+  gl::Framebuffer::unbindAll();
+  auto& lara = world.getObjectManager().getLara();
+  lara.m_state.health = world.getPlayer().laraHealth;
+  lara.initWeaponAnimData();
+  m_presenter->apply(m_engineConfig.renderSettings);
+
+  if(replay != nullptr)
+  {
+    steps = replay->getFrames().size();
+    if(const auto& start = replay->getDemoStart(); start.has_value())
+    {
+      lara.m_state.position.position
+        = core::TRVec{core::Length{start->x}, core::Length{start->y}, core::Length{start->z}};
+      lara.m_state.rotation = core::TRRotation{
+        core::auToAngle(start->rotationX), core::auToAngle(start->rotationY), core::auToAngle(start->rotationZ)};
+      lara.setCurrentRoom(&world.getRooms().at(start->room));
+    }
+  }
+  Expects(steps > 0);
+  std::srand(replay != nullptr ? replay->getSeed() : BenchmarkSeed);
+
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: level loaded in " << loadTime.count() / 1000 << " ms";
+#ifdef SOGLB_NULL_BACKEND
+  {
+    const auto statistics = gl::null::getStatistics();
+    BOOST_LOG_TRIVIAL(info) << "Benchmark: loading issued " << statistics.getTotalCalls() << " GL calls, uploaded "
+                            << statistics.uploadedBufferBytes / 1024 << " kB of buffer data, and created "
+                            << statistics.programs << " programs";
+    gl::null::resetCallStatistics();
+  }
+#endif
+
+  using Clock = std::chrono::high_resolution_clock;
+  std::vector<Clock::duration> stepTimes;
+  stepTimes.reserve(steps);
+  Clock::duration renderTime{0};
+  size_t frames = 0;
+  for(size_t i = 0; i < steps; ++i)
+  {
+    if(replay != nullptr)
+      m_presenter->getInputHandler().setActions(replay->getFrames()[i]);
+
+    const auto stepStart = Clock::now();
+    world.gameStep(false);
+    stepTimes.emplace_back(Clock::now() - stepStart);
+
+    const auto frameStart = Clock::now();
+    if(!m_presenter->beginFrame())
+      continue;
+    world.renderFrame(1.0f, true);
+    renderTime += Clock::now() - frameStart;
+    ++frames;
+  }
+
+  const auto toMicroseconds = [](const auto& d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+  };
+  const auto simulationTime = std::accumulate(stepTimes.begin(), stepTimes.end(), Clock::duration{0});
+  std::sort(stepTimes.begin(), stepTimes.end());
+  const auto percentile = [&stepTimes, &toMicroseconds](const size_t p) {
+    return toMicroseconds(stepTimes[std::min(stepTimes.size() - 1, stepTimes.size() * p / 100)]);
+  };
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: " << steps << " simulation steps took " << toMicroseconds(simulationTime)
+                          << " us, " << toMicroseconds(simulationTime) / steps << " us per step on average";
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: simulation step percentiles p50 " << percentile(50) << " us, p90 "
+                          << percentile(90) << " us, p99 " << percentile(99) << " us, max "
+                          << toMicroseconds(stepTimes.back()) << " us";
+  if(frames > 0)
+  {
+    BOOST_LOG_TRIVIAL(info) << "Benchmark: " << frames << " frames took " << toMicroseconds(renderTime) << " us, "
+                            << toMicroseconds(renderTime) / frames << " us per frame on average";
+  }
+
+#ifdef SOGLB_NULL_BACKEND
+  const auto statistics = gl::null::getStatistics();
+  const auto perFrame = std::max(frames, size_t{1});
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: " << statistics.getTotalCalls() / perFrame << " GL calls and "
+                          << statistics.getDrawCalls() / perFrame << " draw calls per frame, "
+                          << statistics.uploadedBufferBytes / perFrame << " bytes of buffer uploads per frame";
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: " << statistics.bufferBytes / 1024 << " kB in buffers, "
+                          << statistics.textureTexels / 1024 << " kTexels in textures";
+
+  std::vector<std::pair<size_t, std::string>> calls;
+  for(const auto& [name, count] : statistics.calls)
+    calls.emplace_back(count, name);
+  std::sort(calls.begin(), calls.end(), std::greater<>{});
+  for(size_t i = 0; i < std::min(calls.size(), size_t{10}); ++i)
+  {
+    BOOST_LOG_TRIVIAL(info) << "Benchmark: " << calls[i].second << " called " << calls[i].first / perFrame
+                            << " times per frame";
+  }
+#endif
+
+  const auto zones = util::profiler::getSummary(std::chrono::hours{24});
+  for(size_t i = 0; i < std::min(zones.size(), BenchmarkZones); ++i)
+  {
+    BOOST_LOG_TRIVIAL(info) << "Benchmark: " << (zones[i].gpu ? "GPU" : "CPU") << " zone " << zones[i].name
+                            << " took " << toMicroseconds(zones[i].total) << " us in " << zones[i].calls << " calls, "
+                            << toMicroseconds(zones[i].total) / zones[i].calls << " us on average, "
+                            << toMicroseconds(zones[i].max) << " us max";
+  }
+  util::profiler::setEnabled(util::profiler::Consumer::Benchmark, false);
+  writeProfilerTrace(BenchmarkTraceFilename);
+
+  const auto& streamStatistics = audio::getStreamStatistics();
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: " << streamStatistics.underruns << " audio stream underruns, "
+                          << streamStatistics.underrunFrames << " frames of silence";
+
+  // the final state is kept as a savegame, so that diverging runs can be compared in detail
+  world.save(BenchmarkStateFilename);
+  const auto stateHash = hashFile(getSavegamePath() / BenchmarkStateFilename);
+  BOOST_LOG_TRIVIAL(info) << "Benchmark: final state hash " << std::hex << std::setw(16) << std::setfill('0')
+                          << stateHash << std::dec << ", state saved as " << BenchmarkStateFilename;
+  return stateHash;
+}
+
+void Engine::invalidateInputRecording()
+{
+  if(m_inputRecording == nullptr || !m_inputRecording->isValid())
+    return;
+
+  // the menus change the game state without simulation steps, so their effects cannot be replayed
+  BOOST_LOG_TRIVIAL(warning) << "A menu was opened, the input recording cannot be replayed anymore";
+  m_inputRecording->invalidate();
+}
+
 void Engine::makeScreenshot()
 {
   auto img = m_presenter->takeScreenshot();
   if(!std::filesystem::is_directory(m_rootPath / "screenshots"))
     std::filesystem::create_directories(m_rootPath / "screenshots");
 
-  auto time = std::time(nullptr);
-  auto localTime = std::localtime(&time);
-  auto filename = boost::format("%04d-%02d-%02d %02d-%02d-%02d.png") % (localTime->tm_year + 1900)
-                  % (localTime->tm_mon + 1) % localTime->tm_mday % localTime->tm_hour % localTime->tm_min
-                  % localTime->tm_sec;
-  img.savePng(m_rootPath / "screenshots" / filename.str());
+  img.savePng(m_rootPath / "screenshots" / getTimestampFilename(".png"));
+}
+
+void Engine::captureProfilerTrace()
+{
+  if(!util::profiler::isEnabled(util::profiler::Consumer::Trace))
+  {
+    // the trace covers everything until the action is triggered again
+    util::profiler::clear();
+    util::profiler::setEnabled(util::profiler::Consumer::Trace, true);
+    return;
+  }
+
+  writeProfilerTrace(getTimestampFilename(".json"));
+  util::profiler::setEnabled(util::profiler::Consumer::Trace, false);
+}
+
+void Engine::writeProfilerTrace(const std::string& filename)
+{
+  if(!std::filesystem::is_directory(m_rootPath / "traces"))
+    std::filesystem::create_directories(m_rootPath / "traces");
+
+  util::profiler::writeChromeTrace(m_rootPath / "traces" / filename);
 }
 
 std::pair<RunResult, std::optional<size_t>> Engine::runTitleMenu(World& world)
@@ -302,6 +545,19 @@ std::pair<RunResult, std::optional<size_t>> Engine::runLevelSequenceItemFromSave
   return item.runFromSave(*this, slot, player);
 }
 
+void Engine::runLevelSequenceItemBenchmark(script::LevelSequenceItem& item,
+                                           const BenchmarkSettings& settings,
+                                           const std::shared_ptr<Player>& player)
+{
+  m_presenter->getSoundEngine()->reset();
+  m_presenter->clear();
+  m_presenter->apply(m_engineConfig.renderSettings);
+  // loading the level is profiled as well
+  util::profiler::clear();
+  util::profiler::setEnabled(util::profiler::Consumer::Benchmark, true);
+  item.runBenchmark(*this, settings, player);
+}
+
 std::unique_ptr<loader::trx::Glidos> Engine::loadGlidosPack() const
 {
   if(const auto getGlidosPack = core::get<pybind11::handle>(pybind11::globals(), "getGlidosPack"))
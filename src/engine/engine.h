@@ -4,12 +4,19 @@
 #include "inventory.h"
 
 #include <boost/assert.hpp>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <glm/glm.hpp>
 #include <memory>
 #include <optional>
 #include <pybind11/embed.h>
 
+namespace hid
+{
+class InputRecording;
+}
+
 namespace loader::trx
 {
 class Glidos;
@@ -72,6 +79,17 @@ struct SavegameMeta
   void serialize(const serialization::Serializer<SavegameMeta>& ser);
 };
 
+struct BenchmarkSettings
+{
+  size_t levelSequenceIndex = 0;
+  //! The number of steps to simulate without any input if there is nothing to replay
+  size_t steps = 0;
+  //! Replayed instead of running without input
+  std::shared_ptr<const hid::InputRecording> replay{};
+  //! Replays the demo stored in the level instead
+  bool replayDemo = false;
+};
+
 inline std::string makeSavegameFilename(size_t n)
 {
   return "save_" + std::to_string(n) + ".yaml";
@@ -90,10 +108,16 @@ private:
   std::unique_ptr<I18nProvider> m_i18n;
 
   std::unique_ptr<loader::trx::Glidos> m_glidos;
+  std::shared_ptr<hid::InputRecording> m_inputRecording;
   [[nodiscard]] std::unique_ptr<loader::trx::Glidos> loadGlidosPack() const;
 
   void makeScreenshot();
 
+  //! Starts capturing a profiler trace, or writes the captured trace and stops capturing
+  void captureProfilerTrace();
+  void invalidateInputRecording();
+  void writeProfilerTrace(const std::string& filename);
+
 public:
   explicit Engine(const std::filesystem::path& rootPath,
                   bool fullscreen = false,
@@ -115,6 +139,19 @@ public:
 
   std::pair<RunResult, std::optional<size_t>> run(World& world, bool isCutscene, bool allowSave);
   std::pair<RunResult, std::optional<size_t>> runTitleMenu(World& world);
+  //! Runs and renders the simulation steps without throttling, and logs the timings and a hash of the final state.
+  //! If @a replay is null, the given number of steps is run without any input.
+  //! @returns the hash of the final state
+  uint64_t runBenchmark(World& world,
+                        const std::chrono::microseconds& loadTime,
+                        size_t steps,
+                        const hid::InputRecording* replay);
+
+  //! Records the input of all following simulation steps of run() into @a recording; opening a menu invalidates it
+  void setInputRecording(std::shared_ptr<hid::InputRecording> recording)
+  {
+    m_inputRecording = std::move(recording);
+  }
 
   [[nodiscard]] const std::string& getLanguage() const
   {
@@ -139,6 +176,9 @@ public:
   std::pair<RunResult, std::optional<size_t>> runLevelSequenceItemFromSave(script::LevelSequenceItem& item,
                                                                            const std::optional<size_t>& slot,
                                                                            const std::shared_ptr<Player>& player);
+  void runLevelSequenceItemBenchmark(script::LevelSequenceItem& item,
+                                     const BenchmarkSettings& settings,
+                                     const std::shared_ptr<Player>& player);
 
   [[nodiscard]] const auto& getGlidos() const noexcept
   {
@@ -0,0 +1,54 @@
+#include "sectorheights.h"
+
+namespace engine::floordata
+{
+SectorHeights SectorHeights::decode(const FloorDataValue* floorData)
+{
+  SectorHeights result;
+  if(floorData == nullptr)
+    return result;
+
+  const FloorDataValue* fd = floorData;
+  for(size_t chunkIndex = 0; true; ++chunkIndex)
+  {
+    const FloorDataChunk chunkHeader{*fd++};
+    switch(chunkHeader.type)
+    {
+    case FloorDataChunkType::FloorSlant: result.floorSlant = Slant{*fd++}; break;
+    case FloorDataChunkType::CeilingSlant:
+      if(chunkIndex == 0 || (chunkIndex == 1 && result.floorSlant.has_value()))
+        result.ceilingSlant = Slant{*fd};
+      ++fd;
+      break;
+    case FloorDataChunkType::PortalSector: ++fd; break;
+    case FloorDataChunkType::Death: result.lastCommandSequenceOrDeath = fd - 1; break;
+    case FloorDataChunkType::CommandSequence:
+      if(result.lastCommandSequenceOrDeath == nullptr)
+        result.lastCommandSequenceOrDeath = fd - 1;
+      ++fd;
+      while(true)
+      {
+        const Command command{*fd++};
+
+        if(command.opcode == CommandOpcode::Activate)
+        {
+          result.activatedObjects.emplace_back(command.parameter);
+        }
+        else if(command.opcode == CommandOpcode::SwitchCamera)
+        {
+          command.isLast = CameraParameters{*fd++}.isLast;
+        }
+
+        if(command.isLast)
+          break;
+      }
+      break;
+    default: break;
+    }
+    if(chunkHeader.isLast)
+      break;
+  }
+
+  return result;
+}
+} // namespace engine::floordata
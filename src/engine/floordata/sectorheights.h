@@ -0,0 +1,43 @@
+#pragma once
+
+#include "floordata.h"
+
+#include <cstdlib>
+#include <optional>
+#include <vector>
+
+namespace engine::floordata
+{
+//! The floordata of a sector that is relevant for height queries, decoded once instead of on every query
+struct SectorHeights
+{
+  struct Slant
+  {
+    int8_t x = 0;
+    int8_t z = 0;
+
+    explicit Slant() = default;
+
+    explicit Slant(const FloorDataValue fd)
+        : x{gsl::narrow_cast<int8_t>(util::bits(fd.get(), 0, 8))}
+        , z{gsl::narrow_cast<int8_t>(util::bits(fd.get(), 8, 8))}
+    {
+    }
+
+    [[nodiscard]] bool isSteep() const noexcept
+    {
+      return std::abs(x) > 2 || std::abs(z) > 2;
+    }
+  };
+
+  std::optional<Slant> floorSlant{};
+  //! Only set if the ceiling slant is the first chunk or directly follows the floor slant
+  std::optional<Slant> ceilingSlant{};
+  //! The last death chunk, or the first command sequence chunk if there is no death chunk
+  const FloorDataValue* lastCommandSequenceOrDeath = nullptr;
+  //! Parameters of the activation commands in floordata order, i.e. the objects that may patch the heights
+  std::vector<uint16_t> activatedObjects{};
+
+  static SectorHeights decode(const FloorDataValue* floorData);
+};
+} // namespace engine::floordata
@@ -0,0 +1,274 @@
+#define BOOST_TEST_MODULE floordata_test
+
+#include "loader/file/level/level.h"
+#include "sectorheights.h"
+
+#include <boost/test/included/unit_test.hpp>
+#include <random>
+
+using namespace engine::floordata;
+
+namespace
+{
+struct ReferenceHeights
+{
+  std::vector<std::pair<int8_t, int8_t>> floorSlants;
+  std::optional<std::pair<int8_t, int8_t>> ceilingSlant;
+  const FloorDataValue* lastCommandSequenceOrDeath = nullptr;
+  std::vector<uint16_t> floorPatches;
+  std::vector<uint16_t> ceilingPatches;
+};
+
+std::pair<int8_t, int8_t> toPair(const FloorDataValue fd)
+{
+  return {gsl::narrow_cast<int8_t>(util::bits(fd.get(), 0, 8)), gsl::narrow_cast<int8_t>(util::bits(fd.get(), 8, 8))};
+}
+
+// the floordata traversal of the former HeightInfo::fromFloor
+void referenceFloor(const FloorDataValue* fd, ReferenceHeights& result)
+{
+  while(true)
+  {
+    const FloorDataChunk chunkHeader{*fd++};
+    switch(chunkHeader.type)
+    {
+    case FloorDataChunkType::FloorSlant: result.floorSlants.emplace_back(toPair(*fd++)); break;
+    case FloorDataChunkType::CeilingSlant: ++fd; break;
+    case FloorDataChunkType::PortalSector: ++fd; break;
+    case FloorDataChunkType::Death: result.lastCommandSequenceOrDeath = fd - 1; break;
+    case FloorDataChunkType::CommandSequence:
+      if(result.lastCommandSequenceOrDeath == nullptr)
+        result.lastCommandSequenceOrDeath = fd - 1;
+      ++fd;
+      while(true)
+      {
+        const Command command{*fd++};
+        if(command.opcode == CommandOpcode::Activate)
+          result.floorPatches.emplace_back(command.parameter);
+        else if(command.opcode == CommandOpcode::SwitchCamera)
+          command.isLast = CameraParameters{*fd++}.isLast;
+
+        if(command.isLast)
+          break;
+      }
+      break;
+    default: break;
+    }
+    if(chunkHeader.isLast)
+      break;
+  }
+}
+
+// the floordata traversal of the former HeightInfo::fromCeiling
+void referenceCeiling(const FloorDataValue* fd, ReferenceHeights& result)
+{
+  {
+    const FloorDataValue* slantFd = fd;
+    FloorDataChunk chunkHeader{*slantFd++};
+    if(chunkHeader.type == FloorDataChunkType::FloorSlant)
+    {
+      ++slantFd;
+      chunkHeader = FloorDataChunk{*slantFd++};
+    }
+    if(chunkHeader.type == FloorDataChunkType::CeilingSlant)
+      result.ceilingSlant = toPair(*slantFd);
+  }
+
+  while(true)
+  {
+    const FloorDataChunk chunkHeader{*fd++};
+    switch(chunkHeader.type)
+    {
+    case FloorDataChunkType::CeilingSlant:
+    case FloorDataChunkType::FloorSlant:
+    case FloorDataChunkType::PortalSector: ++fd; break;
+    case FloorDataChunkType::Death: break;
+    case FloorDataChunkType::CommandSequence:
+      ++fd;
+      while(true)
+      {
+        const Command command{*fd++};
+        if(command.opcode == CommandOpcode::Activate)
+          result.ceilingPatches.emplace_back(command.parameter);
+        else if(command.opcode == CommandOpcode::SwitchCamera)
+          command.isLast = CameraParameters{*fd++}.isLast;
+
+        if(command.isLast)
+          break;
+      }
+    default: break;
+    }
+    if(chunkHeader.isLast)
+      break;
+  }
+}
+
+constexpr uint16_t IsLast = 0x8000u;
+
+uint16_t chunk(const FloorDataChunkType type)
+{
+  return static_cast<uint16_t>(type);
+}
+
+//! Creates floordata with the chunk order of the original levels, but random contents
+FloorData createFloorData(std::mt19937& rng)
+{
+  std::uniform_int_distribution<uint16_t> anyValue{0, 0x7fff};
+  std::bernoulli_distribution coin{0.5};
+  std::uniform_int_distribution<int> commandCount{1, 6};
+  std::uniform_int_distribution<uint16_t> opcode{0, 10};
+  std::uniform_int_distribution<uint16_t> parameter{0, 0x3ff};
+
+  FloorData data;
+  std::vector<size_t> chunkHeaders;
+  const auto addChunk = [&data, &chunkHeaders](const FloorDataChunkType type) {
+    chunkHeaders.emplace_back(data.size());
+    data.emplace_back(chunk(type));
+  };
+
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::FloorSlant);
+    data.emplace_back(anyValue(rng));
+  }
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::CeilingSlant);
+    data.emplace_back(anyValue(rng));
+  }
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::PortalSector);
+    data.emplace_back(static_cast<uint16_t>(anyValue(rng) & 0xffu));
+  }
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::Death);
+  }
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::CommandSequence);
+    data.back() = FloorDataValue{static_cast<uint16_t>(data.back().get() | (anyValue(rng) & 0x3f00u))};
+    data.emplace_back(anyValue(rng));
+    for(auto n = commandCount(rng); n > 0; --n)
+    {
+      const auto op = opcode(rng);
+      const uint16_t command = parameter(rng) | static_cast<uint16_t>(op << 10u);
+      if(op == static_cast<uint16_t>(CommandOpcode::SwitchCamera))
+      {
+        data.emplace_back(command);
+        data.emplace_back(static_cast<uint16_t>(anyValue(rng) | (n == 1 ? IsLast : 0u)));
+      }
+      else
+      {
+        data.emplace_back(static_cast<uint16_t>(command | (n == 1 ? IsLast : 0u)));
+      }
+    }
+  }
+  if(coin(rng))
+  {
+    addChunk(FloorDataChunkType::Death);
+  }
+
+  if(chunkHeaders.empty())
+    addChunk(FloorDataChunkType::Death);
+
+  auto& lastHeader = data[chunkHeaders.back()];
+  lastHeader = FloorDataValue{static_cast<uint16_t>(lastHeader.get() | IsLast)};
+
+  // the legacy ceiling slant lookup may read one value past a single floor slant chunk
+  data.emplace_back(uint16_t{0});
+  return data;
+}
+void requireMatchesLegacyTraversal(const FloorDataValue* fd, const SectorHeights& heights)
+{
+  ReferenceHeights reference;
+  referenceFloor(fd, reference);
+  referenceCeiling(fd, reference);
+
+  BOOST_REQUIRE_LE(reference.floorSlants.size(), 1u);
+  BOOST_REQUIRE_EQUAL(heights.floorSlant.has_value(), !reference.floorSlants.empty());
+  if(heights.floorSlant.has_value())
+  {
+    BOOST_REQUIRE_EQUAL(heights.floorSlant->x, reference.floorSlants[0].first);
+    BOOST_REQUIRE_EQUAL(heights.floorSlant->z, reference.floorSlants[0].second);
+  }
+
+  BOOST_REQUIRE_EQUAL(heights.ceilingSlant.has_value(), reference.ceilingSlant.has_value());
+  if(heights.ceilingSlant.has_value())
+  {
+    BOOST_REQUIRE_EQUAL(heights.ceilingSlant->x, reference.ceilingSlant->first);
+    BOOST_REQUIRE_EQUAL(heights.ceilingSlant->z, reference.ceilingSlant->second);
+  }
+
+  BOOST_REQUIRE(heights.lastCommandSequenceOrDeath == reference.lastCommandSequenceOrDeath);
+  BOOST_REQUIRE(heights.activatedObjects == reference.floorPatches);
+  BOOST_REQUIRE(heights.activatedObjects == reference.ceilingPatches);
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(sector_heights_tests)
+
+BOOST_AUTO_TEST_CASE(test_no_floordata)
+{
+  const auto heights = SectorHeights::decode(nullptr);
+  BOOST_CHECK(!heights.floorSlant.has_value());
+  BOOST_CHECK(!heights.ceilingSlant.has_value());
+  BOOST_CHECK(heights.lastCommandSequenceOrDeath == nullptr);
+  BOOST_CHECK(heights.activatedObjects.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_slants)
+{
+  const FloorData data{FloorDataValue{chunk(FloorDataChunkType::FloorSlant)},
+                       FloorDataValue{uint16_t{0xfd02u}},
+                       FloorDataValue{static_cast<uint16_t>(chunk(FloorDataChunkType::CeilingSlant) | IsLast)},
+                       FloorDataValue{uint16_t{0x0004u}}};
+  const auto heights = SectorHeights::decode(data.data());
+  BOOST_REQUIRE(heights.floorSlant.has_value());
+  BOOST_CHECK_EQUAL(heights.floorSlant->x, 2);
+  BOOST_CHECK_EQUAL(heights.floorSlant->z, -3);
+  BOOST_CHECK(heights.floorSlant->isSteep());
+  BOOST_REQUIRE(heights.ceilingSlant.has_value());
+  BOOST_CHECK_EQUAL(heights.ceilingSlant->x, 4);
+  BOOST_CHECK_EQUAL(heights.ceilingSlant->z, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_matches_legacy_traversal)
+{
+  std::mt19937 rng{42};
+  for(int i = 0; i < 100000; ++i)
+  {
+    const auto data = createFloorData(rng);
+    requireMatchesLegacyTraversal(data.data(), SectorHeights::decode(data.data()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_level_matches_legacy_traversal)
+{
+  auto level = loader::file::level::Level::createLoader(TEST_LEVEL, loader::file::level::Game::Unknown);
+  level->loadFileData();
+
+  size_t sectorsWithFloorData = 0;
+  for(const auto& room : level->m_rooms)
+  {
+    for(const auto& sector : room.sectors)
+    {
+      if(sector.floorData == nullptr)
+      {
+        BOOST_REQUIRE(!sector.heights.floorSlant.has_value());
+        BOOST_REQUIRE(!sector.heights.ceilingSlant.has_value());
+        BOOST_REQUIRE(sector.heights.lastCommandSequenceOrDeath == nullptr);
+        BOOST_REQUIRE(sector.heights.activatedObjects.empty());
+        continue;
+      }
+
+      ++sectorsWithFloorData;
+      requireMatchesLegacyTraversal(sector.floorData, sector.heights);
+    }
+  }
+
+  BOOST_CHECK_GT(sectorsWithFloorData, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
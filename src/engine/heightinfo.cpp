@@ -2,6 +2,7 @@
 
 #include "cameracontroller.h"
 #include "engine/objects/object.h"
+#include "objecttable.h"
 
 namespace engine
 {
@@ -9,7 +10,7 @@ bool HeightInfo::skipSteepSlants = false;
 
 HeightInfo HeightInfo::fromFloor(gsl::not_null<const loader::file::Sector*> roomSector,
                                  const core::TRVec& pos,
-                                 const std::map<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& objects)
+                                 const ObjectTable& objects)
 {
   HeightInfo hi;
 
@@ -20,95 +21,49 @@ HeightInfo HeightInfo::fromFloor(gsl::not_null<const loader::file::Sector*> room
 
   hi.y = roomSector->floorHeight;
 
-  if(roomSector->floorData == nullptr)
+  const auto& heights = roomSector->heights;
+  if(const auto& slant = heights.floorSlant; slant.has_value() && (!skipSteepSlants || !slant->isSteep()))
   {
-    return hi;
-  }
+    hi.slantClass = slant->isSteep() ? SlantClass::Steep : SlantClass::Max512;
 
-  // process additional slant and object height patches
-  const floordata::FloorDataValue* fd = roomSector->floorData;
-  while(true)
-  {
-    const floordata::FloorDataChunk chunkHeader{*fd++};
-    switch(chunkHeader.type)
+    const core::Length::type xSlant = slant->x;
+    const core::Length::type zSlant = slant->z;
+    const auto localX = pos.X % core::SectorSize;
+    const auto localZ = pos.Z % core::SectorSize;
+
+    if(zSlant > 0) // lower edge at -Z
+    {
+      const core::Length dist = core::SectorSize - localZ;
+      hi.y += dist * zSlant * core::QuarterSectorSize / core::SectorSize;
+    }
+    else if(zSlant < 0) // lower edge at +Z
     {
-    case floordata::FloorDataChunkType::FloorSlant:
+      const auto dist = localZ;
+      hi.y -= dist * zSlant * core::QuarterSectorSize / core::SectorSize;
+    }
+
+    if(xSlant > 0) // lower edge at -X
     {
-      const core::Length::type xSlant = gsl::narrow_cast<int8_t>(util::bits(fd->get(), 0, 8));
-      const core::Length::type zSlant = gsl::narrow_cast<int8_t>(util::bits(fd->get(), 8, 8));
-      ++fd;
-      const core::Length::type absX = std::abs(xSlant);
-      const core::Length::type absZ = std::abs(zSlant);
-      if(!skipSteepSlants || (absX <= 2 && absZ <= 2))
-      {
-        if(absX <= 2 && absZ <= 2)
-          hi.slantClass = SlantClass::Max512;
-        else
-          hi.slantClass = SlantClass::Steep;
-
-        const auto localX = pos.X % core::SectorSize;
-        const auto localZ = pos.Z % core::SectorSize;
-
-        if(zSlant > 0) // lower edge at -Z
-        {
-          const core::Length dist = core::SectorSize - localZ;
-          hi.y += dist * zSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-        else if(zSlant < 0) // lower edge at +Z
-        {
-          const auto dist = localZ;
-          hi.y -= dist * zSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-
-        if(xSlant > 0) // lower edge at -X
-        {
-          const auto dist = core::SectorSize - localX;
-          hi.y += dist * xSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-        else if(xSlant < 0) // lower edge at +X
-        {
-          const auto dist = localX;
-          hi.y -= dist * xSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-      }
+      const auto dist = core::SectorSize - localX;
+      hi.y += dist * xSlant * core::QuarterSectorSize / core::SectorSize;
     }
-    break;
-    case floordata::FloorDataChunkType::CeilingSlant: ++fd; break;
-    case floordata::FloorDataChunkType::PortalSector: ++fd; break;
-    case floordata::FloorDataChunkType::Death: hi.lastCommandSequenceOrDeath = fd - 1; break;
-    case floordata::FloorDataChunkType::CommandSequence:
-      if(hi.lastCommandSequenceOrDeath == nullptr)
-        hi.lastCommandSequenceOrDeath = fd - 1;
-      ++fd;
-      while(true)
-      {
-        const floordata::Command command{*fd++};
-
-        if(command.opcode == floordata::CommandOpcode::Activate)
-        {
-          objects.at(command.parameter)->patchFloor(pos, hi.y);
-        }
-        else if(command.opcode == floordata::CommandOpcode::SwitchCamera)
-        {
-          command.isLast = floordata::CameraParameters{*fd++}.isLast;
-        }
-
-        if(command.isLast)
-          break;
-      }
-      break;
-    default: break;
+    else if(xSlant < 0) // lower edge at +X
+    {
+      const auto dist = localX;
+      hi.y -= dist * xSlant * core::QuarterSectorSize / core::SectorSize;
     }
-    if(chunkHeader.isLast)
-      break;
   }
 
+  hi.lastCommandSequenceOrDeath = heights.lastCommandSequenceOrDeath;
+  for(const auto objectId : heights.activatedObjects)
+    objects.at(objectId)->patchFloor(pos, hi.y);
+
   return hi;
 }
 
 HeightInfo HeightInfo::fromCeiling(gsl::not_null<const loader::file::Sector*> roomSector,
                                    const core::TRVec& pos,
-                                   const std::map<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& objects)
+                                   const ObjectTable& objects)
 {
   HeightInfo hi;
 
@@ -119,53 +74,34 @@ HeightInfo HeightInfo::fromCeiling(gsl::not_null<const loader::file::Sector*> ro
 
   hi.y = roomSector->ceilingHeight;
 
-  if(roomSector->floorData != nullptr)
+  if(const auto& slant = roomSector->heights.ceilingSlant;
+     slant.has_value() && (!skipSteepSlants || !slant->isSteep()))
   {
-    const floordata::FloorDataValue* fd = roomSector->floorData;
-    floordata::FloorDataChunk chunkHeader{*fd};
-    ++fd;
+    const core::Length::type xSlant = slant->x;
+    const core::Length::type zSlant = slant->z;
+    const auto localX = pos.X % core::SectorSize;
+    const auto localZ = pos.Z % core::SectorSize;
 
-    if(chunkHeader.type == floordata::FloorDataChunkType::FloorSlant)
+    if(zSlant > 0) // lower edge at -Z
     {
-      ++fd;
-
-      chunkHeader = floordata::FloorDataChunk{*fd};
-      ++fd;
+      const auto dist = core::SectorSize - localZ;
+      hi.y -= dist * zSlant * core::QuarterSectorSize / core::SectorSize;
+    }
+    else if(zSlant < 0) // lower edge at +Z
+    {
+      const auto dist = localZ;
+      hi.y += dist * zSlant * core::QuarterSectorSize / core::SectorSize;
     }
 
-    if(chunkHeader.type == floordata::FloorDataChunkType::CeilingSlant)
+    if(xSlant > 0) // lower edge at -X
     {
-      const core::Length::type xSlant = gsl::narrow_cast<int8_t>(util::bits(fd->get(), 0, 8));
-      const core::Length::type absX = std::abs(xSlant);
-      const core::Length::type zSlant = gsl::narrow_cast<int8_t>(util::bits(fd->get(), 8, 8));
-      const core::Length::type absZ = std::abs(zSlant);
-      if(!skipSteepSlants || (absX <= 2 && absZ <= 2))
-      {
-        const auto localX = pos.X % core::SectorSize;
-        const auto localZ = pos.Z % core::SectorSize;
-
-        if(zSlant > 0) // lower edge at -Z
-        {
-          const auto dist = core::SectorSize - localZ;
-          hi.y -= dist * zSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-        else if(zSlant < 0) // lower edge at +Z
-        {
-          const auto dist = localZ;
-          hi.y += dist * zSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-
-        if(xSlant > 0) // lower edge at -X
-        {
-          const auto dist = localX;
-          hi.y -= dist * xSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-        else if(xSlant < 0) // lower edge at +X
-        {
-          const auto dist = core::SectorSize - localX;
-          hi.y += dist * xSlant * core::QuarterSectorSize / core::SectorSize;
-        }
-      }
+      const auto dist = localX;
+      hi.y -= dist * xSlant * core::QuarterSectorSize / core::SectorSize;
+    }
+    else if(xSlant < 0) // lower edge at +X
+    {
+      const auto dist = core::SectorSize - localX;
+      hi.y += dist * xSlant * core::QuarterSectorSize / core::SectorSize;
     }
   }
 
@@ -174,42 +110,8 @@ HeightInfo HeightInfo::fromCeiling(gsl::not_null<const loader::file::Sector*> ro
     roomSector = roomSector->roomBelow->getSectorByAbsolutePosition(pos);
   }
 
-  if(roomSector->floorData == nullptr)
-    return hi;
-
-  const floordata::FloorDataValue* fd = roomSector->floorData;
-  while(true)
-  {
-    const floordata::FloorDataChunk chunkHeader{*fd++};
-    switch(chunkHeader.type)
-    {
-    case floordata::FloorDataChunkType::CeilingSlant:
-    case floordata::FloorDataChunkType::FloorSlant:
-    case floordata::FloorDataChunkType::PortalSector: ++fd; break;
-    case floordata::FloorDataChunkType::Death: break;
-    case floordata::FloorDataChunkType::CommandSequence:
-      ++fd;
-      while(true)
-      {
-        const floordata::Command command{*fd++};
-
-        if(command.opcode == floordata::CommandOpcode::Activate)
-        {
-          objects.at(command.parameter)->patchCeiling(pos, hi.y);
-        }
-        else if(command.opcode == floordata::CommandOpcode::SwitchCamera)
-        {
-          command.isLast = floordata::CameraParameters{*fd++}.isLast;
-        }
-
-        if(command.isLast)
-          break;
-      }
-    default: break;
-    }
-    if(chunkHeader.isLast)
-      break;
-  }
+  for(const auto objectId : roomSector->heights.activatedObjects)
+    objects.at(objectId)->patchCeiling(pos, hi.y);
 
   return hi;
 }
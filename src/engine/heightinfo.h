@@ -5,6 +5,7 @@
 namespace engine
 {
 class CameraController;
+class ObjectTable;
 
 enum class SlantClass
 {
@@ -23,11 +24,11 @@ struct HeightInfo
 
   static HeightInfo fromFloor(gsl::not_null<const loader::file::Sector*> roomSector,
                               const core::TRVec& pos,
-                              const std::map<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& objects);
+                              const ObjectTable& objects);
 
   static HeightInfo fromCeiling(gsl::not_null<const loader::file::Sector*> roomSector,
                                 const core::TRVec& pos,
-                                const std::map<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& objects);
+                                const ObjectTable& objects);
 
   HeightInfo() = default;
 };
@@ -39,7 +40,7 @@ struct VerticalSpaceInfo
 
   void init(const gsl::not_null<const loader::file::Sector*>& roomSector,
             const core::TRVec& position,
-            const std::map<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& objects,
+            const ObjectTable& objects,
             const core::Length& itemY,
             const core::Length& itemHeight)
   {
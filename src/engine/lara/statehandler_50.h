@@ -2,7 +2,7 @@
 
 #include "abstractstatehandler.h"
 #include "engine/collisioninfo.h"
-#include "engine/particle.h"
+#include "engine/particlepool.h"
 
 namespace engine::lara
 {
@@ -50,9 +50,8 @@ public:
       p.X += util::rand15s(r);
       p.Y += util::rand15s(r);
       p.Z += util::rand15s(r);
-      auto fx = std::make_shared<SparkleParticle>(
-        core::RoomBoundPosition{world.getObjectManager().getLara().m_state.position.room, p}, world);
-      world.getObjectManager().registerParticle(fx);
+      world.getParticlePool().emitSparkle(
+        core::RoomBoundPosition{world.getObjectManager().getLara().m_state.position.room, p});
     }
   }
 };
@@ -4,7 +4,9 @@
 #include "loader/file/datatypes.h"
 #include "util/helpers.h"
 
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <gsl-lite.hpp>
 
 namespace engine
 {
@@ -29,16 +31,45 @@ struct Lighting
   };
   static_assert(sizeof(Light) == 32, "Invalid Light struct size");
 
+  //! Contributions below this are dropped, see calc_positional_lighting in lighting.glsl
+  static constexpr float MinIntensity = 1.0f / 256.0f;
+
+  [[nodiscard]] static Light toLight(const loader::file::Light& light)
+  {
+    return Light{glm::vec4{light.position.toRenderSystem(), 0.0f},
+                 toBrightness(light.intensity).get(),
+                 light.fadeDistance.get<float>()};
+  }
+
+  //! The shader uses brightness / ((d/fade)^2 + 1), which is less than MinIntensity beyond this distance
+  [[nodiscard]] static float getCutoffDistance(const Light& light)
+  {
+    return light.fadeDistance * std::sqrt(std::max(light.brightness / MinIntensity - 1.0f, 0.0f));
+  }
+
+  //! A light that may affect a room, see RoomLightNeighbourhoods
+  struct NeighbourhoodLight
+  {
+    Light light;
+    //! See getCutoffDistance()
+    float cutoffDistance = 0;
+  };
+
   core::Brightness ambient{-1.0f};
   core::Brightness targetAmbient{};
+  //! The positional lights affecting the object if clustered lighting is disabled
   std::vector<Light> lights;
   std::vector<Light> bufferLights;
+  //! Whether positional lights affect the object at all
+  bool dynamic = false;
 
   gl::ShaderStorageBuffer<Light> m_buffer{"lights-buffer"};
 
+  //! Collects the lights of the room's neighbourhood reaching the object, see RoomLightNeighbourhoods
   void updateDynamic(const core::Shade& shade,
                      const core::RoomBoundPosition& pos,
-                     const std::vector<loader::file::Room>& rooms)
+                     const std::vector<NeighbourhoodLight>& neighbourhoodLights,
+                     const gsl::span<const uint32_t>& neighbourhood)
   {
     if(shade.get() >= 0)
     {
@@ -46,57 +77,52 @@ struct Lighting
       return;
     }
 
+    // objects are lit by their center, but their surface may be closer to a light
+    static constexpr auto ObjectRadius = core::SectorSize.get<float>();
+
     setAmbient(pos.room->ambientShade);
 
     lights.clear();
-    if(pos.room->lights.empty())
+    if(!pos.room->lights.empty())
     {
-      m_buffer.setData(lights, gl::api::BufferUsageARB::StreamDraw);
-      return;
+      const auto center = pos.position.toRenderSystem();
+      for(const auto i : neighbourhood)
+      {
+        const auto& neighbourhoodLight = neighbourhoodLights[i];
+        const auto d = glm::vec3{neighbourhoodLight.light.position} - center;
+        const auto cutoffDistance = neighbourhoodLight.cutoffDistance + ObjectRadius;
+        if(glm::dot(d, d) <= cutoffDistance * cutoffDistance)
+          lights.emplace_back(neighbourhoodLight.light);
+      }
     }
 
-    std::set<gsl::not_null<const loader::file::Room*>> testRooms;
-    testRooms.emplace(pos.room);
-    std::transform(pos.room->portals.begin(),
-                   pos.room->portals.end(),
-                   std::inserter(testRooms, testRooms.end()),
-                   [&rooms](const auto& portal) { return &rooms.at(portal.adjoining_room.get()); });
+    dynamic = !lights.empty();
+    if(bufferLights == lights)
+      return;
 
-    std::set<gsl::not_null<const loader::file::Room*>> testRooms2;
-    for(const auto& room : testRooms)
-    {
-      testRooms2.emplace(room);
-      std::transform(room->portals.begin(),
-                     room->portals.end(),
-                     std::inserter(testRooms2, testRooms2.end()),
-                     [&rooms](const auto& portal) { return &rooms.at(portal.adjoining_room.get()); });
-    }
+    m_buffer.setData(lights, gl::api::BufferUsageARB::DynamicDraw);
+    bufferLights = lights;
+  }
 
-    for(const auto& room : testRooms2)
+  //! With clustered lighting, the positional lights are gathered per frame for the whole view, so only the ambient
+  //! light is tracked per object
+  void updateClustered(const core::Shade& shade, const core::RoomBoundPosition& pos)
+  {
+    if(shade.get() >= 0)
     {
-      // http://www-f9.ijs.si/~matevz/docs/PovRay/pov274.htm
-      // 1 / ( 1 + (d/fade_distance) ^ fade_power );
-      // assuming fade_power = 1, multiply numerator and denominator with fade_distance (identity transform):
-      // fade_distance / ( fade_distance + d )
-
-      for(const auto& light : room->lights)
-      {
-        if(light.intensity.get() <= 0)
-          continue;
-        lights.emplace_back(Light{glm::vec4{light.position.toRenderSystem(), 0.0f},
-                                  toBrightness(light.intensity).get(),
-                                  light.fadeDistance.get<float>()});
-      }
+      updateStatic(shade);
+      return;
     }
 
-    if(bufferLights != lights)
-      m_buffer.setData(lights, gl::api::BufferUsageARB::DynamicDraw);
-    bufferLights = lights;
+    setAmbient(pos.room->ambientShade);
+    dynamic = !pos.room->lights.empty();
   }
 
   void updateStatic(const core::Shade& shade)
   {
+    dynamic = false;
     lights.clear();
+    bufferLights.clear();
     setAmbient(shade);
     m_buffer.setData(lights, gl::api::BufferUsageARB::StaticDraw);
   }
@@ -116,9 +142,89 @@ struct Lighting
       uniform.set(ambient.get());
     });
 
+    node.addUniformSetter("u_dynamicLighting", [this](const render::scene::Node& /*node*/, gl::Uniform& uniform) {
+      uniform.set(dynamic ? 1 : 0);
+    });
+
     node.addBufferBinder("b_lights", [this](const render::scene::Node&, gl::ShaderStorageBlock& shaderStorageBlock) {
       shaderStorageBlock.bind(m_buffer);
     });
   }
 };
+
+//! The lights of each room and its neighbours up to two portals away; depends on the current room configuration
+class RoomLightNeighbourhoods final
+{
+public:
+  RoomLightNeighbourhoods() = default;
+
+  explicit RoomLightNeighbourhoods(const std::vector<loader::file::Room>& rooms)
+  {
+    std::vector<size_t> roomLightOffsets;
+    roomLightOffsets.reserve(rooms.size() + 1);
+    for(const auto& room : rooms)
+    {
+      roomLightOffsets.emplace_back(m_lights.size());
+      for(const auto& light : room.lights)
+      {
+        if(light.intensity.get() <= 0)
+          continue;
+
+        const auto tmp = Lighting::toLight(light);
+        m_lights.emplace_back(Lighting::NeighbourhoodLight{tmp, Lighting::getCutoffDistance(tmp)});
+      }
+    }
+    roomLightOffsets.emplace_back(m_lights.size());
+
+    m_offsets.reserve(rooms.size() + 1);
+    m_offsets.emplace_back(0);
+    std::vector<size_t> neighbourhood;
+    for(const auto& room : rooms)
+    {
+      neighbourhood.clear();
+      collectNeighbourhood(rooms, room, 2, neighbourhood);
+      std::sort(neighbourhood.begin(), neighbourhood.end());
+      neighbourhood.erase(std::unique(neighbourhood.begin(), neighbourhood.end()), neighbourhood.end());
+
+      for(const auto roomIndex : neighbourhood)
+      {
+        for(auto i = roomLightOffsets[roomIndex]; i < roomLightOffsets[roomIndex + 1]; ++i)
+          m_indices.emplace_back(gsl::narrow<uint32_t>(i));
+      }
+      m_offsets.emplace_back(m_indices.size());
+    }
+  }
+
+  //! The indices into getLights() of the lights that may affect a room, ascending and without duplicates
+  [[nodiscard]] gsl::span<const uint32_t> get(const size_t roomIndex) const
+  {
+    Expects(roomIndex + 1 < m_offsets.size());
+    return gsl::span<const uint32_t>{m_indices.data() + m_offsets[roomIndex],
+                                     m_indices.data() + m_offsets[roomIndex + 1]};
+  }
+
+  //! The lights of all rooms, each only once
+  [[nodiscard]] const std::vector<Lighting::NeighbourhoodLight>& getLights() const noexcept
+  {
+    return m_lights;
+  }
+
+private:
+  std::vector<Lighting::NeighbourhoodLight> m_lights;
+  std::vector<uint32_t> m_indices;
+  std::vector<size_t> m_offsets;
+
+  static void collectNeighbourhood(const std::vector<loader::file::Room>& rooms,
+                                   const loader::file::Room& room,
+                                   const int depth,
+                                   std::vector<size_t>& neighbourhood)
+  {
+    neighbourhood.emplace_back(gsl::narrow<size_t>(std::distance(rooms.data(), &room)));
+    if(depth <= 0)
+      return;
+
+    for(const auto& portal : room.portals)
+      collectNeighbourhood(rooms, rooms.at(portal.adjoining_room.get()), depth - 1, neighbourhood);
+  }
+};
 } // namespace engine
@@ -1,15 +1,24 @@
 #include "objectmanager.h"
 
+#include "core/magic.h"
+#include "loader/file/datatypes.h"
 #include "loader/file/item.h"
+#include "objects/block.h"
 #include "objects/laraobject.h"
 #include "objects/objectfactory.h"
+#include "objects/tallblock.h"
 #include "particle.h"
+#include "particlepool.h"
 #include "serialization/map.h"
 #include "serialization/not_null.h"
 #include "serialization/objectreference.h"
 #include "serialization/serialization.h"
+#include "util/profiler.h"
 
+#include <algorithm>
 #include <boost/range/adaptor/indexed.hpp>
+#include <iterator>
+#include <map>
 
 namespace engine
 {
@@ -31,6 +40,7 @@ void ObjectManager::createObjects(World& world, std::vector<loader::file::Item>&
     if(object != nullptr)
     {
       m_objects.emplace(gsl::narrow<ObjectId>(idItem.index()), object);
+      addToRoomIndex(*object);
     }
   }
 }
@@ -42,23 +52,25 @@ void ObjectManager::applyScheduledDeletions()
 
   for(const auto& del : m_scheduledDeletions)
   {
-    auto it = std::find_if(m_dynamicObjects.begin(),
-                           m_dynamicObjects.end(),
-                           [del](const std::shared_ptr<objects::Object>& i) { return i.get() == del; });
-    if(it != m_dynamicObjects.end())
+    if(const auto it = m_dynamicObjectIndices.find(del); it != m_dynamicObjectIndices.end())
     {
-      m_dynamicObjects.erase(it);
+      removeFromRoomIndex(*del, del->m_state.position.room);
+
+      const auto index = it->second;
+      m_dynamicObjectIndices.erase(it);
+      if(index != m_dynamicObjects.size() - 1)
+      {
+        m_dynamicObjects[index] = m_dynamicObjects.back();
+        m_dynamicObjectIndices[m_dynamicObjects[index].get().get()] = index;
+      }
+      m_dynamicObjects.pop_back();
       continue;
     }
 
-    auto it2 = std::find_if(m_objects.begin(),
-                            m_objects.end(),
-                            [del](const std::pair<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& i) {
-                              return i.second.get().get() == del;
-                            });
-    if(it2 != m_objects.end())
+    if(m_objects.getId(del).has_value())
     {
-      m_objects.erase(it2);
+      removeFromRoomIndex(*del, del->m_state.position.room);
+      m_objects.erase(del);
       continue;
     }
   }
@@ -72,6 +84,16 @@ void ObjectManager::registerObject(const gsl::not_null<std::shared_ptr<objects::
     BOOST_THROW_EXCEPTION(std::runtime_error("Artificial object counter exceeded"));
 
   m_objects.emplace(m_objectCounter++, object);
+  addToRoomIndex(*object);
+}
+
+void ObjectManager::registerDynamicObject(const gsl::not_null<std::shared_ptr<objects::Object>>& object)
+{
+  if(!m_dynamicObjectIndices.emplace(object.get().get(), m_dynamicObjects.size()).second)
+    return;
+
+  m_dynamicObjects.emplace_back(object);
+  addToRoomIndex(*object);
 }
 
 std::shared_ptr<objects::Object> ObjectManager::find(const objects::Object* object) const
@@ -79,32 +101,44 @@ std::shared_ptr<objects::Object> ObjectManager::find(const objects::Object* obje
   if(object == nullptr)
     return nullptr;
 
-  auto it = std::find_if(m_objects.begin(),
-                         m_objects.end(),
-                         [object](const std::pair<uint16_t, gsl::not_null<std::shared_ptr<objects::Object>>>& x) {
-                           return x.second.get().get() == object;
-                         });
-
-  if(it == m_objects.end())
+  const auto id = m_objects.getId(object);
+  if(!id.has_value())
     return nullptr;
 
-  return it->second;
+  return m_objects.get(*id);
 }
 
 std::shared_ptr<objects::Object> ObjectManager::getObject(ObjectId id) const
 {
-  const auto it = m_objects.find(id);
-  if(it == m_objects.end())
-    return nullptr;
-
-  return it->second.get();
+  return m_objects.get(id);
 }
 
 void ObjectManager::update(World& world, bool godMode)
 {
-  for(const auto& object : m_objects | boost::adaptors::map_values)
+  UTIL_PROFILE_ZONE("object-update");
+  world.getPathSearchCache().nextFrame();
+
+  // the path searches are the expensive part of the creature AI; their expansions are recorded in parallel up front,
+  // and only applied when the creatures are updated one after another below
+  if(m_precomputePathSearches)
   {
-    if(object.get() == m_lara) // Lara is special and needs to be updated last
+    UTIL_PROFILE_ZONE("path-search");
+    std::vector<gsl::not_null<ai::PathFinder*>> pathFinders;
+    const auto collectPathFinder = [&pathFinders](const objects::Object& object) {
+      if(object.m_isActive && !object.m_state.isDead() && object.m_state.creatureInfo != nullptr)
+        pathFinders.emplace_back(&object.m_state.creatureInfo->pathFinder);
+    };
+    for(const auto& object : m_objects)
+      collectPathFinder(*object);
+    for(const auto& object : m_dynamicObjects)
+      collectPathFinder(*object);
+    ai::searchPaths(world, pathFinders);
+  }
+
+  // the objects are copied, as objects may register new objects while being updated
+  for(const auto object : m_objects)
+  {
+    if(object == m_lara) // Lara is special and needs to be updated last
       continue;
 
     if(object->m_isActive)
@@ -114,8 +148,10 @@ void ObjectManager::update(World& world, bool godMode)
     object->getNode()->setVisible(object->m_state.triggerState != objects::TriggerState::Invisible);
   }
 
-  for(const auto& object : m_dynamicObjects)
+  // indexed, as objects may register new dynamic objects while being updated
+  for(size_t i = 0; i < m_dynamicObjects.size(); ++i)
   {
+    const auto object = m_dynamicObjects[i];
     if(object->m_isActive)
       object->update();
 
@@ -138,6 +174,8 @@ void ObjectManager::update(World& world, bool godMode)
     }
   }
 
+  world.getParticlePool().update(world);
+
   if(m_lara != nullptr)
   {
     if(godMode)
@@ -151,9 +189,170 @@ void ObjectManager::update(World& world, bool godMode)
 
 void ObjectManager::serialize(const serialization::Serializer<World>& ser)
 {
+  // the objects are serialized as a map for savegame compatibility
+  std::map<ObjectId, gsl::not_null<std::shared_ptr<objects::Object>>> objectMap;
+  if(!ser.loading)
+  {
+    for(auto it = m_objects.begin(); it != m_objects.end(); ++it)
+      objectMap.emplace(it.id(), *it);
+  }
+
   ser(S_NV("objectCounter", m_objectCounter),
-      S_NV("objects", m_objects),
+      S_NV("objects", objectMap),
       S_NV("lara", serialization::ObjectReference{m_lara}));
+
+  if(ser.loading)
+  {
+    m_objects.clear();
+    for(const auto& [id, object] : objectMap)
+      m_objects.emplace(id, object);
+
+    ser.lazy([this](const serialization::Serializer<World>& /*ser*/) { rebuildRoomIndex(); });
+  }
+}
+
+void ObjectManager::addToRoomIndex(objects::Object& object)
+{
+  m_roomObjects[object.m_state.position.room].emplace_back(&object);
+}
+
+bool ObjectManager::removeFromRoomIndex(const objects::Object& object, const loader::file::Room* room)
+{
+  const auto roomIt = m_roomObjects.find(room);
+  if(roomIt == m_roomObjects.end())
+    return false;
+
+  auto& roomObjects = roomIt->second;
+  const auto it = std::find(roomObjects.begin(), roomObjects.end(), &object);
+  if(it == roomObjects.end())
+    return false;
+
+  *it = roomObjects.back();
+  roomObjects.pop_back();
+  return true;
+}
+
+void ObjectManager::rebuildRoomIndex()
+{
+  m_roomObjects.clear();
+  for(const auto& object : m_objects)
+    addToRoomIndex(*object);
+  for(const auto& object : m_dynamicObjects)
+    addToRoomIndex(*object);
+}
+
+const std::vector<objects::Object*>& ObjectManager::getObjectsInRoom(const loader::file::Room* room) const
+{
+  static const std::vector<objects::Object*> empty;
+
+  const auto it = m_roomObjects.find(room);
+  return it == m_roomObjects.end() ? empty : it->second;
+}
+
+std::vector<objects::Object*> ObjectManager::getObjectsNear(const core::RoomBoundPosition& pos,
+                                                            const core::Length& maxDistance,
+                                                            const std::vector<loader::file::Room>& rooms) const
+{
+  std::vector<const loader::file::Room*> nearRooms{pos.room};
+  for(const loader::file::Portal& portal : pos.room->portals)
+  {
+    const auto room = &rooms.at(portal.adjoining_room.get());
+    if(std::find(nearRooms.begin(), nearRooms.end(), room) == nearRooms.end())
+      nearRooms.emplace_back(room);
+  }
+
+  std::vector<objects::Object*> result;
+  for(const auto& room : nearRooms)
+  {
+    for(const auto& object : getObjectsInRoom(room))
+    {
+      const auto d = pos.position - object->m_state.position.position;
+      if(abs(d.X) < maxDistance && abs(d.Y) < maxDistance && abs(d.Z) < maxDistance)
+        result.emplace_back(object);
+    }
+  }
+  return result;
+}
+
+std::vector<const loader::file::Room*> ObjectManager::getRoomsWithin(const core::RoomBoundPosition& pos,
+                                                                    const core::Length& maxDistance,
+                                                                    const std::vector<loader::file::Room>& rooms)
+{
+  const auto isWithin = [&pos, &maxDistance](const loader::file::Room& room) {
+    const auto minY = std::min(room.lowestHeight, room.greatestHeight);
+    const auto maxY = std::max(room.lowestHeight, room.greatestHeight);
+    return pos.position.X > room.position.X - maxDistance
+           && pos.position.X < room.position.X + room.sectorCountX * core::SectorSize + maxDistance
+           && pos.position.Z > room.position.Z - maxDistance
+           && pos.position.Z < room.position.Z + room.sectorCountZ * core::SectorSize + maxDistance
+           && pos.position.Y > minY - maxDistance && pos.position.Y < maxY + maxDistance;
+  };
+
+  // a straight line from pos to anything in range only passes through rooms in range, so the search doesn't need to
+  // leave them
+  std::vector<const loader::file::Room*> result{pos.room};
+  for(size_t i = 0; i < result.size(); ++i)
+  {
+    for(const loader::file::Portal& portal : result[i]->portals)
+    {
+      const auto room = &rooms.at(portal.adjoining_room.get());
+      if(!isWithin(*room) || std::find(result.begin(), result.end(), room) != result.end())
+        continue;
+
+      result.emplace_back(room);
+    }
+  }
+  return result;
+}
+
+std::vector<std::shared_ptr<objects::Object>>
+  ObjectManager::getCreaturesInRooms(const std::vector<const loader::file::Room*>& rooms) const
+{
+  // the room index is unordered, but callers resolve ties in id order
+  std::vector<ObjectId> ids;
+  for(const auto& room : rooms)
+  {
+    for(const auto& object : getObjectsInRoom(room))
+    {
+      if(object->m_state.isDead())
+        continue;
+
+      if(const auto id = m_objects.getId(object); id.has_value())
+        ids.emplace_back(*id);
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+
+  std::vector<std::shared_ptr<objects::Object>> result;
+  result.reserve(ids.size());
+  std::transform(ids.begin(), ids.end(), std::back_inserter(result), [this](const ObjectId id) {
+    return m_objects.at(id).get();
+  });
+  return result;
+}
+
+std::vector<std::pair<const objects::Object*, core::Length>>
+  ObjectManager::getBlocksInRoom(const loader::file::Room* room) const
+{
+  std::vector<std::pair<const objects::Object*, core::Length>> result;
+  for(const auto& object : getObjectsInRoom(room))
+  {
+    if(dynamic_cast<const objects::Block*>(object) != nullptr)
+      result.emplace_back(object, core::SectorSize);
+    else if(dynamic_cast<const objects::TallBlock*>(object) != nullptr)
+      result.emplace_back(object, core::SectorSize * 2);
+  }
+  return result;
+}
+
+void ObjectManager::onRoomChanged(objects::Object& object, const loader::file::Room* oldRoom)
+{
+  if(oldRoom == object.m_state.position.room)
+    return;
+
+  // objects setting their room during construction are indexed when they are registered
+  if(removeFromRoomIndex(object, oldRoom))
+    addToRoomIndex(object);
 }
 
 void ObjectManager::eraseParticle(const std::shared_ptr<Particle>& particle)
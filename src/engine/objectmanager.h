@@ -1,10 +1,13 @@
 #pragma once
+#include "core/vec.h"
 #include "items_tr1.h"
+#include "objecttable.h"
 
 #include <boost/throw_exception.hpp>
 #include <gsl-lite.hpp>
-#include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace serialization
@@ -16,7 +19,8 @@ class Serializer;
 namespace loader::file
 {
 struct Item;
-}
+struct Room;
+} // namespace loader::file
 
 namespace engine
 {
@@ -29,16 +33,23 @@ class LaraObject;
 class Particle;
 class World;
 
-using ObjectId = uint16_t;
-
 class ObjectManager
 {
   std::set<objects::Object*> m_scheduledDeletions;
   ObjectId m_objectCounter = 0;
-  std::map<ObjectId, gsl::not_null<std::shared_ptr<objects::Object>>> m_objects;
-  std::set<gsl::not_null<std::shared_ptr<objects::Object>>> m_dynamicObjects;
+  ObjectTable m_objects;
+  //! Objects without an id, e.g. projectiles; not serialized, and removed by swapping with the last element
+  std::vector<gsl::not_null<std::shared_ptr<objects::Object>>> m_dynamicObjects;
+  std::unordered_map<const objects::Object*, size_t> m_dynamicObjectIndices;
   std::vector<gsl::not_null<std::shared_ptr<Particle>>> m_particles;
   std::shared_ptr<objects::LaraObject> m_lara = nullptr;
+  //! Static and dynamic objects per room, kept up to date by objects::Object::setCurrentRoom
+  std::unordered_map<const loader::file::Room*, std::vector<objects::Object*>> m_roomObjects;
+  bool m_precomputePathSearches = true;
+
+  void addToRoomIndex(objects::Object& object);
+  bool removeFromRoomIndex(const objects::Object& object, const loader::file::Room* room);
+  void rebuildRoomIndex();
 
 public:
   auto& getObjects()
@@ -83,10 +94,7 @@ public:
     m_scheduledDeletions.insert(object);
   }
 
-  void registerDynamicObject(const gsl::not_null<std::shared_ptr<objects::Object>>& object)
-  {
-    m_dynamicObjects.emplace(object);
-  }
+  void registerDynamicObject(const gsl::not_null<std::shared_ptr<objects::Object>>& object);
 
   void registerParticle(const gsl::not_null<std::shared_ptr<Particle>>& particle)
   {
@@ -107,6 +115,39 @@ public:
   [[nodiscard]] std::shared_ptr<objects::Object> getObject(ObjectId id) const;
   void update(World& world, bool godMode);
 
+  //! Whether the path searches are expanded in parallel before the objects are updated; this does not change the
+  //! outcome of the update
+  void setPrecomputePathSearches(const bool enabled) noexcept
+  {
+    m_precomputePathSearches = enabled;
+  }
+
+  //! Static and dynamic objects within \p room, in no particular order
+  [[nodiscard]] const std::vector<objects::Object*>& getObjectsInRoom(const loader::file::Room* room) const;
+
+  //! Objects within \p pos' room and its directly adjoining rooms that are less than \p maxDistance away on each axis
+  [[nodiscard]] std::vector<objects::Object*> getObjectsNear(const core::RoomBoundPosition& pos,
+                                                             const core::Length& maxDistance,
+                                                             const std::vector<loader::file::Room>& rooms) const;
+
+  //! \p pos' room and the rooms connected to it through portals whose bounds are less than \p maxDistance away from
+  //! \p pos on each axis
+  [[nodiscard]] static std::vector<const loader::file::Room*>
+    getRoomsWithin(const core::RoomBoundPosition& pos,
+                   const core::Length& maxDistance,
+                   const std::vector<loader::file::Room>& rooms);
+
+  //! Objects with an id within \p rooms that are alive, i.e. creatures and other targets, in id order
+  [[nodiscard]] std::vector<std::shared_ptr<objects::Object>>
+    getCreaturesInRooms(const std::vector<const loader::file::Room*>& rooms) const;
+
+  //! Blocks and tall blocks within \p room, each with the height it occupies on the floor
+  [[nodiscard]] std::vector<std::pair<const objects::Object*, core::Length>>
+    getBlocksInRoom(const loader::file::Room* room) const;
+
+  //! Must be called when an object's room changed, \p oldRoom is the room it was indexed for
+  void onRoomChanged(objects::Object& object, const loader::file::Room* oldRoom);
+
   void serialize(const serialization::Serializer<engine::World>& ser);
 };
 } // namespace engine
\ No newline at end of file
@@ -2,13 +2,9 @@
 
 #include "engine/particle.h"
 #include "engine/raycast.h"
-#include "engine/script/reflection.h"
 #include "engine/world.h"
 #include "laraobject.h"
 
-#include <boost/range/adaptors.hpp>
-#include <pybind11/pybind11.h>
-
 namespace engine::objects
 {
 core::Angle AIAgent::rotateTowardsTarget(core::Angle maxRotationSpeed)
@@ -63,12 +59,16 @@ bool AIAgent::isPositionOutOfReach(const core::TRVec& testPosition,
 
 bool AIAgent::anyMovingEnabledObjectInReach() const
 {
-  for(const auto& object : getWorld().getObjectManager().getObjects() | boost::adaptors::map_values)
+  // only objects updated before this one are considered, like the original id-ordered scan did
+  const auto& objectManager = getWorld().getObjectManager();
+  const auto ownId = objectManager.getObjects().getId(this);
+  for(const auto& object : objectManager.getObjectsNear(m_state.position, m_collisionRadius, getWorld().getRooms()))
   {
-    if(object.get().get() == this)
-      break;
+    const auto id = objectManager.getObjects().getId(object);
+    if(!id.has_value() || (ownId.has_value() && *id >= *ownId))
+      continue;
 
-    if(!object->m_isActive || object.get().get() == &getWorld().getObjectManager().getLara())
+    if(!object->m_isActive || object == &objectManager.getLara())
       continue;
 
     if(object->m_state.triggerState == TriggerState::Active && object->m_state.speed != 0_spd
@@ -422,11 +422,10 @@ bool AIAgent::canShootAtLara(const ai::AiInfo& aiInfo) const
     return false;
   }
 
-  return raycastLineOfSight(m_state.position,
-                            getWorld().getObjectManager().getLara().m_state.position.position
-                              - core::TRVec{0_len, 768_len, 0_len},
-                            getWorld().getObjectManager())
-    .first;
+  return hasLineOfSight(m_state.position,
+                        getWorld().getObjectManager().getLara().m_state.position.position
+                          - core::TRVec{0_len, 768_len, 0_len},
+                        getWorld().getObjectManager());
 }
 
 namespace
@@ -482,11 +481,10 @@ bool AIAgent::tryShootAtLara(ModelObject& object,
 
 void AIAgent::loadObjectInfo(bool withoutGameState)
 {
-  m_collisionRadius
-    = core::Length{pybind11::globals()["getObjectInfo"](m_state.type.get()).cast<script::ObjectInfo>().radius};
+  m_collisionRadius = core::Length{getWorld().getObjectInfo(m_state.type).radius};
 
   if(!withoutGameState)
-    m_state.loadObjectInfo();
+    m_state.loadObjectInfo(getWorld());
 }
 
 void AIAgent::hitLara(const core::Health& strength)
@@ -8,7 +8,9 @@ namespace engine::objects
 {
 void AtlanteanLava::update()
 {
+  const auto oldRoom = m_state.position.room;
   loader::file::findRealFloorSector(m_state.position);
+  getWorld().getObjectManager().onRoomChanged(*this, oldRoom);
   setParent(getNode(), m_state.position.room->node);
   if(m_state.triggerState != TriggerState::Deactivated)
   {
@@ -1,6 +1,7 @@
 #include "dart.h"
 
 #include "engine/particle.h"
+#include "engine/particlepool.h"
 #include "engine/world.h"
 #include "laraobject.h"
 
@@ -27,8 +28,7 @@ void Dart::update()
     getWorld().getObjectManager().getLara().m_state.health -= 50_hp;
     getWorld().getObjectManager().getLara().m_state.is_hit = true;
 
-    auto fx = createBloodSplat(getWorld(), m_state.position, m_state.speed, m_state.rotation.Y);
-    getWorld().getObjectManager().registerParticle(fx);
+    createBloodSplat(getWorld(), m_state.position, m_state.speed, m_state.rotation.Y);
   }
 
   ModelObject::update();
@@ -47,10 +47,6 @@ void Dart::update()
 
   kill();
 
-  const auto particle = std::make_shared<RicochetParticle>(m_state.position, getWorld());
-  setParent(particle, m_state.position.room->node);
-  particle->angle = m_state.rotation;
-  particle->timePerSpriteFrame = 6;
-  getWorld().getObjectManager().registerParticle(particle);
+  getWorld().getParticlePool().emitRicochet(m_state.position, 6);
 }
 } // namespace engine::objects
@@ -32,7 +32,9 @@ void Doppelganger::update()
                                      lara.m_state.position.position.Y,
                                      120 * core::SectorSize - lara.m_state.position.position.Z};
 
+    const auto oldRoom = m_state.position.room;
     const auto sector = findRealFloorSector(twinPos, &m_state.position.room);
+    getWorld().getObjectManager().onRoomChanged(*this, oldRoom);
     setParent(getNode(), m_state.position.room->node);
     m_state.floor = HeightInfo::fromCeiling(sector, twinPos, getWorld().getObjectManager().getObjects()).y;
 
@@ -6,6 +6,7 @@
 #include "engine/engine.h"
 #include "engine/lara/abstractstatehandler.h"
 #include "engine/particle.h"
+#include "engine/particlepool.h"
 #include "engine/player.h"
 #include "engine/presenter.h"
 #include "engine/raycast.h"
@@ -21,8 +22,9 @@
 #include "serialization/serialization.h"
 #include "serialization/unordered_map.h"
 
-#include <boost/range/adaptors.hpp>
+#include <algorithm>
 #include <glm/gtx/norm.hpp>
+#include <set>
 #include <stack>
 
 namespace
@@ -311,9 +313,7 @@ void LaraObject::update()
         surfacePos.position.Y = *waterSurfaceHeight;
         surfacePos.position.Z = m_state.position.position.Z;
 
-        auto particle = std::make_shared<SplashParticle>(surfacePos, getWorld(), false);
-        setParent(particle, surfacePos.room->node);
-        getWorld().getObjectManager().registerParticle(particle);
+        getWorld().getParticlePool().emitSplash(surfacePos, false);
       }
     }
   }
@@ -521,44 +521,15 @@ void LaraObject::testInteractions(CollisionInfo& collisionInfo)
   if(isDead())
     return;
 
-  std::set<gsl::not_null<const loader::file::Room*>> rooms;
-  rooms.insert(m_state.position.room);
-  for(const loader::file::Portal& p : m_state.position.room->portals)
-    rooms.insert(&getWorld().getRooms().at(p.adjoining_room.get()));
-
-  for(const auto& object : getWorld().getObjectManager().getObjects() | boost::adaptors::map_values)
-  {
-    if(rooms.find(object->m_state.position.room) == rooms.end())
-      continue;
-
-    if(!object->m_state.collidable)
-      continue;
-
-    if(object->m_state.triggerState == TriggerState::Invisible)
-      continue;
-
-    const auto d = m_state.position.position - object->m_state.position.position;
-    if(abs(d.X) >= 4 * core::SectorSize || abs(d.Y) >= 4 * core::SectorSize || abs(d.Z) >= 4 * core::SectorSize)
-      continue;
-
-    object->collide(collisionInfo);
-  }
-
-  for(const auto& object : getWorld().getObjectManager().getDynamicObjects())
+  for(const auto& object :
+      getWorld().getObjectManager().getObjectsNear(m_state.position, 4 * core::SectorSize, getWorld().getRooms()))
   {
-    if(rooms.find(object->m_state.position.room) == rooms.end())
-      continue;
-
     if(!object->m_state.collidable)
       continue;
 
     if(object->m_state.triggerState == TriggerState::Invisible)
       continue;
 
-    const auto d = m_state.position.position - object->m_state.position.position;
-    if(abs(d.X) >= 4 * core::SectorSize || abs(d.Y) >= 4 * core::SectorSize || abs(d.Z) >= 4 * core::SectorSize)
-      continue;
-
     object->collide(collisionInfo);
   }
 
@@ -885,7 +856,7 @@ void LaraObject::updateAimingState(const Weapon& weapon)
   auto targetVector = getVectorAngles(enemyChestPos.position - gunPosition.position);
   targetVector.X -= m_state.rotation.X;
   targetVector.Y -= m_state.rotation.Y;
-  if(!raycastLineOfSight(gunPosition, enemyChestPos.position, getWorld().getObjectManager()).first)
+  if(!hasLineOfSight(gunPosition, enemyChestPos.position, getWorld().getObjectManager()))
   {
     rightArm.aiming = false;
     leftArm.aiming = false;
@@ -1012,23 +983,21 @@ void LaraObject::findTarget(const Weapon& weapon)
 {
   core::RoomBoundPosition gunPosition{m_state.position};
   gunPosition.position.Y -= weapons[WeaponId::Shotgun].gunHeight;
-  std::shared_ptr<ModelObject> bestEnemy = nullptr;
-  core::Angle bestYAngle{std::numeric_limits<core::Angle::type>::max()};
-  for(const auto& currentEnemy : getWorld().getObjectManager().getObjects() | boost::adaptors::map_values)
-  {
-    if(currentEnemy->m_state.isDead() || currentEnemy.get() == getWorld().getObjectManager().getLaraPtr())
-      continue;
 
-    const auto modelEnemy = std::dynamic_pointer_cast<ModelObject>(currentEnemy.get());
-    if(modelEnemy == nullptr)
-    {
-      BOOST_LOG_TRIVIAL(warning) << "Ignoring non-model object " << currentEnemy->getNode()->getName();
-      continue;
-    }
-
-    if(!modelEnemy->getNode()->isVisible())
+  struct Candidate
+  {
+    std::shared_ptr<ModelObject> enemy;
+    core::TRVec position;
+    core::Angle absYAngle;
+  };
+  std::vector<Candidate> candidates;
+  const auto rooms = ObjectManager::getRoomsWithin(gunPosition, weapon.targetDist, getWorld().getRooms());
+  for(const auto& currentEnemy : getWorld().getObjectManager().getCreaturesInRooms(rooms))
+  {
+    if(currentEnemy == getWorld().getObjectManager().getLaraPtr())
       continue;
 
+    // cheap distance checks first, most objects are out of range
     const auto d = currentEnemy->m_state.position.position - gunPosition.position;
     if(abs(d.X) > weapon.targetDist)
       continue;
@@ -1042,11 +1011,17 @@ void LaraObject::findTarget(const Weapon& weapon)
     if(util::square(d.X) + util::square(d.Y) + util::square(d.Z) >= util::square(weapon.targetDist))
       continue;
 
-    auto enemyPos = getUpperThirdBBoxCtr(*std::dynamic_pointer_cast<const ModelObject>(currentEnemy.get()));
-    const auto canShoot = raycastLineOfSight(gunPosition, enemyPos.position, getWorld().getObjectManager()).first;
-    if(!canShoot)
+    const auto modelEnemy = std::dynamic_pointer_cast<ModelObject>(currentEnemy);
+    if(modelEnemy == nullptr)
+    {
+      BOOST_LOG_TRIVIAL(warning) << "Ignoring non-model object " << currentEnemy->getNode()->getName();
       continue;
+    }
 
+    if(!modelEnemy->getNode()->isVisible())
+      continue;
+
+    auto enemyPos = getUpperThirdBBoxCtr(*std::dynamic_pointer_cast<const ModelObject>(currentEnemy.get()));
     auto aimAngle = getVectorAngles(enemyPos.position - gunPosition.position);
     aimAngle.X -= m_torsoRotation.X + m_state.rotation.X;
     aimAngle.Y -= m_torsoRotation.Y + m_state.rotation.Y;
@@ -1054,14 +1029,22 @@ void LaraObject::findTarget(const Weapon& weapon)
        || aimAngle.X < weapon.lockAngles.x.min || aimAngle.X > weapon.lockAngles.x.max)
       continue;
 
-    const auto absY = abs(aimAngle.Y);
-    if(absY >= bestYAngle)
-      continue;
-
-    bestYAngle = absY;
-    bestEnemy = modelEnemy;
+    candidates.emplace_back(Candidate{modelEnemy, enemyPos.position, abs(aimAngle.Y)});
   }
-  target = bestEnemy;
+
+  // the target is the first visible candidate with the smallest yaw difference; line of sight is the expensive part,
+  // so it's only tested until the first visible candidate is found
+  std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+    return a.absYAngle < b.absYAngle;
+  });
+  std::vector<core::TRVec> goals;
+  goals.reserve(candidates.size());
+  std::transform(candidates.begin(), candidates.end(), std::back_inserter(goals), [](const Candidate& candidate) {
+    return candidate.position;
+  });
+
+  const auto visible = findFirstLineOfSight(gunPosition, goals, getWorld().getObjectManager());
+  target = visible.has_value() ? candidates[*visible].enemy : nullptr;
   updateAimingState(weapon);
 }
 
@@ -1699,11 +1682,10 @@ void LaraObject::hitTarget(ModelObject& object, const core::TRVec& hitPos, const
   }
   object.m_state.is_hit = true;
   object.m_state.health -= damage;
-  auto fx = createBloodSplat(getWorld(),
-                             core::RoomBoundPosition{object.m_state.position.room, hitPos},
-                             object.m_state.speed,
-                             object.m_state.rotation.Y);
-  getWorld().getObjectManager().registerParticle(fx);
+  createBloodSplat(getWorld(),
+                   core::RoomBoundPosition{object.m_state.position.room, hitPos},
+                   object.m_state.speed,
+                   object.m_state.rotation.Y);
   if(object.m_state.isDead())
     return;
 
@@ -2224,7 +2206,11 @@ void LaraObject::serialize(const serialization::Serializer<World>& ser)
   });
 
   if(ser.loading)
-    forceSourcePosition = nullptr;
+  {
+    // the force source is not serialized, so the stumbling can't be continued
+    forceSourcePosition.reset();
+    explosionStumblingDuration = 0_frame;
+  }
 }
 
 LaraObject::LaraObject(const gsl::not_null<World*>& world,
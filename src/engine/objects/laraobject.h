@@ -286,10 +286,11 @@ public:
   std::optional<core::Axis> hit_direction;
   core::Frame hit_frame = 0_frame;
   core::Frame explosionStumblingDuration = 0_frame;
-  const core::TRVec* forceSourcePosition = nullptr;
+  std::optional<core::TRVec> forceSourcePosition{};
 
   void updateExplosionStumbling()
   {
+    Expects(forceSourcePosition.has_value());
     const auto rot = angleFromAtan(forceSourcePosition->X - m_state.position.position.X,
                                    forceSourcePosition->Z - m_state.position.position.Z)
                      - 180_deg;
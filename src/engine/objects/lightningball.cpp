@@ -148,7 +148,9 @@ void LightningBall::update()
   {
     // we don't have poles, so just shoot downwards
     m_mainBoltEnd = core::TRVec{};
+    const auto oldRoom = m_state.position.room;
     const auto sector = loader::file::findRealFloorSector(m_state.position);
+    getWorld().getObjectManager().onRoomChanged(*this, oldRoom);
     m_mainBoltEnd.Y
       = -HeightInfo::fromFloor(sector, m_state.position.position, getWorld().getObjectManager().getObjects()).y;
     m_mainBoltEnd.Y -= m_state.position.position.Y;
@@ -292,6 +292,25 @@ gsl::not_null<std::shared_ptr<Particle>>
                               World& world, const core::RoomBoundPosition&, const core::Speed&, const core::Angle&))
 {
   BOOST_ASSERT(generate != nullptr);
+
+  auto particle = generate(getWorld(), getBonePosition(localPosition, boneIndex), m_state.speed, m_state.rotation.Y);
+  getWorld().getObjectManager().registerParticle(particle);
+
+  return particle;
+}
+
+void ModelObject::emitParticle(const core::TRVec& localPosition,
+                               const size_t boneIndex,
+                               void (*generate)(
+                                 World& world, const core::RoomBoundPosition&, const core::Speed&, const core::Angle&))
+{
+  BOOST_ASSERT(generate != nullptr);
+
+  generate(getWorld(), getBonePosition(localPosition, boneIndex), m_state.speed, m_state.rotation.Y);
+}
+
+core::RoomBoundPosition ModelObject::getBonePosition(const core::TRVec& localPosition, const size_t boneIndex) const
+{
   BOOST_ASSERT(boneIndex < m_skeleton->getBoneCount());
 
   const auto boneSpheres
@@ -300,10 +319,7 @@ gsl::not_null<std::shared_ptr<Particle>>
 
   auto roomPos = m_state.position;
   roomPos.position = core::TRVec{glm::vec3{translate(boneSpheres.at(boneIndex).m, localPosition.toRenderSystem())[3]}};
-  auto particle = generate(getWorld(), roomPos, m_state.speed, m_state.rotation.Y);
-  getWorld().getObjectManager().registerParticle(particle);
-
-  return particle;
+  return roomPos;
 }
 
 void ModelObject::serialize(const serialization::Serializer<World>& ser)
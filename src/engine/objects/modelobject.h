@@ -89,9 +89,20 @@ public:
                                                                       const core::Speed& speed,
                                                                       const core::Angle& angle));
 
+  //! Overload for effects that are not represented by a Particle instance, e.g. the ones managed by the ParticlePool
+  void emitParticle(const core::TRVec& localPosition,
+                    size_t boneIndex,
+                    void (*generate)(World& world,
+                                     const core::RoomBoundPosition& pos,
+                                     const core::Speed& speed,
+                                     const core::Angle& angle));
+
   void serialize(const serialization::Serializer<World>& ser) override;
 
   static std::shared_ptr<ModelObject> create(serialization::Serializer<World>& ser);
+
+private:
+  [[nodiscard]] core::RoomBoundPosition getBonePosition(const core::TRVec& localPosition, size_t boneIndex) const;
 };
 
 class NullRenderModelObject : public ModelObject
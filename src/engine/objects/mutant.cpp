@@ -561,7 +561,9 @@ void TorsoBoss::update()
   {
     playSoundEffect(TR1SoundEffect::Mummy);
     shatterModel(*this, ~0u, 250_len);
+    const auto oldRoom = m_state.position.room;
     const auto sector = loader::file::findRealFloorSector(m_state.position);
+    getWorld().getObjectManager().onRoomChanged(*this, oldRoom);
     getWorld().handleCommandSequence(
       HeightInfo::fromFloor(sector, m_state.position.position, getWorld().getObjectManager().getObjects())
         .lastCommandSequenceOrDeath,
@@ -137,7 +137,8 @@ void MutantEgg::update()
 
       if(m_childObject != nullptr)
       {
-        m_childObject->m_state.position = m_state.position;
+        const auto oldRoom = std::exchange(m_childObject->m_state.position, m_state.position).room;
+        getWorld().getObjectManager().onRoomChanged(*m_childObject, oldRoom);
         m_childObject->m_state.rotation.Y = m_state.rotation.Y;
         addChild(m_state.position.room->node, m_childObject->getNode());
 
@@ -1,7 +1,7 @@
 #include "object.h"
 
 #include "engine/audioengine.h"
-#include "engine/particle.h"
+#include "engine/particlepool.h"
 #include "engine/presenter.h"
 #include "engine/script/reflection.h"
 #include "engine/world.h"
@@ -37,7 +37,7 @@ Object::Object(const gsl::not_null<World*>& world,
 
   BOOST_ASSERT(room->isInnerPositionXZ(item.position));
 
-  m_state.loadObjectInfo();
+  m_state.loadObjectInfo(*world);
 
   m_state.rotation.Y = item.rotation;
   m_state.shade = item.shade;
@@ -70,7 +70,8 @@ void Object::setCurrentRoom(const gsl::not_null<const loader::file::Room*>& newR
 
   setParent(getNode(), newRoom->node);
 
-  m_state.position.room = newRoom;
+  const auto oldRoom = std::exchange(m_state.position.room, newRoom);
+  getWorld().getObjectManager().onRoomChanged(*this, oldRoom);
   applyTransform();
 }
 
@@ -148,10 +149,8 @@ bool InteractionLimits::canInteract(const ObjectState& objectState, const Object
 
 void Object::playShotMissed(const core::RoomBoundPosition& pos)
 {
-  const auto particle = std::make_shared<RicochetParticle>(pos, getWorld());
-  setParent(particle, m_state.position.room->node);
-  getWorld().getObjectManager().registerParticle(particle);
-  getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, particle.get());
+  getWorld().getParticlePool().emitRicochet(pos);
+  getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, pos.position.toRenderSystem());
 }
 
 std::optional<core::Length> Object::getWaterSurfaceHeight() const
@@ -163,7 +162,13 @@ void Object::updateLighting()
 {
   auto tmp = m_state.position;
   tmp.position += getBoundingBox().getCenter();
-  m_lighting.updateDynamic(m_state.shade, tmp, m_world->getRooms());
+  if(m_world->getPresenter().isClusteredLightingEnabled())
+    m_lighting.updateClustered(m_state.shade, tmp);
+  else
+    m_lighting.updateDynamic(m_state.shade,
+                             tmp,
+                             m_world->getRoomLightNeighbourhoods().getLights(),
+                             m_world->getNeighbourhoodLights(*tmp.room));
 }
 
 bool Object::alignTransformClamped(const core::TRVec& targetPos,
@@ -1,6 +1,6 @@
 #include "objectstate.h"
 
-#include "engine/script/reflection.h"
+#include "engine/world.h"
 #include "laraobject.h"
 #include "serialization/animation_ptr.h"
 #include "serialization/bitset.h"
@@ -8,8 +8,6 @@
 #include "serialization/quantity.h"
 #include "serialization/serialization.h"
 
-#include <pybind11/pybind11.h>
-
 namespace engine::objects
 {
 ObjectState::~ObjectState() = default;
@@ -122,10 +120,9 @@ glm::vec3 ObjectState::getPosition() const
   return position.position.toRenderSystem();
 }
 
-void ObjectState::loadObjectInfo()
+void ObjectState::loadObjectInfo(const World& world)
 {
-  pybind11::object getObjectInfo = pybind11::globals()["getObjectInfo"];
-  health = core::Health{getObjectInfo(type.get()).cast<script::ObjectInfo>().hit_points};
+  health = core::Health{world.getObjectInfo(type).hit_points};
 }
 
 void ObjectState::serialize(const serialization::Serializer<World>& ser)
@@ -132,7 +132,7 @@ public:
     return position.room->getSectorByAbsolutePosition(position.position);
   }
 
-  void loadObjectInfo();
+  void loadObjectInfo(const World& world);
 
   bool isDead() const
   {
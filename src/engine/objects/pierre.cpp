@@ -147,10 +147,9 @@ void Pierre::update()
   getSkeleton()->patchBone(7, core::TRRotation{0_deg, m_state.creatureInfo->head_rotation, 0_deg}.toMatrix());
   if(m_fleeTime != 0_frame)
   {
-    if(raycastLineOfSight(getWorld().getCameraController().getTRPosition(),
-                          m_state.position.position - core::TRVec{0_len, core::SectorSize, 0_len},
-                          getWorld().getObjectManager())
-         .first)
+    if(hasLineOfSight(getWorld().getCameraController().getTRPosition(),
+                      m_state.position.position - core::TRVec{0_len, core::SectorSize, 0_len},
+                      getWorld().getObjectManager()))
     {
       m_fleeTime = 1_frame;
     }
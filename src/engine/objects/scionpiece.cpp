@@ -2,7 +2,7 @@
 
 #include "engine/audioengine.h"
 #include "engine/engine.h"
-#include "engine/particle.h"
+#include "engine/particlepool.h"
 #include "engine/player.h"
 #include "engine/presenter.h"
 #include "engine/world.h"
@@ -80,11 +80,8 @@ void ScionPiece3::update()
   {
     const auto pos = m_state.position.position
                      + core::TRVec{util::rand15s(512_len), util::rand15s(64_len) - 500_len, util::rand15s(512_len)};
-    const auto particle = std::make_shared<ExplosionParticle>(
-      core::RoomBoundPosition{m_state.position.room, pos}, getWorld(), 0_spd, core::TRRotation{0_deg, 0_deg, 0_deg});
-    setParent(particle, m_state.position.room->node);
-    getWorld().getObjectManager().registerParticle(particle);
-    getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get());
+    getWorld().getParticlePool().emitExplosion(core::RoomBoundPosition{m_state.position.room, pos});
+    getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, pos.toRenderSystem());
 
     getWorld().getCameraController().setBounce(-200_len);
   }
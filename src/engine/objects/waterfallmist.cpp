@@ -1,6 +1,6 @@
 #include "waterfallmist.h"
 
-#include "engine/particle.h"
+#include "engine/particlepool.h"
 #include "engine/world.h"
 #include "laraobject.h"
 
@@ -15,8 +15,6 @@ void WaterfallMist::update()
   if(abs(d.X) > 20 * core::SectorSize || abs(d.Y) > 20 * core::SectorSize || abs(d.Z) > 20 * core::SectorSize)
     return;
 
-  auto particle = std::make_shared<SplashParticle>(m_state.position, getWorld(), true);
-  setParent(particle, m_state.position.room->node);
-  getWorld().getObjectManager().registerParticle(particle);
+  getWorld().getParticlePool().emitSplash(m_state.position, true);
 }
 } // namespace engine::objects
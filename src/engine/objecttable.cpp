@@ -0,0 +1,60 @@
+#include "objecttable.h"
+
+#include <boost/throw_exception.hpp>
+#include <stdexcept>
+
+namespace engine
+{
+void ObjectTable::emplace(const ObjectId id, const gsl::not_null<std::shared_ptr<objects::Object>>& object)
+{
+  if(id >= m_objects.size())
+    m_objects.resize(size_t{id} + 1);
+
+  Expects(m_objects[id] == nullptr);
+  m_objects[id] = object;
+  m_objectIds.emplace(object.get().get(), id);
+}
+
+gsl::not_null<std::shared_ptr<objects::Object>> ObjectTable::at(const ObjectId id) const
+{
+  auto object = get(id);
+  if(object == nullptr)
+    BOOST_THROW_EXCEPTION(std::out_of_range("Invalid object id"));
+
+  return object;
+}
+
+std::shared_ptr<objects::Object> ObjectTable::get(const ObjectId id) const
+{
+  if(id >= m_objects.size())
+    return nullptr;
+
+  return m_objects[id];
+}
+
+std::optional<ObjectId> ObjectTable::getId(const objects::Object* object) const
+{
+  const auto it = m_objectIds.find(object);
+  if(it == m_objectIds.end())
+    return std::nullopt;
+
+  return it->second;
+}
+
+bool ObjectTable::erase(const objects::Object* object)
+{
+  const auto it = m_objectIds.find(object);
+  if(it == m_objectIds.end())
+    return false;
+
+  m_objects[it->second] = nullptr;
+  m_objectIds.erase(it);
+  return true;
+}
+
+void ObjectTable::clear()
+{
+  m_objects.clear();
+  m_objectIds.clear();
+}
+} // namespace engine
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <gsl-lite.hpp>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace engine
+{
+namespace objects
+{
+class Object;
+}
+
+using ObjectId = uint16_t;
+
+//! The objects of a level, indexed by their ObjectId.
+//!
+//! Ids are handed out in ascending order and are never reused, so the objects are stored in a vector indexed by their
+//! id. Lookups and removals are O(1), and iteration is contiguous and visits the objects in id order, skipping removed
+//! ones. Objects added while iterating are visited by the ongoing iteration, too.
+class ObjectTable final
+{
+public:
+  class Iterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::shared_ptr<objects::Object>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    Iterator(const ObjectTable& table, const size_t index)
+        : m_table{&table}
+        , m_index{index}
+    {
+      skipRemoved();
+    }
+
+    [[nodiscard]] reference operator*() const
+    {
+      return m_table->m_objects[m_index];
+    }
+
+    [[nodiscard]] pointer operator->() const
+    {
+      return &m_table->m_objects[m_index];
+    }
+
+    [[nodiscard]] ObjectId id() const
+    {
+      return gsl::narrow_cast<ObjectId>(m_index);
+    }
+
+    Iterator& operator++()
+    {
+      ++m_index;
+      skipRemoved();
+      return *this;
+    }
+
+    [[nodiscard]] bool operator==(const Iterator& rhs) const
+    {
+      return m_table == rhs.m_table && isEnd() == rhs.isEnd() && (isEnd() || m_index == rhs.m_index);
+    }
+
+    [[nodiscard]] bool operator!=(const Iterator& rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+  private:
+    const ObjectTable* m_table;
+    size_t m_index;
+
+    // the end is re-evaluated on every comparison, so that objects added during the iteration are visited
+    [[nodiscard]] bool isEnd() const
+    {
+      return m_index >= m_table->m_objects.size();
+    }
+
+    void skipRemoved()
+    {
+      while(!isEnd() && m_table->m_objects[m_index] == nullptr)
+        ++m_index;
+    }
+  };
+
+  [[nodiscard]] Iterator begin() const
+  {
+    return Iterator{*this, 0};
+  }
+
+  [[nodiscard]] Iterator end() const
+  {
+    return Iterator{*this, m_objects.size()};
+  }
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return m_objectIds.size();
+  }
+
+  void emplace(ObjectId id, const gsl::not_null<std::shared_ptr<objects::Object>>& object);
+
+  //! Throws std::out_of_range if there is no object with the given id
+  [[nodiscard]] gsl::not_null<std::shared_ptr<objects::Object>> at(ObjectId id) const;
+
+  //! Returns nullptr if there is no object with the given id
+  [[nodiscard]] std::shared_ptr<objects::Object> get(ObjectId id) const;
+
+  [[nodiscard]] std::optional<ObjectId> getId(const objects::Object* object) const;
+
+  //! Returns false if the object is not contained in this table
+  bool erase(const objects::Object* object);
+
+  void clear();
+
+private:
+  //! Indexed by id, removed objects are nullptr
+  std::vector<std::shared_ptr<objects::Object>> m_objects;
+  std::unordered_map<const objects::Object*, ObjectId> m_objectIds;
+};
+} // namespace engine
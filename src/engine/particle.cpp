@@ -3,6 +3,7 @@
 #include "audioengine.h"
 #include "loader/file/rendermeshdata.h"
 #include "objects/laraobject.h"
+#include "particlepool.h"
 #include "presenter.h"
 #include "render/scene/materialmanager.h"
 #include "render/scene/mesh.h"
@@ -108,58 +109,6 @@ Particle::Particle(const std::string& id,
   }
 }
 
-bool BloodSplatterParticle::update(World& world)
-{
-  pos.position += util::pitch(speed * 1_frame, angle.Y);
-  ++timePerSpriteFrame;
-  if(timePerSpriteFrame != 4)
-    return true;
-
-  timePerSpriteFrame = 0;
-  nextFrame();
-  if(negSpriteFrameId <= world.findSpriteSequenceForType(object_number)->length)
-    return false;
-
-  applyTransform();
-  return true;
-}
-
-bool SplashParticle::update(World& world)
-{
-  nextFrame();
-
-  if(negSpriteFrameId <= world.findSpriteSequenceForType(object_number)->length)
-  {
-    return false;
-  }
-
-  pos.position += util::pitch(speed * 1_frame, angle.Y);
-
-  applyTransform();
-  return true;
-}
-
-bool BubbleParticle::update(World& world)
-{
-  angle.X += 13_deg;
-  angle.Y += 9_deg;
-  pos.position += util::pitch(11_len, angle.Y, -speed * 1_frame);
-  auto sector = findRealFloorSector(pos.position, &pos.room);
-  if(!pos.room->isWaterRoom())
-  {
-    return false;
-  }
-
-  if(const auto ceiling = HeightInfo::fromCeiling(sector, pos.position, world.getObjectManager().getObjects()).y;
-     ceiling == -core::HeightLimit || pos.position.Y <= ceiling)
-  {
-    return false;
-  }
-
-  applyTransform();
-  return true;
-}
-
 FlameParticle::FlameParticle(const core::RoomBoundPosition& pos, World& world, bool randomize)
     : Particle{"flame", TR1ItemId::Flame, pos, world}
 {
@@ -288,7 +237,7 @@ bool MeshShrapnelParticle::update(World& world)
     world.getObjectManager().getLara().m_state.health -= m_damageRadius * 1_hp / 1_len;
     explode = true;
 
-    world.getObjectManager().getLara().forceSourcePosition = &pos.position;
+    world.getObjectManager().getLara().forceSourcePosition = pos.position;
     world.getObjectManager().getLara().explosionStumblingDuration = 5_frame;
   }
 
@@ -298,10 +247,8 @@ bool MeshShrapnelParticle::update(World& world)
   if(!explode)
     return true;
 
-  const auto particle = std::make_shared<ExplosionParticle>(pos, world, fall_speed, angle);
-  setParent(particle, pos.room->node);
-  world.getObjectManager().registerParticle(particle);
-  world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get());
+  world.getParticlePool().emitExplosion(pos);
+  world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, pos.position.toRenderSystem());
   return false;
 }
 
@@ -323,20 +270,15 @@ bool MutantBulletParticle::update(World& world)
   if(HeightInfo::fromFloor(sector, pos.position, world.getObjectManager().getObjects()).y <= pos.position.Y
      || HeightInfo::fromCeiling(sector, pos.position, world.getObjectManager().getObjects()).y >= pos.position.Y)
   {
-    auto particle = std::make_shared<RicochetParticle>(pos, world);
-    particle->timePerSpriteFrame = 6;
-    setParent(particle, pos.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, particle.get());
+    world.getParticlePool().emitRicochet(pos, 6);
+    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, pos.position.toRenderSystem());
     return false;
   }
   else if(world.getObjectManager().getLara().isNear(*this, 200_len))
   {
     world.getObjectManager().getLara().m_state.health -= 30_hp;
-    auto particle = std::make_shared<BloodSplatterParticle>(pos, speed, angle.Y, world);
-    setParent(particle, pos.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::BulletHitsLara, particle.get());
+    world.getParticlePool().emitBloodSplat(pos, speed, angle.Y);
+    world.getAudioEngine().playSoundEffect(TR1SoundEffect::BulletHitsLara, pos.position.toRenderSystem());
     world.getObjectManager().getLara().m_state.is_hit = true;
     angle.Y = world.getObjectManager().getLara().m_state.rotation.Y;
     speed = world.getObjectManager().getLara().m_state.speed;
@@ -357,10 +299,8 @@ bool MutantGrenadeParticle::update(World& world)
   if(HeightInfo::fromFloor(sector, pos.position, world.getObjectManager().getObjects()).y <= pos.position.Y
      || HeightInfo::fromCeiling(sector, pos.position, world.getObjectManager().getObjects()).y >= pos.position.Y)
   {
-    auto particle = std::make_shared<ExplosionParticle>(pos, world, fall_speed, angle);
-    setParent(particle, pos.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get());
+    world.getParticlePool().emitExplosion(pos);
+    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, pos.position.toRenderSystem());
 
     const auto dd = pos.position - world.getObjectManager().getLara().m_state.position.position;
     const auto d = util::square(dd.X) + util::square(dd.Y) + util::square(dd.Z);
@@ -376,15 +316,13 @@ bool MutantGrenadeParticle::update(World& world)
   else if(world.getObjectManager().getLara().isNear(*this, 200_len))
   {
     world.getObjectManager().getLara().m_state.health -= 100_hp;
-    auto particle = std::make_shared<ExplosionParticle>(pos, world, fall_speed, angle);
-    setParent(particle, pos.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get());
+    world.getParticlePool().emitExplosion(pos);
+    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, pos.position.toRenderSystem());
 
     if(!world.getObjectManager().getLara().isDead())
     {
       world.getObjectManager().getLara().playSoundEffect(TR1SoundEffect::LaraHurt);
-      world.getObjectManager().getLara().forceSourcePosition = &particle->pos.position;
+      world.getObjectManager().getLara().forceSourcePosition = pos.position;
       world.getObjectManager().getLara().explosionStumblingDuration = 5_frame;
     }
 
@@ -421,4 +359,12 @@ bool LavaParticle::update(World& world)
 
   return true;
 }
+
+void createBloodSplat(World& world,
+                      const core::RoomBoundPosition& pos,
+                      const core::Speed& speed,
+                      const core::Angle& angle)
+{
+  world.getParticlePool().emitBloodSplat(pos, speed, angle);
+}
 } // namespace engine
@@ -89,105 +89,6 @@ public:
   glm::vec3 getPosition() const final;
 };
 
-class BloodSplatterParticle final : public Particle
-{
-public:
-  explicit BloodSplatterParticle(const core::RoomBoundPosition& pos,
-                                 const core::Speed& speed_,
-                                 const core::Angle& angle_,
-                                 World& world)
-      : Particle{"bloodsplat", TR1ItemId::Blood, pos, world}
-  {
-    speed = speed_;
-    angle.Y = angle_;
-  }
-
-  bool update(World& world) override;
-};
-
-class SplashParticle final : public Particle
-{
-public:
-  explicit SplashParticle(const core::RoomBoundPosition& pos, World& world, const bool waterfall)
-      : Particle{"splash", TR1ItemId::Splash, pos, world}
-  {
-    if(!waterfall)
-    {
-      speed = util::rand15(128_spd);
-      angle.Y = core::auToAngle(2 * util::rand15s());
-    }
-    else
-    {
-      this->pos.position.X += util::rand15s(core::SectorSize);
-      this->pos.position.Z += util::rand15s(core::SectorSize);
-    }
-  }
-
-  bool update(World& world) override;
-};
-
-class RicochetParticle final : public Particle
-{
-public:
-  explicit RicochetParticle(const core::RoomBoundPosition& pos, World& world)
-      : Particle{"ricochet", TR1ItemId::Ricochet, pos, world}
-  {
-    timePerSpriteFrame = 4;
-
-    const int n = util::rand15(3);
-    for(int i = 0; i < n; ++i)
-      nextFrame();
-  }
-
-  bool update(World& /*world*/) override
-  {
-    --timePerSpriteFrame;
-    if(timePerSpriteFrame == 0)
-    {
-      return false;
-    }
-
-    applyTransform();
-    return true;
-  }
-};
-
-class BubbleParticle final : public Particle
-{
-public:
-  explicit BubbleParticle(const core::RoomBoundPosition& pos, World& world)
-      : Particle{"bubble", TR1ItemId::Bubbles, pos, world, nullptr, 0.7f}
-  {
-    speed = 10_spd + util::rand15(6_spd);
-
-    const int n = util::rand15(3);
-    for(int i = 0; i < n; ++i)
-      nextFrame();
-  }
-
-  bool update(World& world) override;
-};
-
-class SparkleParticle final : public Particle
-{
-public:
-  explicit SparkleParticle(const core::RoomBoundPosition& pos, World& world)
-      : Particle{"sparkles", TR1ItemId::Sparkles, pos, world}
-  {
-  }
-
-  bool update(World& /*world*/) override
-  {
-    ++timePerSpriteFrame;
-    if(timePerSpriteFrame != 1)
-      return true;
-
-    --negSpriteFrameId;
-    timePerSpriteFrame = 0;
-    return gsl::narrow<size_t>(-negSpriteFrameId) < getLength();
-  }
-};
-
 class GunflareParticle final : public Particle
 {
 public:
@@ -218,36 +119,6 @@ public:
   bool update(World& world) override;
 };
 
-class ExplosionParticle final : public Particle
-{
-public:
-  explicit ExplosionParticle(const core::RoomBoundPosition& pos,
-                             World& world,
-                             const core::Speed& fallSpeed,
-                             const core::TRRotation& angle)
-      : Particle{"explosion", TR1ItemId::Explosion, pos, world}
-  {
-    fall_speed = fallSpeed;
-    this->angle = angle;
-  }
-
-  bool update(World& /*world*/) override
-  {
-    ++timePerSpriteFrame;
-    if(timePerSpriteFrame == 2)
-    {
-      timePerSpriteFrame = 0;
-      --negSpriteFrameId;
-      if(negSpriteFrameId <= 0 || static_cast<size_t>(negSpriteFrameId) <= getLength())
-      {
-        return false;
-      }
-    }
-
-    return true;
-  }
-};
-
 class MeshShrapnelParticle final : public Particle
 {
 public:
@@ -332,11 +203,8 @@ public:
   bool update(World& world) override;
 };
 
-inline gsl::not_null<std::shared_ptr<Particle>>
-  createBloodSplat(World& world, const core::RoomBoundPosition& pos, const core::Speed& speed, const core::Angle& angle)
-{
-  auto particle = std::make_shared<BloodSplatterParticle>(pos, speed, angle, world);
-  setParent(particle, pos.room->node);
-  return particle;
-}
+void createBloodSplat(World& world,
+                      const core::RoomBoundPosition& pos,
+                      const core::Speed& speed,
+                      const core::Angle& angle);
 } // namespace engine
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "core/angle.h"
+#include "core/units.h"
+#include "core/vec.h"
+
+#include <boost/assert.hpp>
+#include <glm/glm.hpp>
+#include <gsl-lite.hpp>
+#include <vector>
+
+namespace loader::file
+{
+struct Room;
+}
+
+namespace engine
+{
+//! The state of all effects of one type in ParticlePool, stored as a structure of arrays; the order is not stable.
+//! Storage for InitialCapacity effects is allocated up front, so it only grows in unusually busy scenes.
+class ParticleBuffer final
+{
+public:
+  static constexpr size_t InitialCapacity = 100;
+
+  std::vector<core::TRVec> positions;
+  std::vector<gsl::not_null<const loader::file::Room*>> rooms;
+  std::vector<core::Angle> angles;
+  std::vector<core::Speed> speeds;
+  std::vector<int16_t> timers;
+  std::vector<int16_t> negSpriteFrameIds;
+  std::vector<uint16_t> spriteFrames;
+
+  ParticleBuffer()
+  {
+    positions.reserve(InitialCapacity);
+    rooms.reserve(InitialCapacity);
+    angles.reserve(InitialCapacity);
+    speeds.reserve(InitialCapacity);
+    timers.reserve(InitialCapacity);
+    negSpriteFrameIds.reserve(InitialCapacity);
+    spriteFrames.reserve(InitialCapacity);
+  }
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return positions.size();
+  }
+
+  //! Returns the index of the new effect
+  size_t add(const core::RoomBoundPosition& pos)
+  {
+    positions.emplace_back(pos.position);
+    rooms.emplace_back(pos.room);
+    angles.emplace_back(0_deg);
+    speeds.emplace_back(0_spd);
+    timers.emplace_back(0);
+    negSpriteFrameIds.emplace_back(0);
+    spriteFrames.emplace_back(0);
+    return size() - 1;
+  }
+
+  //! Replaces the effect with the last one
+  void remove(const size_t i)
+  {
+    BOOST_ASSERT(i < size());
+
+    const auto last = size() - 1;
+    positions[i] = positions[last];
+    rooms[i] = rooms[last];
+    angles[i] = angles[last];
+    speeds[i] = speeds[last];
+    timers[i] = timers[last];
+    negSpriteFrameIds[i] = negSpriteFrameIds[last];
+    spriteFrames[i] = spriteFrames[last];
+
+    positions.pop_back();
+    rooms.pop_back();
+    angles.pop_back();
+    speeds.pop_back();
+    timers.pop_back();
+    negSpriteFrameIds.pop_back();
+    spriteFrames.pop_back();
+  }
+
+  void clear()
+  {
+    positions.clear();
+    rooms.clear();
+    angles.clear();
+    speeds.clear();
+    timers.clear();
+    negSpriteFrameIds.clear();
+    spriteFrames.clear();
+  }
+
+  //! Appends an instance for each effect in a room accepted by @a isVisible; xyz is the position in render space, w
+  //! the sprite frame, matching b_spriteInstances in particle.vert
+  template<typename IsVisible>
+  void collectInstances(const IsVisible& isVisible, std::vector<glm::vec4>& instances) const
+  {
+    for(size_t i = 0; i < size(); ++i)
+    {
+      if(!isVisible(*rooms[i]))
+        continue;
+
+      instances.emplace_back(positions[i].toRenderSystem(), static_cast<float>(spriteFrames[i]));
+    }
+  }
+};
+} // namespace engine
@@ -0,0 +1,379 @@
+#include "particlepool.h"
+
+#include "heightinfo.h"
+#include "items_tr1.h"
+#include "lighting.h"
+#include "loader/file/datatypes.h"
+#include "presenter.h"
+#include "render/scene/material.h"
+#include "render/scene/materialmanager.h"
+#include "render/scene/mesh.h"
+#include "render/scene/names.h"
+#include "render/scene/node.h"
+#include "render/scene/renderer.h"
+#include "render/scene/scene.h"
+#include "render/scene/vertexpacking.h"
+#include "util/helpers.h"
+#include "world.h"
+
+#include <gl/vertexarray.h>
+#include <gl/vertexbuffer.h>
+
+namespace engine
+{
+namespace
+{
+struct TypeInfo
+{
+  TR1ItemId sprite;
+  float scale;
+};
+
+constexpr std::array<TypeInfo, ParticlePool::TypeCount> Types{TypeInfo{TR1ItemId::Blood, 1.0f},
+                                                               TypeInfo{TR1ItemId::Splash, 1.0f},
+                                                               TypeInfo{TR1ItemId::Ricochet, 1.0f},
+                                                               TypeInfo{TR1ItemId::Bubbles, 0.7f},
+                                                               TypeInfo{TR1ItemId::Sparkles, 1.0f},
+                                                               TypeInfo{TR1ItemId::Explosion, 1.0f}};
+
+constexpr size_t toIndex(const ParticlePool::Type type)
+{
+  return static_cast<size_t>(type);
+}
+
+gsl::not_null<std::shared_ptr<render::scene::Mesh>>
+  createQuadMesh(const gsl::not_null<std::shared_ptr<render::scene::Material>>& material)
+{
+  // the actual sprite geometry is looked up per instance, the vertices only define the corners
+  struct QuadVertex
+  {
+    glm::vec3 pos;
+    glm::vec2 uv;
+    glm::u8vec4 color{render::scene::packVertexColor(glm::vec4{1.0f})};
+    gl::Int2101010Rev normal{render::scene::packVertexNormal(glm::vec3{0, 0, 1})};
+  };
+
+  const std::array<QuadVertex, 4> vertices{QuadVertex{{0, 0, 0}, {0, 0}},
+                                           QuadVertex{{1, 0, 0}, {1, 0}},
+                                           QuadVertex{{1, 1, 0}, {1, 1}},
+                                           QuadVertex{{0, 1, 0}, {0, 1}}};
+
+  gl::VertexFormat<QuadVertex> format{
+    {VERTEX_ATTRIBUTE_POSITION_NAME, &QuadVertex::pos},
+    {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, &QuadVertex::uv},
+    {VERTEX_ATTRIBUTE_COLOR_NAME, gl::VertexAttribute{&QuadVertex::color, true}},
+    {VERTEX_ATTRIBUTE_NORMAL_NAME, gl::VertexAttribute{&QuadVertex::normal, true}}};
+  auto vb = std::make_shared<gl::VertexBuffer<QuadVertex>>(format);
+  vb->setData(&vertices[0], 4, gl::api::BufferUsageARB::StaticDraw);
+
+  static const std::array<uint16_t, 6> indices{0, 1, 2, 0, 2, 3};
+
+  auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<uint16_t>>();
+  indexBuffer->setData(gsl::not_null(&indices[0]), 6, gl::api::BufferUsageARB::StaticDraw);
+
+  auto vao = std::make_shared<gl::VertexArray<uint16_t, QuadVertex>>(
+    indexBuffer, vb, std::vector{&material->getShaderProgram()->getHandle()});
+  auto mesh = std::make_shared<render::scene::MeshImpl<uint16_t, QuadVertex>>(vao);
+  mesh->getMaterial().set(render::scene::RenderMode::Full, material);
+  return mesh;
+}
+} // namespace
+
+ParticlePool::ParticlePool(World& world)
+{
+  const auto& material = world.getPresenter().getMaterialManager()->getParticle();
+  const auto brightness = toBrightness(core::Shade{core::Shade::type{4096}}).get();
+
+  for(size_t type = 0; type < TypeCount; ++type)
+  {
+    const auto& spriteSequence = world.findSpriteSequenceForType(Types[type].sprite);
+    if(spriteSequence == nullptr || spriteSequence->sprites.empty())
+    {
+      BOOST_LOG_TRIVIAL(warning) << "Missing sprite sequence referenced by particle: " << toString(Types[type].sprite);
+      continue;
+    }
+
+    auto batch = std::make_unique<Batch>();
+    batch->sequenceLength = spriteSequence->length;
+    batch->frameCount = spriteSequence->sprites.size();
+
+    const auto scale = Types[type].scale;
+    std::vector<SpriteFrame> frames;
+    for(const loader::file::Sprite& spr : spriteSequence->sprites)
+    {
+      frames.emplace_back(SpriteFrame{glm::vec4{static_cast<float>(spr.render0.x) * scale,
+                                                static_cast<float>(-spr.render0.y) * scale,
+                                                static_cast<float>(spr.render1.x) * scale,
+                                                static_cast<float>(-spr.render1.y) * scale},
+                                      glm::vec4{spr.uv0.toGl(), spr.uv1.toGl()},
+                                      static_cast<float>(spr.texture_id.get())});
+    }
+    batch->framesBuffer->setData(frames, gl::api::BufferUsageARB::StaticDraw);
+
+    batch->instances.reserve(ParticleBuffer::InitialCapacity);
+
+    batch->mesh = createQuadMesh(material);
+    batch->mesh->setInstanceCount(0);
+
+    batch->node = std::make_shared<render::scene::Node>(std::string{"particles:"} + toString(Types[type].sprite));
+    batch->node->setRenderable(batch->mesh);
+    batch->node->setVisible(false);
+    batch->node->addUniformSetter(
+      "u_lightAmbient",
+      [brightness](const render::scene::Node& /*node*/, gl::Uniform& uniform) { uniform.set(brightness); });
+    batch->node->addBufferBinder("b_spriteFrames",
+                                 [buffer = batch->framesBuffer](const render::scene::Node& /*node*/,
+                                                                gl::ShaderStorageBlock& shaderStorageBlock) {
+                                   shaderStorageBlock.bind(*buffer);
+                                 });
+    batch->node->addBufferBinder("b_spriteInstances",
+                                 [buffer = batch->instancesBuffer](const render::scene::Node& /*node*/,
+                                                                   gl::ShaderStorageBlock& shaderStorageBlock) {
+                                   shaderStorageBlock.bind(*buffer);
+                                 });
+
+    m_batches[type] = std::move(batch);
+  }
+}
+
+ParticlePool::~ParticlePool() = default;
+
+ParticleBuffer* ParticlePool::tryEmit(const Type type)
+{
+  if(m_batches[toIndex(type)] == nullptr)
+    return nullptr;
+
+  return &m_particles[toIndex(type)];
+}
+
+void ParticlePool::nextFrame(const Type type, const size_t i)
+{
+  auto& particles = m_particles[toIndex(type)];
+  --particles.negSpriteFrameIds[i];
+  particles.spriteFrames[i]
+    = gsl::narrow_cast<uint16_t>((particles.spriteFrames[i] + 1u) % m_batches[toIndex(type)]->frameCount);
+}
+
+void ParticlePool::addToScene(render::scene::Scene& scene) const
+{
+  for(const auto& batch : m_batches)
+  {
+    if(batch != nullptr)
+      scene.addNode(batch->node);
+  }
+}
+
+void ParticlePool::emitBloodSplat(const core::RoomBoundPosition& pos,
+                                  const core::Speed& speed,
+                                  const core::Angle& angle)
+{
+  auto particles = tryEmit(Type::BloodSplatter);
+  if(particles == nullptr)
+    return;
+
+  const auto i = particles->add(pos);
+  particles->speeds[i] = speed;
+  particles->angles[i] = angle;
+}
+
+void ParticlePool::emitSplash(const core::RoomBoundPosition& pos, const bool waterfall)
+{
+  // the random numbers are drawn even if the effect can't be shown, so the sequence doesn't depend on the level's
+  // sprites
+  auto speed = 0_spd;
+  auto angle = 0_deg;
+  auto offsetX = 0_len;
+  auto offsetZ = 0_len;
+  if(!waterfall)
+  {
+    speed = util::rand15(128_spd);
+    angle = core::auToAngle(2 * util::rand15s());
+  }
+  else
+  {
+    offsetX = util::rand15s(core::SectorSize);
+    offsetZ = util::rand15s(core::SectorSize);
+  }
+
+  auto particles = tryEmit(Type::Splash);
+  if(particles == nullptr)
+    return;
+
+  const auto i = particles->add(pos);
+  particles->speeds[i] = speed;
+  particles->angles[i] = angle;
+  particles->positions[i].X += offsetX;
+  particles->positions[i].Z += offsetZ;
+}
+
+void ParticlePool::emitRicochet(const core::RoomBoundPosition& pos, const int16_t duration)
+{
+  Expects(duration > 0);
+
+  // see emitSplash
+  const auto skippedFrames = util::rand15(3);
+
+  auto particles = tryEmit(Type::Ricochet);
+  if(particles == nullptr)
+    return;
+
+  const auto i = particles->add(pos);
+  particles->timers[i] = duration;
+  for(auto n = skippedFrames; n > 0; --n)
+    nextFrame(Type::Ricochet, i);
+}
+
+void ParticlePool::emitBubble(const core::RoomBoundPosition& pos)
+{
+  // see emitSplash
+  const auto speed = 10_spd + util::rand15(6_spd);
+  const auto skippedFrames = util::rand15(3);
+
+  auto particles = tryEmit(Type::Bubble);
+  if(particles == nullptr)
+    return;
+
+  const auto i = particles->add(pos);
+  particles->speeds[i] = speed;
+  for(auto n = skippedFrames; n > 0; --n)
+    nextFrame(Type::Bubble, i);
+}
+
+void ParticlePool::emitSparkle(const core::RoomBoundPosition& pos)
+{
+  if(auto particles = tryEmit(Type::Sparkle))
+    particles->add(pos);
+}
+
+void ParticlePool::emitExplosion(const core::RoomBoundPosition& pos)
+{
+  if(auto particles = tryEmit(Type::Explosion))
+    particles->add(pos);
+}
+
+bool ParticlePool::updateBloodSplatter(const size_t i)
+{
+  auto& particles = m_particles[toIndex(Type::BloodSplatter)];
+  particles.positions[i] += util::pitch(particles.speeds[i] * 1_frame, particles.angles[i]);
+  ++particles.timers[i];
+  if(particles.timers[i] != 4)
+    return true;
+
+  particles.timers[i] = 0;
+  nextFrame(Type::BloodSplatter, i);
+  return particles.negSpriteFrameIds[i] > m_batches[toIndex(Type::BloodSplatter)]->sequenceLength;
+}
+
+bool ParticlePool::updateSplash(const size_t i)
+{
+  auto& particles = m_particles[toIndex(Type::Splash)];
+  nextFrame(Type::Splash, i);
+  if(particles.negSpriteFrameIds[i] <= m_batches[toIndex(Type::Splash)]->sequenceLength)
+    return false;
+
+  particles.positions[i] += util::pitch(particles.speeds[i] * 1_frame, particles.angles[i]);
+  return true;
+}
+
+bool ParticlePool::updateRicochet(const size_t i)
+{
+  auto& timer = m_particles[toIndex(Type::Ricochet)].timers[i];
+  --timer;
+  return timer != 0;
+}
+
+bool ParticlePool::updateBubble(const size_t i, const World& world)
+{
+  auto& particles = m_particles[toIndex(Type::Bubble)];
+  auto& position = particles.positions[i];
+  auto& room = particles.rooms[i];
+
+  particles.angles[i] += 9_deg;
+  position += util::pitch(11_len, particles.angles[i], -particles.speeds[i] * 1_frame);
+  const auto sector = findRealFloorSector(position, &room);
+  if(!room->isWaterRoom())
+    return false;
+
+  const auto ceiling = HeightInfo::fromCeiling(sector, position, world.getObjectManager().getObjects()).y;
+  return ceiling != -core::HeightLimit && position.Y > ceiling;
+}
+
+bool ParticlePool::updateSparkle(const size_t i)
+{
+  auto& particles = m_particles[toIndex(Type::Sparkle)];
+  ++particles.timers[i];
+  if(particles.timers[i] != 1)
+    return true;
+
+  --particles.negSpriteFrameIds[i];
+  particles.timers[i] = 0;
+  return gsl::narrow<size_t>(-particles.negSpriteFrameIds[i]) < m_batches[toIndex(Type::Sparkle)]->frameCount;
+}
+
+bool ParticlePool::updateExplosion(const size_t i)
+{
+  auto& particles = m_particles[toIndex(Type::Explosion)];
+  ++particles.timers[i];
+  if(particles.timers[i] != 2)
+    return true;
+
+  particles.timers[i] = 0;
+  --particles.negSpriteFrameIds[i];
+  const auto negSpriteFrameId = particles.negSpriteFrameIds[i];
+  return negSpriteFrameId > 0
+         && static_cast<size_t>(negSpriteFrameId) > m_batches[toIndex(Type::Explosion)]->frameCount;
+}
+
+void ParticlePool::update(World& world)
+{
+  const auto updateAll = [this](const Type type, const auto& updateOne) {
+    auto& particles = m_particles[toIndex(type)];
+    for(size_t i = 0; i < particles.size();)
+    {
+      if(updateOne(i))
+        ++i;
+      else
+        particles.remove(i);
+    }
+  };
+
+  updateAll(Type::BloodSplatter, [this](const size_t i) { return updateBloodSplatter(i); });
+  updateAll(Type::Splash, [this](const size_t i) { return updateSplash(i); });
+  updateAll(Type::Ricochet, [this](const size_t i) { return updateRicochet(i); });
+  updateAll(Type::Bubble, [this, &world](const size_t i) { return updateBubble(i, world); });
+  updateAll(Type::Sparkle, [this](const size_t i) { return updateSparkle(i); });
+  updateAll(Type::Explosion, [this](const size_t i) { return updateExplosion(i); });
+}
+
+void ParticlePool::updateInstances()
+{
+  for(size_t type = 0; type < TypeCount; ++type)
+  {
+    const auto& batch = m_batches[type];
+    if(batch == nullptr)
+      continue;
+
+    batch->instances.clear();
+    m_particles[type].collectInstances(
+      [](const loader::file::Room& room) { return room.node->isVisible(); }, batch->instances);
+
+    batch->mesh->setInstanceCount(gsl::narrow<gl::api::core::SizeType>(batch->instances.size()));
+    batch->node->setVisible(!batch->instances.empty());
+    batch->instancesBuffer->setData(batch->instances, gl::api::BufferUsageARB::StreamDraw);
+  }
+}
+
+void ParticlePool::clear()
+{
+  for(auto& particles : m_particles)
+    particles.clear();
+}
+
+size_t ParticlePool::size() const
+{
+  size_t result = 0;
+  for(const auto& particles : m_particles)
+    result += particles.size();
+  return result;
+}
+} // namespace engine
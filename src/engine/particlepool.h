@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/angle.h"
+#include "core/units.h"
+#include "core/vec.h"
+#include "particlebuffer.h"
+
+#include <array>
+#include <gl/buffer.h>
+#include <glm/glm.hpp>
+#include <gsl-lite.hpp>
+#include <memory>
+#include <vector>
+
+namespace render::scene
+{
+class Mesh;
+class Node;
+class Scene;
+} // namespace render::scene
+
+namespace engine
+{
+class World;
+
+//! Short-lived sprite effects without any gameplay interaction. In contrast to engine::Particle, these don't own
+//! scene nodes; their state is kept in flat arrays per effect type, and all effects of a type are drawn with a single
+//! instanced draw call.
+class ParticlePool final
+{
+public:
+  enum class Type : uint8_t
+  {
+    BloodSplatter,
+    Splash,
+    Ricochet,
+    Bubble,
+    Sparkle,
+    Explosion
+  };
+
+  static constexpr size_t TypeCount = 6;
+
+  explicit ParticlePool(World& world);
+  ~ParticlePool();
+
+  void addToScene(render::scene::Scene& scene) const;
+
+  void emitBloodSplat(const core::RoomBoundPosition& pos, const core::Speed& speed, const core::Angle& angle);
+  void emitSplash(const core::RoomBoundPosition& pos, bool waterfall);
+  void emitRicochet(const core::RoomBoundPosition& pos, int16_t duration = 4);
+  void emitBubble(const core::RoomBoundPosition& pos);
+  void emitSparkle(const core::RoomBoundPosition& pos);
+  void emitExplosion(const core::RoomBoundPosition& pos);
+
+  void update(World& world);
+
+  //! Uploads the instances of all effects within visible rooms; must be called after the visible rooms are determined
+  void updateInstances();
+
+  void clear();
+
+  [[nodiscard]] size_t size() const;
+
+  //! Matches the SpriteFrame struct in particle.vert
+  struct SpriteFrame
+  {
+    glm::vec4 rect;
+    glm::vec4 uv;
+    float texIndex = 0;
+    float _pad[3]{0.0f, 0.0f, 0.0f};
+  };
+  static_assert(sizeof(SpriteFrame) == 48, "Invalid SpriteFrame struct size");
+
+private:
+  struct Batch
+  {
+    //! Negative number of frames, as in loader::file::SpriteSequence
+    int16_t sequenceLength = 0;
+    size_t frameCount = 0;
+    std::shared_ptr<render::scene::Mesh> mesh;
+    std::shared_ptr<render::scene::Node> node;
+    // shared with the node's binders, which may outlive the pool
+    std::shared_ptr<gl::ShaderStorageBuffer<SpriteFrame>> framesBuffer
+      = std::make_shared<gl::ShaderStorageBuffer<SpriteFrame>>("particle-sprite-frames");
+    std::shared_ptr<gl::ShaderStorageBuffer<glm::vec4>> instancesBuffer
+      = std::make_shared<gl::ShaderStorageBuffer<glm::vec4>>("particle-instances");
+    std::vector<glm::vec4> instances;
+  };
+
+  std::array<ParticleBuffer, TypeCount> m_particles;
+  std::array<std::unique_ptr<Batch>, TypeCount> m_batches;
+
+  [[nodiscard]] ParticleBuffer* tryEmit(Type type);
+
+  void nextFrame(Type type, size_t i);
+
+  [[nodiscard]] bool updateBloodSplatter(size_t i);
+  [[nodiscard]] bool updateSplash(size_t i);
+  [[nodiscard]] bool updateRicochet(size_t i);
+  [[nodiscard]] bool updateBubble(size_t i, const World& world);
+  [[nodiscard]] bool updateSparkle(size_t i);
+  [[nodiscard]] bool updateExplosion(size_t i);
+};
+} // namespace engine
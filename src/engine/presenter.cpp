@@ -3,10 +3,12 @@
 #include "audioengine.h"
 #include "engine.h"
 #include "engine/objects/laraobject.h"
+#include "lighting.h"
 #include "loader/file/level/level.h"
 #include "objectmanager.h"
 #include "render/renderpipeline.h"
 #include "render/scene/camera.h"
+#include "render/scene/clusteredlighting.h"
 #include "render/scene/csm.h"
 #include "render/scene/materialmanager.h"
 #include "render/scene/node.h"
@@ -14,19 +16,28 @@
 #include "render/scene/renderer.h"
 #include "render/scene/rendervisitor.h"
 #include "render/scene/screenoverlay.h"
+#include "render/scene/videooverlay.h"
 #include "render/textureanimator.h"
 #include "ui/label.h"
 #include "ui/ui.h"
+#include "util/profiler.h"
 #include "video/player.h"
 
-#include <boost/range/adaptors.hpp>
+#include <algorithm>
+#include <boost/format.hpp>
 #include <gl/debuggroup.h>
 #include <gl/font.h>
+#include <gl/query.h>
 
 namespace
 {
 constexpr int StatusLineFontSize = 40;
 constexpr int DebugTextFontSize = 12;
+constexpr size_t ProfilerSummaryZones = 16;
+constexpr auto ProfilerSummaryWindow = std::chrono::seconds{1};
+constexpr std::array<gsl::czstring, render::scene::CSMBuffer::NSplits> CSMSplitZones{
+  "csm-pass/0", "csm-pass/1", "csm-pass/2", "csm-pass/3", "csm-pass/4"};
+static_assert(CSMSplitZones.back() != nullptr, "each split needs a zone name");
 } // namespace
 
 namespace engine
@@ -34,23 +45,21 @@ namespace engine
 void Presenter::playVideo(const std::filesystem::path& path)
 {
   render::scene::RenderContext context{render::scene::RenderMode::Full, std::nullopt};
+  render::scene::VideoOverlay videoOverlay{*m_shaderManager, m_window->getViewport()};
   m_soundEngine->getSoLoud().setGlobalVolume(1.0f);
-  video::play(path, m_soundEngine->getSoLoud(), m_screenOverlay->getImage(), [&]() {
+  video::play(path, m_soundEngine->getSoLoud(), [&](const video::YuvFrame* frame) {
+    if(frame != nullptr)
+      videoOverlay.upload(frame->size, frame->planes, frame->strides);
+
     glfwPollEvents();
     m_window->updateWindowSize();
     if(m_window->isMinimized())
       return true;
 
     m_renderer->getCamera()->setAspectRatio(m_window->getAspectRatio());
-    if(m_screenOverlay->getImage()->getSize() != m_window->getViewport())
-    {
-      m_screenOverlay->init(*m_shaderManager, m_window->getViewport());
-    }
-
-    if(m_window->isMinimized())
-      return true;
+    videoOverlay.setViewport(m_window->getViewport());
 
-    m_screenOverlay->render(context);
+    videoOverlay.render(context);
     swapBuffers();
     m_inputHandler->update();
     return !m_window->windowShouldClose() && !m_inputHandler->hasDebouncedAction(hid::Action::Menu);
@@ -60,12 +69,17 @@ void Presenter::playVideo(const std::filesystem::path& path)
 void Presenter::renderWorld(ui::Ui& ui,
                             const ObjectManager& objectManager,
                             const std::vector<loader::file::Room>& rooms,
+                            const RoomLightNeighbourhoods& roomLightNeighbourhoods,
                             const CameraController& cameraController,
                             const std::unordered_set<const loader::file::Portal*>& waterEntryPortals)
 {
+  UTIL_PROFILE_ZONE("render-world");
   m_renderPipeline->updateCamera(m_renderer->getCamera());
+  updateClusteredLighting(rooms, roomLightNeighbourhoods);
+  hideOccludedRooms(rooms, cameraController.getCamera()->getPosition());
 
   {
+    UTIL_PROFILE_ZONE("csm-pass");
     SOGLB_DEBUGGROUP("csm-pass");
     m_renderer->resetRenderState();
     m_csm->updateCamera(*m_renderer->getCamera());
@@ -74,6 +88,7 @@ void Presenter::renderWorld(ui::Ui& ui,
     for(size_t i = 0; i < render::scene::CSMBuffer::NSplits; ++i)
     {
       SOGLB_DEBUGGROUP("csm-pass/" + std::to_string(i));
+      RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), CSMSplitZones[i]);
       m_renderer->resetRenderState();
       gl::RenderState renderState;
       renderState.setDepthClamp(true);
@@ -103,13 +118,16 @@ void Presenter::renderWorld(ui::Ui& ui,
   }
 
   {
+    UTIL_PROFILE_ZONE("geometry-pass");
     SOGLB_DEBUGGROUP("geometry-pass");
     m_renderPipeline->bindGeometryFrameBuffer(m_window->getViewport());
     m_renderer->clear(
       gl::api::ClearBufferMask::ColorBufferBit | gl::api::ClearBufferMask::DepthBufferBit, {0, 0, 0, 0}, 1);
 
     {
+      UTIL_PROFILE_ZONE("depth-prefill-pass");
       SOGLB_DEBUGGROUP("depth-prefill-pass");
+      RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), "depth-prefill-pass");
       m_renderer->resetRenderState();
       render::scene::RenderContext context{render::scene::RenderMode::DepthOnly,
                                            cameraController.getCamera()->getViewProjectionMatrix()};
@@ -126,6 +144,9 @@ void Presenter::renderWorld(ui::Ui& ui,
         GL_ASSERT(gl::api::finish());
     }
 
+    issueOcclusionQueries(rooms, cameraController.getCamera()->getViewProjectionMatrix());
+
+    RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), "geometry-pass");
     m_renderer->resetRenderState();
     m_renderer->render();
 
@@ -133,8 +154,12 @@ void Presenter::renderWorld(ui::Ui& ui,
       GL_ASSERT(gl::api::finish());
   }
 
+  restoreOccludedRooms(rooms);
+
   {
+    UTIL_PROFILE_ZONE("portal-depth-pass");
     SOGLB_DEBUGGROUP("portal-depth-pass");
+    RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), "portal-depth-pass");
     m_renderer->resetRenderState();
 
     render::scene::RenderContext context{render::scene::RenderMode::DepthOnly,
@@ -152,17 +177,23 @@ void Presenter::renderWorld(ui::Ui& ui,
   render::scene::RenderContext context{render::scene::RenderMode::Full,
                                        cameraController.getCamera()->getViewProjectionMatrix()};
 
-  m_renderPipeline->compositionPass(cameraController.getCurrentRoom()->isWaterRoom());
+  {
+    UTIL_PROFILE_ZONE("composition-pass");
+    m_renderPipeline->compositionPass(cameraController.getCurrentRoom()->isWaterRoom());
+  }
 
   if(m_showDebugInfo)
   {
-    m_debugFont->drawText(
-      *m_screenOverlay->getImage(),
-      std::to_string(m_renderer->getFrameRate()).c_str(),
+    UTIL_PROFILE_ZONE("debug-overlay");
+    m_screenOverlay->drawText(
+      *m_debugFont,
+      std::to_string(m_renderer->getFrameRate()),
       glm::ivec2{m_screenOverlay->getImage()->getSize().x - 40, m_screenOverlay->getImage()->getSize().y - 20},
       gl::SRGBA8{255},
       DebugTextFontSize);
 
+    drawProfilerSummary();
+
     const auto drawObjectName = [this](const std::shared_ptr<objects::Object>& object, const gl::SRGBA8& color) {
       const auto vertex
         = glm::vec3{m_renderer->getCamera()->getViewMatrix() * glm::vec4(object->getNode()->getTranslationWorld(), 1)};
@@ -182,14 +213,14 @@ void Presenter::renderWorld(ui::Ui& ui,
       projVertex.x = (projVertex.x / 2 + 0.5f) * m_window->getViewport().x;
       projVertex.y = (1 - (projVertex.y / 2 + 0.5f)) * m_window->getViewport().y;
 
-      m_debugFont->drawText(*m_screenOverlay->getImage(),
-                            object->getNode()->getName().c_str(),
-                            glm::ivec2{static_cast<int>(projVertex.x), static_cast<int>(projVertex.y)},
-                            color,
-                            DebugTextFontSize);
+      m_screenOverlay->drawText(*m_debugFont,
+                                object->getNode()->getName(),
+                                glm::ivec2{static_cast<int>(projVertex.x), static_cast<int>(projVertex.y)},
+                                color,
+                                DebugTextFontSize);
     };
 
-    for(const auto& object : objectManager.getObjects() | boost::adaptors::map_values)
+    for(const auto& object : objectManager.getObjects())
     {
       drawObjectName(object, gl::SRGBA8{255});
     }
@@ -200,7 +231,9 @@ void Presenter::renderWorld(ui::Ui& ui,
   }
 
   {
+    UTIL_PROFILE_ZONE("screen-overlay-pass");
     SOGLB_DEBUGGROUP("screen-overlay-pass");
+    RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), "screen-overlay-pass");
     m_renderer->resetRenderState();
     m_screenOverlay->render(context);
   }
@@ -210,6 +243,36 @@ void Presenter::renderWorld(ui::Ui& ui,
   swapBuffers();
 }
 
+void Presenter::drawProfilerSummary()
+{
+  const auto toMilliseconds = [](const util::profiler::Clock::duration& d) {
+    return std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(d).count();
+  };
+
+  // the CPU zones are listed first, followed by the GPU zones
+  auto summary = util::profiler::getSummary(ProfilerSummaryWindow);
+  std::stable_partition(
+    summary.begin(), summary.end(), [](const util::profiler::ZoneSummary& zone) { return !zone.gpu; });
+
+  int y = 20;
+  size_t cpuZones = 0;
+  for(const auto& zone : summary)
+  {
+    if(!zone.gpu && ++cpuZones > ProfilerSummaryZones)
+      continue;
+
+    const auto line = boost::format("%-4s%-22s %5d/s  avg %6.2f ms  max %6.2f ms") % (zone.gpu ? "gpu" : "cpu")
+                      % zone.name % zone.calls % (toMilliseconds(zone.total) / static_cast<float>(zone.calls))
+                      % toMilliseconds(zone.max);
+    m_screenOverlay->drawText(*m_debugFont,
+                              line.str(),
+                              glm::ivec2{10, y},
+                              zone.gpu ? gl::SRGBA8{0, 255, 255, 255} : gl::SRGBA8{255, 255, 0, 255},
+                              DebugTextFontSize);
+    y += DebugTextFontSize + 2;
+  }
+}
+
 namespace
 {
 constexpr size_t BarColors = 5;
@@ -253,6 +316,17 @@ void drawBar(ui::Ui& ui,
 };
 } // namespace
 
+void Presenter::updateBars(const ObjectManager& objectManager)
+{
+  if(objectManager.getLara().getHandStatus() == objects::HandStatus::Combat || objectManager.getLara().isDead())
+    m_healthBarTimeout = 40_frame;
+
+  if(std::exchange(m_drawnHealth, objectManager.getLara().m_state.health) != objectManager.getLara().m_state.health)
+    m_healthBarTimeout = 40_frame;
+
+  m_healthBarTimeout -= 1_frame;
+}
+
 void Presenter::drawBars(ui::Ui& ui, const loader::file::Palette& palette, const ObjectManager& objectManager)
 {
   if(objectManager.getLara().isInWater())
@@ -272,13 +346,6 @@ void Presenter::drawBars(ui::Ui& ui, const loader::file::Palette& palette, const
             });
   }
 
-  if(objectManager.getLara().getHandStatus() == objects::HandStatus::Combat || objectManager.getLara().isDead())
-    m_healthBarTimeout = 40_frame;
-
-  if(std::exchange(m_drawnHealth, objectManager.getLara().m_state.health) != objectManager.getLara().m_state.health)
-    m_healthBarTimeout = 40_frame;
-
-  m_healthBarTimeout -= 1_frame;
   if(m_healthBarTimeout <= -40_frame)
     return;
 
@@ -314,7 +381,9 @@ Presenter::Presenter(const std::filesystem::path& rootPath, bool fullscreen, con
     , m_inputHandler{std::make_unique<hid::InputHandler>(m_window->getWindow())}
     , m_shaderManager{std::make_shared<render::scene::ShaderManager>(rootPath / "shaders")}
     , m_csm{std::make_shared<render::scene::CSM>(CSMResolution, *m_shaderManager)}
-    , m_materialManager{std::make_unique<render::scene::MaterialManager>(m_shaderManager, m_csm, m_renderer)}
+    , m_clusteredLighting{std::make_shared<render::scene::ClusteredLighting>()}
+    , m_materialManager{
+        std::make_unique<render::scene::MaterialManager>(m_shaderManager, m_csm, m_renderer, m_clusteredLighting)}
     , m_renderPipeline{std::make_unique<render::RenderPipeline>(*m_materialManager, m_window->getViewport())}
     , m_screenOverlay{std::make_unique<render::scene::ScreenOverlay>(*m_shaderManager, m_window->getViewport())}
 {
@@ -370,11 +439,12 @@ void Presenter::drawLoadingScreen(const std::string& state)
 
   m_screenOverlay->getImage()->assign(m_splashImageScaled.pixels<gl::SRGBA8>().data(),
                                       m_window->getViewport().x * m_window->getViewport().y);
-  m_abibasFont->drawText(*m_screenOverlay->getImage(),
-                         state.c_str(),
-                         glm::ivec2{40, m_screenOverlay->getImage()->getSize().y - 100},
-                         gl::SRGBA8{255, 255, 255, 192},
-                         StatusLineFontSize);
+  m_screenOverlay->markAllDirty();
+  m_screenOverlay->drawText(*m_abibasFont,
+                            state,
+                            glm::ivec2{40, m_screenOverlay->getImage()->getSize().y - 100},
+                            gl::SRGBA8{255, 255, 255, 192},
+                            StatusLineFontSize);
 
   gl::Framebuffer::unbindAll();
 
@@ -385,7 +455,7 @@ void Presenter::drawLoadingScreen(const std::string& state)
   swapBuffers();
 }
 
-bool Presenter::preFrame()
+bool Presenter::beginFrame()
 {
   m_window->updateWindowSize();
   if(m_window->isMinimized())
@@ -398,18 +468,32 @@ bool Presenter::preFrame()
     m_screenOverlay->init(*m_shaderManager, m_window->getViewport());
   }
 
-  m_screenOverlay->getImage()->fill({0, 0, 0, 0});
+  m_screenOverlay->clear();
 
+  m_renderer->clear(
+    gl::api::ClearBufferMask::ColorBufferBit | gl::api::ClearBufferMask::DepthBufferBit, {0, 0, 0, 0}, 1);
+
+  return true;
+}
+
+void Presenter::updateInput()
+{
   m_inputHandler->update();
 
   if(m_inputHandler->hasDebouncedAction(hid::Action::Debug))
   {
     m_showDebugInfo = !m_showDebugInfo;
+    // the overlay shows the profiled zones
+    util::profiler::setEnabled(util::profiler::Consumer::DebugOverlay, m_showDebugInfo);
   }
+}
 
-  m_renderer->clear(
-    gl::api::ClearBufferMask::ColorBufferBit | gl::api::ClearBufferMask::DepthBufferBit, {0, 0, 0, 0}, 1);
+bool Presenter::preFrame()
+{
+  if(!beginFrame())
+    return false;
 
+  updateInput();
   return true;
 }
 
@@ -425,7 +509,10 @@ void Presenter::setTrFont(std::unique_ptr<ui::TRFont>&& font)
 
 void Presenter::swapBuffers()
 {
-  m_window->swapBuffers();
+  {
+    UTIL_PROFILE_ZONE("swap-buffers");
+    m_window->swapBuffers();
+  }
   m_soundEngine->update();
 }
 
@@ -444,8 +531,131 @@ void Presenter::debounceInput()
 void Presenter::apply(const render::RenderSettings& renderSettings)
 {
   setFullscreen(renderSettings.fullscreen);
+  m_window->setVsync(renderSettings.vsync);
   m_renderPipeline->apply(renderSettings, *m_materialManager);
   m_materialManager->setBilinearFiltering(renderSettings.bilinearFiltering);
+  m_occlusionCulling = renderSettings.occlusionCulling;
+  m_occlusionQueryTracker.reset(m_occlusionQueryTracker.size());
+  m_clusteredLighting->setEnabled(renderSettings.clusteredLighting);
+}
+
+bool Presenter::isClusteredLightingEnabled() const
+{
+  return m_clusteredLighting->isEnabled();
+}
+
+void Presenter::updateClusteredLighting(const std::vector<loader::file::Room>& rooms,
+                                        const RoomLightNeighbourhoods& roomLightNeighbourhoods)
+{
+  if(!m_clusteredLighting->isEnabled())
+    return;
+
+  // lights up to two portals away from the visible rooms may still shine into them
+  m_clusteredLightIndices.clear();
+  for(size_t i = 0; i < rooms.size(); ++i)
+  {
+    if(!rooms[i].node->isVisible())
+      continue;
+
+    const auto indices = roomLightNeighbourhoods.get(i);
+    m_clusteredLightIndices.insert(m_clusteredLightIndices.end(), indices.begin(), indices.end());
+  }
+  std::sort(m_clusteredLightIndices.begin(), m_clusteredLightIndices.end());
+  m_clusteredLightIndices.erase(std::unique(m_clusteredLightIndices.begin(), m_clusteredLightIndices.end()),
+                                m_clusteredLightIndices.end());
+
+  m_clusteredLighting->clear();
+  const auto& lights = roomLightNeighbourhoods.getLights();
+  for(const auto i : m_clusteredLightIndices)
+    m_clusteredLighting->addLight(lights[i].light, lights[i].cutoffDistance);
+  m_clusteredLighting->update(*m_renderer->getCamera());
+}
+
+void Presenter::hideOccludedRooms(const std::vector<loader::file::Room>& rooms, const glm::vec3& cameraPosition)
+{
+  m_occlusionQueryCandidates.clear();
+  m_occludedRooms.clear();
+
+  if(m_occlusionQueryRooms != rooms.data() || m_occlusionQueries.size() != rooms.size())
+  {
+    m_occlusionQueryRooms = rooms.data();
+    m_occlusionQueries.clear();
+    for(size_t i = 0; i < rooms.size(); ++i)
+      m_occlusionQueries.emplace_back(
+        std::make_unique<gl::Query<gl::api::QueryTarget::AnySamplesPassedConservative>>(
+          "occlusion-query:" + std::to_string(i)));
+    m_occlusionQueryTracker.reset(rooms.size());
+  }
+
+  if(!m_occlusionCulling)
+    return;
+
+  // results are at least one frame old, so waiting for them would only stall the pipeline
+  m_occlusionQueryTracker.collectResults([this](const size_t i) -> std::optional<bool> {
+    const auto samples = m_occlusionQueries[i]->tryGetResult();
+    if(!samples.has_value())
+      return std::nullopt;
+    return *samples != 0;
+  });
+
+  // a box clipped by the near plane would give false negatives
+  const auto margin = glm::vec3{m_renderer->getCamera()->getNearPlane()};
+  for(size_t i = 0; i < rooms.size(); ++i)
+  {
+    const auto& room = rooms[i];
+    if(!room.node->isVisible() || room.occlusionQueryMesh == nullptr
+       || (glm::all(glm::greaterThanEqual(cameraPosition, room.occlusionBoxMin - margin))
+           && glm::all(glm::lessThanEqual(cameraPosition, room.occlusionBoxMax + margin))))
+    {
+      m_occlusionQueryTracker.invalidate(i);
+      continue;
+    }
+
+    m_occlusionQueryCandidates.emplace_back(i);
+    if(m_occlusionQueryTracker.isOccluded(i))
+    {
+      room.node->setVisible(false);
+      m_occludedRooms.emplace_back(i);
+    }
+  }
+}
+
+void Presenter::issueOcclusionQueries(const std::vector<loader::file::Room>& rooms, const glm::mat4& viewProjection)
+{
+  if(m_occlusionQueryCandidates.empty())
+    return;
+
+  UTIL_PROFILE_ZONE("occlusion-query-pass");
+  SOGLB_DEBUGGROUP("occlusion-query-pass");
+  RENDER_GPU_ZONE(m_renderPipeline->getGpuProfiler(), "occlusion-query-pass");
+  m_renderer->resetRenderState();
+  GL_ASSERT(gl::api::colorMask(false, false, false, false));
+
+  render::scene::RenderContext context{render::scene::RenderMode::DepthOnly, viewProjection};
+  for(const auto i : m_occlusionQueryCandidates)
+  {
+    if(!m_occlusionQueryTracker.needsQuery(i))
+      continue;
+
+    const auto& room = rooms[i];
+    context.setCurrentNode(room.node.get());
+    auto& query = *m_occlusionQueries[i];
+    query.begin();
+    room.occlusionQueryMesh->render(context);
+    query.end();
+    m_occlusionQueryTracker.setQueryIssued(i);
+  }
+
+  GL_ASSERT(gl::api::colorMask(true, true, true, true));
+  if constexpr(render::RenderPipeline::FlushStages)
+    GL_ASSERT(gl::api::finish());
+}
+
+void Presenter::restoreOccludedRooms(const std::vector<loader::file::Room>& rooms)
+{
+  for(const auto i : m_occludedRooms)
+    rooms[i].node->setVisible(true);
+  m_occludedRooms.clear();
 }
 
 gl::CImgWrapper Presenter::takeScreenshot() const
@@ -2,10 +2,12 @@
 
 #include "core/magic.h"
 #include "hid/inputhandler.h"
+#include "render/occlusionquerytracker.h"
 
 #include <boost/assert.hpp>
 #include <filesystem>
 #include <gl/cimgwrapper.h>
+#include <gl/soglb_fwd.h>
 #include <gl/window.h>
 #include <unordered_set>
 
@@ -42,6 +44,7 @@ namespace scene
 {
 class ScreenOverlay;
 class CSM;
+class ClusteredLighting;
 class MaterialManager;
 class ShaderManager;
 class Renderer;
@@ -63,6 +66,7 @@ class AudioEngine;
 class Engine;
 class ObjectManager;
 class CameraController;
+class RoomLightNeighbourhoods;
 
 class Presenter final
 {
@@ -79,6 +83,7 @@ public:
   void renderWorld(ui::Ui& ui,
                    const ObjectManager& objectManager,
                    const std::vector<loader::file::Room>& rooms,
+                   const RoomLightNeighbourhoods& roomLightNeighbourhoods,
                    const CameraController& cameraController,
                    const std::unordered_set<const loader::file::Portal*>& waterEntryPortals);
 
@@ -112,6 +117,8 @@ public:
     return *m_inputHandler;
   }
 
+  //! Advances the health bar fading by one frame
+  void updateBars(const ObjectManager& objectManager);
   void drawBars(ui::Ui& ui, const loader::file::Palette& palette, const ObjectManager& objectManager);
 
   [[nodiscard]] const ui::TRFont& getTrFont() const
@@ -152,7 +159,13 @@ public:
 
   void apply(const render::RenderSettings& renderSettings);
 
+  [[nodiscard]] bool isClusteredLightingEnabled() const;
+
   void drawLoadingScreen(const std::string& state);
+  //! Prepares the window and the screen overlay for a new frame; returns false if nothing can be rendered
+  bool beginFrame();
+  void updateInput();
+  //! beginFrame() and updateInput()
   bool preFrame();
   [[nodiscard]] bool shouldClose() const;
 
@@ -194,6 +207,7 @@ private:
 
   const std::shared_ptr<render::scene::ShaderManager> m_shaderManager{};
   const std::shared_ptr<render::scene::CSM> m_csm{};
+  const std::shared_ptr<render::scene::ClusteredLighting> m_clusteredLighting;
   const std::unique_ptr<render::scene::MaterialManager> m_materialManager;
 
   const std::unique_ptr<render::RenderPipeline> m_renderPipeline;
@@ -201,6 +215,24 @@ private:
 
   bool m_showDebugInfo = false;
 
+  bool m_occlusionCulling = true;
+  render::OcclusionQueryTracker m_occlusionQueryTracker{};
+  std::vector<std::unique_ptr<gl::Query<gl::api::QueryTarget::AnySamplesPassedConservative>>> m_occlusionQueries;
+  const loader::file::Room* m_occlusionQueryRooms = nullptr;
+  std::vector<size_t> m_occlusionQueryCandidates;
+  std::vector<size_t> m_occludedRooms;
+
+  std::vector<uint32_t> m_clusteredLightIndices;
+
   void scaleSplashImage();
+
+  void updateClusteredLighting(const std::vector<loader::file::Room>& rooms,
+                               const RoomLightNeighbourhoods& roomLightNeighbourhoods);
+
+  void hideOccludedRooms(const std::vector<loader::file::Room>& rooms, const glm::vec3& cameraPosition);
+  void issueOcclusionQueries(const std::vector<loader::file::Room>& rooms, const glm::mat4& viewProjection);
+  void restoreOccludedRooms(const std::vector<loader::file::Room>& rooms);
+
+  void drawProfilerSummary();
 };
 } // namespace engine
@@ -49,100 +49,220 @@ enum class CollisionType
   None      // resulting position is valid and needs no further adjustment
 };
 
-std::pair<CollisionType, core::RoomBoundPosition> clampSteps(const core::RoomBoundPosition& from,
-                                                             const core::TRVec& goal,
-                                                             const ObjectManager& objectManager,
-                                                             core::Length(core::TRVec::*stepAxis),
-                                                             core::Length(core::TRVec::*secondaryAxis))
+//! The sector boundary crossings along one horizontal axis of a ray, i.e. one axis of a grid DDA; each crossing tests
+//! the sectors on both sides of the boundary
+class AxisTrace final
 {
-  core::RoomBoundPosition result{from.room, goal};
-  if(goal.*stepAxis == from.position.*stepAxis)
+public:
+  explicit AxisTrace(const core::RoomBoundPosition& from,
+                     const core::TRVec& goal,
+                     const ObjectManager& objectManager,
+                     core::Length(core::TRVec::*stepAxis),
+                     core::Length(core::TRVec::*secondaryAxis))
+      : m_objectManager{objectManager}
+      , m_stepAxis{stepAxis}
+      , m_from{from.position.*stepAxis}
+      , m_result{from.room, goal}
   {
-    return {CollisionType::None, result};
-  }
+    if(goal.*stepAxis == from.position.*stepAxis)
+    {
+      m_collision = CollisionType::None;
+      return;
+    }
 
-  const auto delta = goal - from.position;
-  const auto dir = delta.*stepAxis < 0_len ? -1 : 1;
+    const auto delta = goal - from.position;
+    m_delta = delta.*stepAxis;
+    m_dir = delta.*stepAxis < 0_len ? -1 : 1;
 
-  core::TRVec current;
-  current.*stepAxis = (from.position.*stepAxis / core::SectorSize) * core::SectorSize;
-  if(dir > 0)
-    current.*stepAxis += core::SectorSize - 1_len;
+    m_current.*stepAxis = (from.position.*stepAxis / core::SectorSize) * core::SectorSize;
+    if(m_dir > 0)
+      m_current.*stepAxis += core::SectorSize - 1_len;
 
-  current.*secondaryAxis = from.position.*secondaryAxis
-                           + (current.*stepAxis - from.position.*stepAxis) * delta.*secondaryAxis / delta.*stepAxis;
-  current.Y = from.position.Y + (current.*stepAxis - from.position.*stepAxis) * delta.Y / delta.*stepAxis;
+    m_current.*secondaryAxis
+      = from.position.*secondaryAxis
+        + (m_current.*stepAxis - from.position.*stepAxis) * delta.*secondaryAxis / delta.*stepAxis;
+    m_current.Y = from.position.Y + (m_current.*stepAxis - from.position.*stepAxis) * delta.Y / delta.*stepAxis;
 
-  core::TRVec step;
-  step.*stepAxis = dir * core::SectorSize;
-  step.*secondaryAxis = step.*stepAxis * delta.*secondaryAxis / delta.*stepAxis;
-  step.Y = step.*stepAxis * delta.Y / delta.*stepAxis;
+    m_step.*stepAxis = m_dir * core::SectorSize;
+    m_step.*secondaryAxis = m_step.*stepAxis * delta.*secondaryAxis / delta.*stepAxis;
+    m_step.Y = m_step.*stepAxis * delta.Y / delta.*stepAxis;
+  }
+
+  [[nodiscard]] bool isDone() const noexcept
+  {
+    return m_collision.has_value();
+  }
 
-  auto testVerticalHit = [&result, &objectManager](const core::TRVec& pos) {
-    const auto sector = findRealFloorSector(pos, &result.room);
-    const auto floor = HeightInfo::fromFloor(sector, pos, objectManager.getObjects()).y;
-    const auto ceiling = HeightInfo::fromCeiling(sector, pos, objectManager.getObjects()).y;
-    return pos.Y > floor || pos.Y < ceiling;
-  };
+  //! The fraction of the ray covered up to the next crossing
+  [[nodiscard]] float getProgress() const
+  {
+    BOOST_ASSERT(!isDone());
+    return (m_current.*m_stepAxis - m_from).get<float>() / m_delta.get<float>();
+  }
 
-  while(true)
+  //! Tests the next crossing
+  void advance()
   {
-    if(dir > 0 && current.*stepAxis >= result.position.*stepAxis)
+    BOOST_ASSERT(!isDone());
+
+    if(m_dir > 0 && m_current.*m_stepAxis >= m_result.position.*m_stepAxis)
     {
-      return {CollisionType::None, result};
+      m_collision = CollisionType::None;
+      return;
     }
-    if(dir < 0 && current.*stepAxis <= result.position.*stepAxis)
+    if(m_dir < 0 && m_current.*m_stepAxis <= m_result.position.*m_stepAxis)
     {
-      return {CollisionType::None, result};
+      m_collision = CollisionType::None;
+      return;
     }
 
-    if(testVerticalHit(current))
+    if(testVerticalHit(m_current))
     {
-      result.position = current;
-      return {CollisionType::Vertical, result};
+      m_result.position = m_current;
+      m_collision = CollisionType::Vertical;
+      return;
     }
 
-    auto nextSector = current;
-    nextSector.*stepAxis += dir * 1_len;
-    BOOST_ASSERT(current.*stepAxis / core::SectorSize != nextSector.*stepAxis / core::SectorSize);
+    auto nextSector = m_current;
+    nextSector.*m_stepAxis += m_dir * 1_len;
+    BOOST_ASSERT(m_current.*m_stepAxis / core::SectorSize != nextSector.*m_stepAxis / core::SectorSize);
     if(testVerticalHit(nextSector))
     {
-      result.position = current;
-      return {CollisionType::Wall, result};
+      m_result.position = m_current;
+      m_collision = CollisionType::Wall;
+      return;
     }
 
-    current += step;
+    m_current += m_step;
+  }
+
+  void run()
+  {
+    while(!isDone())
+      advance();
+  }
+
+  [[nodiscard]] CollisionType getCollision() const
+  {
+    BOOST_ASSERT(isDone());
+    return *m_collision;
+  }
+
+  [[nodiscard]] const core::RoomBoundPosition& getResult() const noexcept
+  {
+    return m_result;
+  }
+
+private:
+  const ObjectManager& m_objectManager;
+  core::Length(core::TRVec::*m_stepAxis);
+  core::Length m_from;
+  core::Length m_delta = 1_len;
+  int m_dir = 0;
+  core::TRVec m_current{};
+  core::TRVec m_step{};
+  //! The room is followed incrementally from the previous crossing
+  core::RoomBoundPosition m_result;
+  std::optional<CollisionType> m_collision{};
+
+  bool testVerticalHit(const core::TRVec& pos)
+  {
+    const auto sector = findRealFloorSector(pos, &m_result.room);
+    if(pos.Y > HeightInfo::fromFloor(sector, pos, m_objectManager.getObjects()).y)
+      return true;
+    return pos.Y < HeightInfo::fromCeiling(sector, pos, m_objectManager.getObjects()).y;
   }
+};
+
+using AxisPair = std::pair<core::Length(core::TRVec::*), core::Length(core::TRVec::*)>;
+
+//! The minor axis is stepped first, see raycastLineOfSight
+AxisPair getAxes(const core::RoomBoundPosition& start, const core::TRVec& goal)
+{
+  if(abs(goal.Z - start.position.Z) <= abs(goal.X - start.position.X))
+    return {&core::TRVec::Z, &core::TRVec::X};
+  return {&core::TRVec::X, &core::TRVec::Z};
 }
 
+/*
+ * Walks the crossings of both axes towards the goal in the order they occur along the ray, i.e. a DDA over the sector
+ * grid with the vertical position tested at each crossing, and stops at the first blocked crossing. Each axis follows
+ * its own room and samples the same points as the separate passes of raycastLineOfSight, so if no crossing is
+ * blocked, the second axis' result is exactly the one of the second pass. Returns std::nullopt if any crossing is
+ * blocked.
+ */
+std::optional<core::RoomBoundPosition>
+  traceInterleaved(const core::RoomBoundPosition& start, const core::TRVec& goal, const ObjectManager& objectManager)
+{
+  const auto [firstAxis, secondAxis] = getAxes(start, goal);
+  AxisTrace first{start, goal, objectManager, firstAxis, secondAxis};
+  AxisTrace second{start, goal, objectManager, secondAxis, firstAxis};
+
+  while(!first.isDone() || !second.isDone())
+  {
+    auto& next = second.isDone() || (!first.isDone() && first.getProgress() <= second.getProgress()) ? first : second;
+    next.advance();
+    if(next.isDone() && next.getCollision() != CollisionType::None)
+      return std::nullopt;
+  }
+
+  return second.getResult();
+}
 } // namespace
 
 std::pair<bool, core::RoomBoundPosition>
   raycastLineOfSight(const core::RoomBoundPosition& start, const core::TRVec& goal, const ObjectManager& objectManager)
 {
-  auto collide =
-    [&start, &goal, &objectManager](
-      core::Length(core::TRVec::*firstStepAxis),
-      core::Length(core::TRVec::*secondStepAxis)) -> std::tuple<CollisionType, CollisionType, core::RoomBoundPosition> {
-    auto [firstType, firstPos] = clampSteps(start, goal, objectManager, firstStepAxis, secondStepAxis);
-    auto [secondType, secondPos] = clampSteps(start, firstPos.position, objectManager, secondStepAxis, firstStepAxis);
-    return {firstType, secondType, secondPos};
-  };
-
-  auto [firstCollision, secondCollision, result] = abs(goal.Z - start.position.Z) <= abs(goal.X - start.position.X)
-                                                     ? collide(&core::TRVec::Z, &core::TRVec::X)
-                                                     : collide(&core::TRVec::X, &core::TRVec::Z);
+  // the interleaved pass stops at the first blocked crossing; only then the separate passes are needed to find the
+  // position where the ray is stopped
+  if(auto result = traceInterleaved(start, goal, objectManager); result.has_value())
+  {
+    const auto sector = loader::file::findRealFloorSector(*result);
+    const bool success = clampY(start.position, *result, sector, objectManager);
+    Ensures(result->room->getSectorByAbsolutePosition(result->position) != nullptr);
+    return {success, *result};
+  }
+
+  const auto [firstAxis, secondAxis] = getAxes(start, goal);
+  AxisTrace first{start, goal, objectManager, firstAxis, secondAxis};
+  first.run();
+  AxisTrace second{start, first.getResult().position, objectManager, secondAxis, firstAxis};
+  second.run();
+
+  auto result = second.getResult();
   const auto invariantCheck = gsl::finally(
     [&result = result]() { Ensures(result.room->getSectorByAbsolutePosition(result.position) != nullptr); });
 
-  if(secondCollision == CollisionType::Wall)
+  if(second.getCollision() == CollisionType::Wall)
   {
     return {false, result};
   }
 
   const auto sector = loader::file::findRealFloorSector(result);
-  bool success = clampY(start.position, result, sector, objectManager) && firstCollision == CollisionType::None
-                 && secondCollision == CollisionType::None;
-  return {success, result};
+  clampY(start.position, result, sector, objectManager);
+  return {false, result};
+}
+
+bool hasLineOfSight(const core::RoomBoundPosition& start, const core::TRVec& goal, const ObjectManager& objectManager)
+{
+  auto result = traceInterleaved(start, goal, objectManager);
+  if(!result.has_value())
+    return false;
+
+  const auto sector = loader::file::findRealFloorSector(*result);
+  return clampY(start.position, *result, sector, objectManager);
+}
+
+std::optional<size_t> findFirstLineOfSight(const core::RoomBoundPosition& start,
+                                           const std::vector<core::TRVec>& goals,
+                                           const ObjectManager& objectManager)
+{
+  for(size_t i = 0; i < goals.size(); ++i)
+  {
+    if(hasLineOfSight(start, goals[i], objectManager))
+      return i;
+  }
+
+  return std::nullopt;
 }
 } // namespace engine
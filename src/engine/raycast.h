@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace core
 {
@@ -15,4 +17,15 @@ class ObjectManager;
 extern std::pair<bool, core::RoomBoundPosition> raycastLineOfSight(const core::RoomBoundPosition& firstStepAxis,
                                                                    const core::TRVec& secondStepAxis,
                                                                    const ObjectManager& objectManager);
+
+//! Like raycastLineOfSight().first, but stops tracing at the first blocked sector boundary
+extern bool hasLineOfSight(const core::RoomBoundPosition& start,
+                           const core::TRVec& goal,
+                           const ObjectManager& objectManager);
+
+//! Casts rays from \p start to the goals in order and stops at the first one that isn't blocked; order the goals by
+//! preference so that the rays behind the first visible one are never traced
+extern std::optional<size_t> findFirstLineOfSight(const core::RoomBoundPosition& start,
+                                                  const std::vector<core::TRVec>& goals,
+                                                  const ObjectManager& objectManager);
 } // namespace engine
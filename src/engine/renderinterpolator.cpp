@@ -0,0 +1,138 @@
+#include "renderinterpolator.h"
+
+#include "core/magic.h"
+#include "objectmanager.h"
+#include "objects/object.h"
+#include "render/scene/camera.h"
+#include "render/scene/interpolation.h"
+#include "skeletalmodelnode.h"
+
+namespace engine
+{
+namespace
+{
+//! Anything moving farther than this within a single step has been teleported, and is not interpolated
+constexpr float MaxStepDistance = static_cast<float>((2 * core::SectorSize).get());
+
+bool isContinuous(const glm::mat4& previous, const glm::mat4& current)
+{
+  return glm::distance(glm::vec3{previous[3]}, glm::vec3{current[3]}) <= MaxStepDistance;
+}
+} // namespace
+
+void RenderInterpolator::capture(const ObjectManager& objectManager, const render::scene::Camera& camera)
+{
+  auto previousNodes = std::move(m_nodes);
+  m_nodes.clear();
+
+  const auto captureNode = [this, &previousNodes](const std::shared_ptr<render::scene::Node>& node) {
+    NodeTransforms transforms;
+    transforms.node = node;
+    transforms.parent = node->getParent().lock().get();
+    transforms.current = node->getLocalMatrix();
+    if(const auto skeleton = dynamic_cast<const SkeletalModelNode*>(node.get()))
+    {
+      transforms.currentBones.reserve(skeleton->getBoneCount());
+      for(size_t i = 0; i < skeleton->getBoneCount(); ++i)
+        transforms.currentBones.emplace_back(skeleton->getMeshMatrix(i));
+    }
+
+    // nodes that are new, have changed their room, or have been teleported start without interpolation
+    const auto it = previousNodes.find(node.get());
+    if(it != previousNodes.end() && !it->second.node.expired() && it->second.parent == transforms.parent
+       && isContinuous(it->second.current, transforms.current))
+    {
+      transforms.previous = it->second.current;
+      if(it->second.currentBones.size() == transforms.currentBones.size())
+        transforms.previousBones = std::move(it->second.currentBones);
+      else
+        transforms.previousBones = transforms.currentBones;
+    }
+    else
+    {
+      transforms.previous = transforms.current;
+      transforms.previousBones = transforms.currentBones;
+    }
+
+    m_nodes.emplace(node.get(), std::move(transforms));
+  };
+
+  for(const auto& object : objectManager.getObjects())
+    captureNode(object->getNode());
+  for(const auto& object : objectManager.getDynamicObjects())
+    captureNode(object->getNode());
+
+  const auto& cameraTransform = camera.getInverseViewMatrix();
+  if(m_currentCamera.has_value() && isContinuous(*m_currentCamera, cameraTransform))
+    m_previousCamera = m_currentCamera;
+  else
+    m_previousCamera = cameraTransform;
+  m_currentCamera = cameraTransform;
+  m_currentView = camera.getViewMatrix();
+}
+
+void RenderInterpolator::reset()
+{
+  m_nodes.clear();
+  m_previousCamera.reset();
+  m_currentCamera.reset();
+}
+
+void RenderInterpolator::apply(const float alpha, render::scene::Camera& camera) const
+{
+  if(alpha >= 1)
+    return;
+
+  for(const auto& entry : m_nodes)
+  {
+    const auto& transforms = entry.second;
+    const auto node = transforms.node.lock();
+    if(node == nullptr)
+      continue;
+
+    node->setLocalMatrix(render::scene::interpolateTransform(transforms.previous, transforms.current, alpha));
+
+    if(transforms.currentBones.empty())
+      continue;
+
+    auto& skeleton = static_cast<SkeletalModelNode&>(*node);
+    if(skeleton.getBoneCount() != transforms.currentBones.size())
+      continue;
+
+    for(size_t i = 0; i < transforms.currentBones.size(); ++i)
+    {
+      skeleton.setMeshMatrix(
+        i, render::scene::interpolateTransform(transforms.previousBones[i], transforms.currentBones[i], alpha));
+    }
+  }
+
+  if(m_currentCamera.has_value())
+    camera.setViewMatrix(glm::inverse(render::scene::interpolateTransform(*m_previousCamera, *m_currentCamera, alpha)));
+}
+
+void RenderInterpolator::restore(render::scene::Camera& camera) const
+{
+  for(const auto& entry : m_nodes)
+  {
+    const auto& transforms = entry.second;
+    const auto node = transforms.node.lock();
+    if(node == nullptr)
+      continue;
+
+    node->setLocalMatrix(transforms.current);
+
+    if(transforms.currentBones.empty())
+      continue;
+
+    auto& skeleton = static_cast<SkeletalModelNode&>(*node);
+    if(skeleton.getBoneCount() != transforms.currentBones.size())
+      continue;
+
+    for(size_t i = 0; i < transforms.currentBones.size(); ++i)
+      skeleton.setMeshMatrix(i, transforms.currentBones[i]);
+  }
+
+  if(m_currentCamera.has_value())
+    camera.setViewMatrix(m_currentView);
+}
+} // namespace engine
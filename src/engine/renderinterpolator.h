@@ -0,0 +1,57 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace render::scene
+{
+class Camera;
+class Node;
+} // namespace render::scene
+
+namespace engine
+{
+class ObjectManager;
+
+//! Smooths rendering at frame rates above the simulation rate by interpolating the object transforms, bone matrices
+//! and the camera between the two most recent simulation steps.
+//!
+//! The interpolated transforms are only applied while rendering, so the simulation always sees the exact transforms
+//! of the last step.
+class RenderInterpolator final
+{
+public:
+  //! Records the transforms of the simulation step that has just finished
+  void capture(const ObjectManager& objectManager, const render::scene::Camera& camera);
+
+  //! Forgets the recorded steps, so that the next frames are not interpolated across a discontinuity
+  void reset();
+
+  //! Sets the transforms @a alpha of the way from the previous to the last step; restore() must be called after
+  //! rendering
+  void apply(float alpha, render::scene::Camera& camera) const;
+
+  //! Sets the transforms of the last step again
+  void restore(render::scene::Camera& camera) const;
+
+private:
+  struct NodeTransforms
+  {
+    std::weak_ptr<render::scene::Node> node;
+    const render::scene::Node* parent = nullptr;
+    glm::mat4 previous{1.0f};
+    glm::mat4 current{1.0f};
+    std::vector<glm::mat4> previousBones;
+    std::vector<glm::mat4> currentBones;
+  };
+
+  std::unordered_map<const render::scene::Node*, NodeTransforms> m_nodes;
+  //! The inverse view matrices, i.e. the camera transforms, of the last two steps
+  std::optional<glm::mat4> m_previousCamera;
+  std::optional<glm::mat4> m_currentCamera;
+  glm::mat4 m_currentView{1.0f};
+};
+} // namespace engine
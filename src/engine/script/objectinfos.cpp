@@ -0,0 +1,37 @@
+#include "objectinfos.h"
+
+#include "engine/items_tr1.h"
+
+#include <boost/range/adaptor/map.hpp>
+#include <boost/throw_exception.hpp>
+#include <gsl-lite.hpp>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace engine::script
+{
+ObjectInfos ObjectInfos::fromScript(const pybind11::object& getObjectInfo)
+{
+  ObjectInfos result;
+  for(const auto& type : EnumUtil<TR1ItemId>::all() | boost::adaptors::map_keys)
+  {
+    const auto id = gsl::narrow<core::TypeId::type>(static_cast<std::underlying_type_t<TR1ItemId>>(type));
+    if(id >= result.m_infos.size())
+      result.m_infos.resize(size_t{id} + 1);
+
+    result.m_infos[id] = getObjectInfo(id).cast<ObjectInfo>();
+  }
+  return result;
+}
+
+const ObjectInfo& ObjectInfos::get(const core::TypeId& type) const
+{
+  const auto index = static_cast<size_t>(type.get());
+  if(index >= m_infos.size() || !m_infos[index].has_value())
+    BOOST_THROW_EXCEPTION(std::out_of_range("No object info for type " + std::to_string(index)));
+
+  return *m_infos[index];
+}
+} // namespace engine::script
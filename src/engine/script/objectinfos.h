@@ -0,0 +1,42 @@
+#pragma once
+
+#include "core/id.h"
+#include "core/units.h"
+
+#include <optional>
+#include <vector>
+
+namespace pybind11
+{
+class object;
+}
+
+namespace engine::script
+{
+struct ObjectInfo
+{
+  bool ai_agent = false;
+  core::Length::type radius = 10;
+  core::Health::type hit_points = -16384;
+  core::Length::type pivot_length = 0;
+  int target_update_chance = 0;
+};
+
+//! The ObjectInfo of every object type, materialized from the script once per level, so that the simulation does not
+//! need to call into the script
+class ObjectInfos final
+{
+public:
+  ObjectInfos() = default;
+
+  //! Calls the script function @a getObjectInfo for every TR1ItemId
+  static ObjectInfos fromScript(const pybind11::object& getObjectInfo);
+
+  //! Throws std::out_of_range for unknown types
+  [[nodiscard]] const ObjectInfo& get(const core::TypeId& type) const;
+
+private:
+  //! Indexed by the type id
+  std::vector<std::optional<ObjectInfo>> m_infos;
+};
+} // namespace engine::script
@@ -8,9 +8,11 @@
 #include "engine/player.h"
 #include "engine/presenter.h"
 #include "engine/world.h"
+#include "hid/inputrecording.h"
 #include "loader/file/level/level.h"
+#include "util/profiler.h"
 
-#include <boost/range/adaptors.hpp>
+#include <chrono>
 
 namespace engine::script
 {
@@ -24,6 +26,7 @@ std::filesystem::path getLocalLevelPath(const std::string& basename)
 std::unique_ptr<loader::file::level::Level>
   loadLevel(Engine& engine, const std::string& basename, const std::string& title)
 {
+  UTIL_PROFILE_ZONE("load-level-file");
   engine.getPresenter().drawLoadingScreen(engine.i18n()(I18n::LoadingLevel, title));
   auto level = loader::file::level::Level::createLoader(engine.getRootPath() / getLocalLevelPath(basename),
                                                         loader::file::level::Game::Unknown);
@@ -64,12 +67,12 @@ std::pair<RunResult, std::optional<size_t>> Cutscene::run(Engine& engine, const
   {
     const auto& laraPistol = world->findAnimatedModelForType(TR1ItemId::LaraPistolsAnim);
     Expects(laraPistol != nullptr);
-    for(const auto& object : world->getObjectManager().getObjects() | boost::adaptors::map_values)
+    for(const auto& object : world->getObjectManager().getObjects())
     {
       if(object->m_state.type != TR1ItemId::CutsceneActor1)
         continue;
 
-      auto m = std::dynamic_pointer_cast<objects::ModelObject>(object.get());
+      auto m = std::dynamic_pointer_cast<objects::ModelObject>(object);
       Expects(m != nullptr);
       m->getSkeleton()->setMeshPart(1, laraPistol->bones[1].mesh);
       m->getSkeleton()->setMeshPart(4, laraPistol->bones[4].mesh);
@@ -148,6 +151,23 @@ std::pair<RunResult, std::optional<size_t>>
   return engine.run(*world, false, m_allowSave);
 }
 
+void Level::runBenchmark(Engine& engine, const BenchmarkSettings& settings, const std::shared_ptr<Player>& player)
+{
+  const auto loadStart = std::chrono::high_resolution_clock::now();
+  auto world = loadWorld(engine, player);
+  const auto loadTime = std::chrono::high_resolution_clock::now() - loadStart;
+
+  auto replay = settings.replay;
+  if(settings.replayDemo)
+  {
+    replay = std::make_shared<const hid::InputRecording>(
+      hid::InputRecording::fromTr1Demo(settings.levelSequenceIndex, world->getLevel().m_demoData));
+  }
+
+  engine.runBenchmark(
+    *world, std::chrono::duration_cast<std::chrono::microseconds>(loadTime), settings.steps, replay.get());
+}
+
 std::pair<RunResult, std::optional<size_t>> TitleMenu::run(Engine& engine, const std::shared_ptr<Player>& player)
 {
   player->getInventory().clear();
@@ -5,6 +5,7 @@
 #include "core/id.h"
 #include "core/units.h"
 #include "engine/tracks_tr1.h"
+#include "objectinfos.h"
 
 #include <boost/log/trivial.hpp>
 #include <filesystem>
@@ -15,19 +16,11 @@ namespace engine
 enum class RunResult;
 class Engine;
 class Player;
+struct BenchmarkSettings;
 } // namespace engine
 
 namespace engine::script
 {
-struct ObjectInfo
-{
-  bool ai_agent = false;
-  core::Length::type radius = 10;
-  core::Health::type hit_points = -16384;
-  core::Length::type pivot_length = 0;
-  int target_update_chance = 0;
-};
-
 struct TrackInfo
 {
   TrackInfo(core::SoundEffectId::type id, audio::TrackType type)
@@ -52,6 +45,14 @@ public:
     BOOST_THROW_EXCEPTION(std::runtime_error("Cannot run from save"));
   }
 
+  //! Loads the item and runs its simulation as fast as possible
+  virtual void
+    runBenchmark(Engine& /*engine*/, const BenchmarkSettings& /*settings*/, const std::shared_ptr<Player>& /*player*/)
+  {
+    BOOST_LOG_TRIVIAL(error) << "Cannot run a benchmark";
+    BOOST_THROW_EXCEPTION(std::runtime_error("Cannot run a benchmark"));
+  }
+
   [[nodiscard]] virtual bool isLevel(const std::filesystem::path& path) const = 0;
 };
 
@@ -96,6 +97,7 @@ public:
   std::pair<RunResult, std::optional<size_t>> run(Engine& engine, const std::shared_ptr<Player>& player) override;
   std::pair<RunResult, std::optional<size_t>>
     runFromSave(Engine& engine, const std::optional<size_t>& slot, const std::shared_ptr<Player>& player) override;
+  void runBenchmark(Engine& engine, const BenchmarkSettings& settings, const std::shared_ptr<Player>& player) override;
 
   bool isLevel(const std::filesystem::path& path) const override;
 };
@@ -0,0 +1,64 @@
+#define BOOST_TEST_MODULE script_test
+
+#include "engine/items_tr1.h"
+#include "objectinfos.h"
+
+#include <boost/test/included/unit_test.hpp>
+#include <limits>
+#include <pybind11/embed.h>
+
+using namespace engine::script;
+namespace py = pybind11;
+
+// the parts of the engine module used by the object infos script
+PYBIND11_EMBEDDED_MODULE(engine, m)
+{
+  py::class_<ObjectInfo>(m, "ObjectInfo")
+    .def(py::init<>())
+    .def_readwrite("ai_agent", &ObjectInfo::ai_agent)
+    .def_readwrite("radius", &ObjectInfo::radius)
+    .def_readwrite("hit_points", &ObjectInfo::hit_points)
+    .def_readwrite("pivot_length", &ObjectInfo::pivot_length)
+    .def_readwrite("target_update_chance", &ObjectInfo::target_update_chance);
+
+  auto e = py::enum_<engine::TR1ItemId>(m, "TR1ItemId");
+  for(const auto& [key, value] : engine::EnumUtil<engine::TR1ItemId>::all())
+    e.value(value.c_str(), key);
+}
+
+BOOST_AUTO_TEST_SUITE(object_infos_tests)
+
+BOOST_AUTO_TEST_CASE(test_matches_script)
+{
+  const py::scoped_interpreter interpreter{};
+  py::module::import("sys").attr("path").cast<py::list>().append(SCRIPTS_ROOT);
+
+  const py::dict scriptInfos = py::module::import("scripts.tr1.object_infos").attr("object_infos");
+  const py::object itemIdType = py::module::import("engine").attr("TR1ItemId");
+  const py::object getObjectInfo
+    = py::cpp_function([&scriptInfos, &itemIdType](const int id) { return scriptInfos[itemIdType(id)]; });
+
+  const auto infos = ObjectInfos::fromScript(getObjectInfo);
+
+  for(const auto& [type, name] : engine::EnumUtil<engine::TR1ItemId>::all())
+  {
+    BOOST_TEST_CONTEXT(name)
+    {
+      const auto& expected = scriptInfos[py::cast(type)].cast<const ObjectInfo&>();
+      const auto& info = infos.get(core::TypeId{type});
+      BOOST_CHECK_EQUAL(info.ai_agent, expected.ai_agent);
+      BOOST_CHECK_EQUAL(info.radius, expected.radius);
+      BOOST_CHECK_EQUAL(info.hit_points, expected.hit_points);
+      BOOST_CHECK_EQUAL(info.pivot_length, expected.pivot_length);
+      BOOST_CHECK_EQUAL(info.target_update_chance, expected.target_update_chance);
+    }
+  }
+
+  const auto& wolf = infos.get(core::TypeId{engine::TR1ItemId::Wolf});
+  BOOST_CHECK(wolf.ai_agent);
+  BOOST_CHECK_EQUAL(wolf.radius, 341);
+
+  BOOST_CHECK_THROW(infos.get(core::TypeId{std::numeric_limits<core::TypeId::type>::max()}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
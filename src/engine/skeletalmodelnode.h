@@ -124,6 +124,11 @@ public:
     return m_meshParts.size();
   }
 
+  [[nodiscard]] const glm::mat4& getMeshMatrix(size_t idx) const
+  {
+    return m_meshParts.at(idx).matrix;
+  }
+
   void setMeshMatrix(size_t idx, const glm::mat4& m)
   {
     m_meshParts.at(idx).matrix = m;
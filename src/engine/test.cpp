@@ -0,0 +1,754 @@
+#define BOOST_TEST_MODULE engine_test
+
+#include "loader/file/datatypes.h"
+#include "particlebuffer.h"
+#include "throttler.h"
+
+#ifdef EDISONENGINE_HEADLESS
+#  include "cameracontroller.h"
+#  include "engine.h"
+#  include "heightinfo.h"
+#  include "hid/inputhandler.h"
+#  include "hid/inputrecording.h"
+#  include "loader/file/level/level.h"
+#  include "objectmanager.h"
+#  include "objects/aiagent.h"
+#  include "objects/laraobject.h"
+#  include "player.h"
+#  include "presenter.h"
+#  include "raycast.h"
+#  include "render/scene/camera.h"
+#  include "render/scene/interpolation.h"
+#  include "renderinterpolator.h"
+#  include "skeletalmodelnode.h"
+#  include "world.h"
+#endif
+
+#include <boost/test/included/unit_test.hpp>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace std::chrono_literals;
+
+namespace
+{
+const auto StepDuration = std::chrono::ceil<FixedStepClock::Clock::duration>(FixedStepClock::StepDuration{1});
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(fixed_step_clock_tests)
+
+BOOST_AUTO_TEST_CASE(test_steps)
+{
+  const FixedStepClock::Clock::time_point start{};
+  FixedStepClock clock{start};
+  BOOST_CHECK_EQUAL(clock.advance(start + 10ms), 0u);
+  BOOST_CHECK_CLOSE(clock.getAlpha(), 0.3f, 0.01f);
+  BOOST_CHECK_EQUAL(clock.advance(start + 40ms), 1u);
+  BOOST_CHECK_EQUAL(clock.advance(start + 100ms), 2u);
+  BOOST_CHECK(clock.getNextStepTime() == start + 100ms + StepDuration);
+
+  // a stalled frame slows down the game instead of running all missed steps
+  BOOST_CHECK_EQUAL(clock.advance(start + 1100ms), FixedStepClock::MaxStepsPerFrame);
+  BOOST_CHECK_LE(clock.getAlpha(), 1.0f);
+
+  clock.reset(start + 2s);
+  BOOST_CHECK_EQUAL(clock.getAlpha(), 0.0f);
+  BOOST_CHECK_EQUAL(clock.advance(start + 2s + 20ms), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(particle_buffer_tests)
+
+BOOST_AUTO_TEST_CASE(test_storage_grows_past_initial_capacity)
+{
+  const loader::file::Room room{};
+  ParticleBuffer buffer;
+  const auto* const positions = buffer.positions.data();
+
+  for(size_t i = 0; i < ParticleBuffer::InitialCapacity; ++i)
+    BOOST_CHECK_EQUAL(buffer.add(core::RoomBoundPosition{&room, core::TRVec{}}), i);
+  BOOST_CHECK_EQUAL(buffer.positions.data(), positions);
+
+  // like the original particle list, effects are never dropped
+  BOOST_CHECK_EQUAL(buffer.add(core::RoomBoundPosition{&room, core::TRVec{}}), ParticleBuffer::InitialCapacity);
+  BOOST_CHECK_EQUAL(buffer.size(), ParticleBuffer::InitialCapacity + 1);
+  BOOST_CHECK_EQUAL(buffer.rooms.size(), buffer.size());
+  BOOST_CHECK_EQUAL(buffer.spriteFrames.size(), buffer.size());
+}
+
+BOOST_AUTO_TEST_CASE(test_remove_moves_last)
+{
+  const loader::file::Room room{};
+  ParticleBuffer buffer;
+  for(int i = 0; i < 3; ++i)
+  {
+    const auto idx = buffer.add(core::RoomBoundPosition{&room, core::TRVec{core::Length{i}, 0_len, 0_len}});
+    buffer.timers[idx] = gsl::narrow<int16_t>(i);
+    buffer.spriteFrames[idx] = gsl::narrow<uint16_t>(i);
+  }
+
+  buffer.remove(0);
+  BOOST_REQUIRE_EQUAL(buffer.size(), 2);
+  BOOST_CHECK_EQUAL(buffer.positions[0].X.get(), 2);
+  BOOST_CHECK_EQUAL(buffer.timers[0], 2);
+  BOOST_CHECK_EQUAL(buffer.spriteFrames[0], 2);
+  BOOST_CHECK_EQUAL(buffer.positions[1].X.get(), 1);
+  BOOST_CHECK_EQUAL(buffer.timers[1], 1);
+
+  buffer.remove(1);
+  BOOST_REQUIRE_EQUAL(buffer.size(), 1);
+  BOOST_CHECK_EQUAL(buffer.positions[0].X.get(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_instances_of_visible_rooms)
+{
+  const loader::file::Room visibleRoom{};
+  const loader::file::Room hiddenRoom{};
+  ParticleBuffer buffer;
+
+  const core::TRVec a{100_len, -200_len, 300_len};
+  const core::TRVec b{400_len, 500_len, 600_len};
+  buffer.spriteFrames[buffer.add(core::RoomBoundPosition{&visibleRoom, a})] = 3;
+  buffer.spriteFrames[buffer.add(core::RoomBoundPosition{&hiddenRoom, b})] = 4;
+  buffer.spriteFrames[buffer.add(core::RoomBoundPosition{&visibleRoom, b})] = 5;
+
+  std::vector<glm::vec4> instances;
+  buffer.collectInstances([&visibleRoom](const loader::file::Room& room) { return &room == &visibleRoom; },
+                          instances);
+
+  BOOST_REQUIRE_EQUAL(instances.size(), 2);
+  BOOST_CHECK(glm::vec3{instances[0]} == a.toRenderSystem());
+  BOOST_CHECK_EQUAL(instances[0].w, 3.0f);
+  BOOST_CHECK(glm::vec3{instances[1]} == b.toRenderSystem());
+  BOOST_CHECK_EQUAL(instances[1].w, 5.0f);
+
+  // instances are appended, so that the caller controls when the list is reset
+  buffer.collectInstances([](const loader::file::Room&) { return true; }, instances);
+  BOOST_CHECK_EQUAL(instances.size(), 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#ifdef EDISONENGINE_HEADLESS
+namespace
+{
+//! The engine can only exist once per process because of the embedded interpreter, so all tests share it
+struct HeadlessEngine
+{
+  static inline std::unique_ptr<Engine> instance;
+
+  HeadlessEngine()
+  {
+    instance = std::make_unique<Engine>(TEST_ROOT);
+  }
+
+  ~HeadlessEngine()
+  {
+    instance.reset();
+  }
+};
+
+std::unique_ptr<World> loadTestWorld()
+{
+  auto level = loader::file::level::Level::createLoader(
+    HeadlessEngine::instance->getRootPath() / "data" / "tr1" / "DATA" / "LEVEL1.PHD", loader::file::level::Game::Unknown);
+  level->loadFileData();
+  return std::make_unique<World>(*HeadlessEngine::instance,
+                                 std::move(level),
+                                 std::string{"test"},
+                                 std::nullopt,
+                                 false,
+                                 std::unordered_map<std::string, std::unordered_map<TR1ItemId, std::string>>{},
+                                 std::make_shared<Player>());
+}
+
+//! Activates all creatures like a trigger would, so that they start hunting Lara
+void activateCreatures(World& world)
+{
+  for(const auto& object : world.getObjectManager().getObjects())
+  {
+    if(dynamic_cast<const objects::AIAgent*>(object.get()) == nullptr)
+      continue;
+
+    object->m_state.triggerState = objects::TriggerState::Active;
+    object->activate();
+  }
+}
+
+//! The state of all objects that the game logic decides upon, flattened for comparison
+std::vector<int64_t> getObjectStates(const World& world)
+{
+  std::vector<int64_t> states;
+  for(const auto& object : world.getObjectManager().getObjects())
+  {
+    const auto& state = object->m_state;
+    states.insert(states.end(),
+                  {state.position.position.X.get(),
+                   state.position.position.Y.get(),
+                   state.position.position.Z.get(),
+                   state.rotation.X.get(),
+                   state.rotation.Y.get(),
+                   state.rotation.Z.get(),
+                   state.health.get(),
+                   static_cast<int64_t>(state.triggerState),
+                   int64_t{object->m_isActive}});
+    if(state.creatureInfo == nullptr)
+      continue;
+
+    const auto& creatureInfo = *state.creatureInfo;
+    states.insert(states.end(),
+                  {static_cast<int64_t>(creatureInfo.mood),
+                   creatureInfo.target.X.get(),
+                   creatureInfo.target.Y.get(),
+                   creatureInfo.target.Z.get()});
+    const auto& search = *creatureInfo.pathFinder.search;
+    states.insert(states.end(), search.exitBoxes.begin(), search.exitBoxes.end());
+    for(size_t i = 0; i < search.visited.size(); ++i)
+      states.emplace_back(int64_t{search.visited.test(i)} | (int64_t{search.traversable.test(i)} << 1));
+  }
+  return states;
+}
+
+uint64_t hashStates(const std::vector<int64_t>& states)
+{
+  uint64_t hash = 14695981039346656037u;
+  for(const auto state : states)
+  {
+    hash ^= static_cast<uint64_t>(state);
+    hash *= 1099511628211u;
+  }
+  return hash;
+}
+
+//! A fixed input sequence that makes Lara run, turn, jump and draw her guns
+hid::ActionMask getScriptedActions(const size_t step)
+{
+  switch((step / 45) % 4)
+  {
+  case 0: return hid::toActionMask(hid::Action::Forward);
+  case 1: return hid::toActionMask(hid::Action::Forward) | hid::toActionMask(hid::Action::Left);
+  case 2: return hid::toActionMask(hid::Action::Forward) | hid::toActionMask(hid::Action::Jump);
+  default: return hid::toActionMask(hid::Action::Right) | hid::toActionMask(hid::Action::Action);
+  }
+}
+
+struct SimulationResult
+{
+  //! The hash of the object states after every step
+  std::vector<uint64_t> stepHashes;
+  std::vector<int64_t> finalStates;
+};
+
+//! Plays LEVEL1 with active creatures and the scripted input for @a duration, and renders frames at the intervals
+//! produced by @a nextFrameInterval, like Engine::run does with an uncapped frame rate
+template<typename F>
+SimulationResult simulateLevel(const FixedStepClock::Clock::duration& duration, const F& nextFrameInterval)
+{
+  // NOLINTNEXTLINE(cert-msc51-cpp)
+  std::srand(42);
+  const auto world = loadTestWorld();
+  activateCreatures(*world);
+  auto& presenter = world->getPresenter();
+
+  SimulationResult result;
+  const auto step = [&world, &presenter, &result]() {
+    presenter.getInputHandler().setActions(getScriptedActions(result.stepHashes.size()));
+    world->gameStep(false);
+    result.stepHashes.emplace_back(hashStates(getObjectStates(*world)));
+  };
+
+  const FixedStepClock::Clock::time_point start{};
+  FixedStepClock clock{start};
+  for(auto now = start; now < start + duration; now += nextFrameInterval())
+  {
+    for(auto steps = clock.advance(now); steps > 0; --steps)
+      step();
+
+    const auto alpha = clock.getAlpha();
+    BOOST_REQUIRE_GE(alpha, 0.0f);
+    BOOST_REQUIRE_LE(alpha, 1.0f);
+    BOOST_REQUIRE(clock.getNextStepTime() > now);
+    if(presenter.beginFrame())
+      world->renderFrame(alpha, true);
+  }
+  for(auto steps = clock.advance(start + duration); steps > 0; --steps)
+    step();
+
+  result.finalStates = getObjectStates(*world);
+  return result;
+}
+
+namespace legacy
+{
+// the line of sight test before the interleaved traversal
+bool clampY(const core::TRVec& start,
+            core::RoomBoundPosition& goal,
+            const gsl::not_null<const loader::file::Sector*>& sector,
+            const ObjectManager& objectManager)
+{
+  const auto delta = goal.position - start;
+
+  const auto goalFloor = HeightInfo::fromFloor(sector, goal.position, objectManager.getObjects()).y;
+  if(goalFloor < goal.position.Y && goalFloor > start.Y)
+  {
+    goal.position.Y = goalFloor;
+    const auto dy = goalFloor - start.Y;
+    goal.position.X = delta.X * dy / delta.Y + start.X;
+    goal.position.Z = delta.Z * dy / delta.Y + start.Z;
+    loader::file::findRealFloorSector(goal);
+    return false;
+  }
+
+  const auto goalCeiling = HeightInfo::fromCeiling(sector, goal.position, objectManager.getObjects()).y;
+  if(goalCeiling > goal.position.Y && goalCeiling < start.Y)
+  {
+    goal.position.Y = goalCeiling;
+    const auto dy = goalCeiling - start.Y;
+    goal.position.X = delta.X * dy / delta.Y + start.X;
+    goal.position.Z = delta.Z * dy / delta.Y + start.Z;
+    loader::file::findRealFloorSector(goal);
+    return false;
+  }
+
+  return true;
+}
+
+enum class CollisionType
+{
+  Vertical,
+  Wall,
+  None
+};
+
+std::pair<CollisionType, core::RoomBoundPosition> clampSteps(const core::RoomBoundPosition& from,
+                                                             const core::TRVec& goal,
+                                                             const ObjectManager& objectManager,
+                                                             core::Length(core::TRVec::*stepAxis),
+                                                             core::Length(core::TRVec::*secondaryAxis))
+{
+  core::RoomBoundPosition result{from.room, goal};
+  if(goal.*stepAxis == from.position.*stepAxis)
+  {
+    return {CollisionType::None, result};
+  }
+
+  const auto delta = goal - from.position;
+  const auto dir = delta.*stepAxis < 0_len ? -1 : 1;
+
+  core::TRVec current;
+  current.*stepAxis = (from.position.*stepAxis / core::SectorSize) * core::SectorSize;
+  if(dir > 0)
+    current.*stepAxis += core::SectorSize - 1_len;
+
+  current.*secondaryAxis = from.position.*secondaryAxis
+                           + (current.*stepAxis - from.position.*stepAxis) * delta.*secondaryAxis / delta.*stepAxis;
+  current.Y = from.position.Y + (current.*stepAxis - from.position.*stepAxis) * delta.Y / delta.*stepAxis;
+
+  core::TRVec step;
+  step.*stepAxis = dir * core::SectorSize;
+  step.*secondaryAxis = step.*stepAxis * delta.*secondaryAxis / delta.*stepAxis;
+  step.Y = step.*stepAxis * delta.Y / delta.*stepAxis;
+
+  auto testVerticalHit = [&result, &objectManager](const core::TRVec& pos) {
+    const auto sector = findRealFloorSector(pos, &result.room);
+    if(pos.Y > HeightInfo::fromFloor(sector, pos, objectManager.getObjects()).y)
+      return true;
+    return pos.Y < HeightInfo::fromCeiling(sector, pos, objectManager.getObjects()).y;
+  };
+
+  while(true)
+  {
+    if(dir > 0 && current.*stepAxis >= result.position.*stepAxis)
+      return {CollisionType::None, result};
+    if(dir < 0 && current.*stepAxis <= result.position.*stepAxis)
+      return {CollisionType::None, result};
+
+    if(testVerticalHit(current))
+    {
+      result.position = current;
+      return {CollisionType::Vertical, result};
+    }
+
+    auto nextSector = current;
+    nextSector.*stepAxis += dir * 1_len;
+    if(testVerticalHit(nextSector))
+    {
+      result.position = current;
+      return {CollisionType::Wall, result};
+    }
+
+    current += step;
+  }
+}
+
+std::pair<bool, core::RoomBoundPosition>
+  raycastLineOfSight(const core::RoomBoundPosition& start, const core::TRVec& goal, const ObjectManager& objectManager)
+{
+  auto collide = [&start, &goal, &objectManager](core::Length(core::TRVec::*firstStepAxis),
+                                                  core::Length(core::TRVec::*secondStepAxis)) {
+    auto [firstType, firstPos] = clampSteps(start, goal, objectManager, firstStepAxis, secondStepAxis);
+    auto [secondType, secondPos] = clampSteps(start, firstPos.position, objectManager, secondStepAxis, firstStepAxis);
+    return std::tuple{firstType, secondType, secondPos};
+  };
+
+  auto [firstCollision, secondCollision, result] = abs(goal.Z - start.position.Z) <= abs(goal.X - start.position.X)
+                                                     ? collide(&core::TRVec::Z, &core::TRVec::X)
+                                                     : collide(&core::TRVec::X, &core::TRVec::Z);
+  if(secondCollision == CollisionType::Wall)
+    return {false, result};
+
+  const auto sector = loader::file::findRealFloorSector(result);
+  bool success = clampY(start.position, result, sector, objectManager) && firstCollision == CollisionType::None
+                 && secondCollision == CollisionType::None;
+  return {success, result};
+}
+} // namespace legacy
+
+//! A random position within an inner sector of @a room that is neither a wall nor a portal, between its floor and
+//! ceiling
+std::optional<core::RoomBoundPosition> randomPosition(const loader::file::Room& room, std::mt19937& rng)
+{
+  if(room.sectorCountX < 3 || room.sectorCountZ < 3)
+    return std::nullopt;
+
+  std::uniform_int_distribution<int> x{1, room.sectorCountX - 2};
+  std::uniform_int_distribution<int> z{1, room.sectorCountZ - 2};
+  std::uniform_int_distribution<int> offset{0, core::SectorSize.get() - 1};
+  const auto sx = x(rng);
+  const auto sz = z(rng);
+  const auto sector = room.getSectorByIndex(sx, sz);
+  if(sector == nullptr || sector->portalTarget != nullptr || sector->floorHeight == -core::HeightLimit
+     || sector->floorHeight - sector->ceilingHeight < 2_len)
+    return std::nullopt;
+
+  std::uniform_int_distribution<core::Length::type> y{(sector->ceilingHeight + 1_len).get(),
+                                                      (sector->floorHeight - 1_len).get()};
+  return core::RoomBoundPosition{&room,
+                                 room.position
+                                   + core::TRVec{sx * core::SectorSize + core::Length{offset(rng)},
+                                                 core::Length{y(rng)},
+                                                 sz * core::SectorSize + core::Length{offset(rng)}}};
+}
+
+} // namespace
+
+BOOST_TEST_GLOBAL_FIXTURE(HeadlessEngine);
+
+BOOST_AUTO_TEST_SUITE(raycast_tests)
+
+BOOST_AUTO_TEST_CASE(test_matches_legacy_raycast)
+{
+  const auto world = loadTestWorld();
+  const auto& rooms = world->getRooms();
+  const auto& objectManager = world->getObjectManager();
+
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<size_t> anyRoom{0, rooms.size() - 1};
+  std::bernoulli_distribution sameRoom{0.5};
+
+  size_t visible = 0;
+  size_t blocked = 0;
+  for(size_t i = 0; i < 20000; ++i)
+  {
+    const auto& startRoom = rooms[anyRoom(rng)];
+    const auto start = randomPosition(startRoom, rng);
+    if(!start.has_value())
+      continue;
+
+    // rays within a room and into a neighbour are the common case, arbitrary rays cover long traversals
+    const loader::file::Room* goalRoom = &rooms[anyRoom(rng)];
+    if(sameRoom(rng))
+    {
+      goalRoom = &startRoom;
+      if(!startRoom.portals.empty())
+      {
+        std::uniform_int_distribution<size_t> anyPortal{0, startRoom.portals.size()};
+        if(const auto portal = anyPortal(rng); portal < startRoom.portals.size())
+          goalRoom = &rooms.at(startRoom.portals[portal].adjoining_room.get());
+      }
+    }
+    const auto goal = randomPosition(*goalRoom, rng);
+    if(!goal.has_value())
+      continue;
+
+    const auto [expectedSuccess, expectedPosition] = legacy::raycastLineOfSight(*start, goal->position, objectManager);
+    const auto [success, position] = raycastLineOfSight(*start, goal->position, objectManager);
+    BOOST_REQUIRE_EQUAL(success, expectedSuccess);
+    BOOST_REQUIRE_EQUAL(position.position, expectedPosition.position);
+    BOOST_REQUIRE_EQUAL(position.room.get(), expectedPosition.room.get());
+    BOOST_REQUIRE_EQUAL(hasLineOfSight(*start, goal->position, objectManager), expectedSuccess);
+
+    if(expectedSuccess)
+      ++visible;
+    else
+      ++blocked;
+  }
+
+  // both outcomes must be covered
+  BOOST_CHECK_GT(visible, 100);
+  BOOST_CHECK_GT(blocked, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(object_manager_tests)
+
+BOOST_AUTO_TEST_CASE(test_rooms_within_are_connected_rooms_in_range)
+{
+  const auto world = loadTestWorld();
+  const auto& rooms = world->getRooms();
+  const auto maxDistance = 8 * core::SectorSize;
+
+  auto isInRange = [&maxDistance](const core::TRVec& pos, const loader::file::Room& room) {
+    const auto minY = std::min(room.lowestHeight, room.greatestHeight);
+    const auto maxY = std::max(room.lowestHeight, room.greatestHeight);
+    return pos.X > room.position.X - maxDistance
+           && pos.X < room.position.X + room.sectorCountX * core::SectorSize + maxDistance
+           && pos.Z > room.position.Z - maxDistance
+           && pos.Z < room.position.Z + room.sectorCountZ * core::SectorSize + maxDistance
+           && pos.Y > minY - maxDistance && pos.Y < maxY + maxDistance;
+  };
+
+  for(const auto& object : world->getObjectManager().getObjects())
+  {
+    const auto& pos = object->m_state.position;
+    const auto within = ObjectManager::getRoomsWithin(pos, maxDistance, rooms);
+    auto contains = [&within](const loader::file::Room* room) {
+      return std::find(within.begin(), within.end(), room) != within.end();
+    };
+
+    BOOST_REQUIRE(!within.empty());
+    BOOST_CHECK_EQUAL(within.front(), pos.room.get());
+    for(const auto& room : within)
+    {
+      BOOST_CHECK_EQUAL(std::count(within.begin(), within.end(), room), 1);
+      BOOST_CHECK(room == pos.room.get() || isInRange(pos.position, *room));
+
+      // every room in range that adjoins a found room must be found as well
+      for(const loader::file::Portal& portal : room->portals)
+      {
+        const auto& adjoining = rooms.at(portal.adjoining_room.get());
+        if(isInRange(pos.position, adjoining))
+          BOOST_CHECK(contains(&adjoining));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_creatures_in_rooms_match_full_scan)
+{
+  const auto world = loadTestWorld();
+  const auto& objectManager = world->getObjectManager();
+  const auto maxDistance = 8 * core::SectorSize;
+
+  auto isNear = [&maxDistance](const core::TRVec& pos, const objects::Object& object) {
+    const auto d = object.m_state.position.position - pos;
+    return abs(d.X) < maxDistance && abs(d.Y) < maxDistance && abs(d.Z) < maxDistance;
+  };
+
+  size_t found = 0;
+  for(const auto& origin : objectManager.getObjects())
+  {
+    const auto& pos = origin->m_state.position;
+    const auto rooms = ObjectManager::getRoomsWithin(pos, maxDistance, world->getRooms());
+
+    std::vector<std::shared_ptr<objects::Object>> expected;
+    for(const auto& object : objectManager.getObjects())
+    {
+      if(!object->m_state.isDead() && isNear(pos.position, *object)
+         && std::find(rooms.begin(), rooms.end(), object->m_state.position.room.get()) != rooms.end())
+        expected.emplace_back(object);
+    }
+
+    std::vector<std::shared_ptr<objects::Object>> actual;
+    for(const auto& object : objectManager.getCreaturesInRooms(rooms))
+    {
+      if(isNear(pos.position, *object))
+        actual.emplace_back(object);
+    }
+
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+    found += actual.size();
+  }
+
+  BOOST_CHECK_GT(found, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(path_search_tests)
+
+BOOST_AUTO_TEST_CASE(test_precomputed_searches_match_serial_update)
+{
+  auto run = [](const bool precompute) {
+    // NOLINTNEXTLINE(cert-msc51-cpp)
+    std::srand(42);
+    const auto world = loadTestWorld();
+    world->getObjectManager().setPrecomputePathSearches(precompute);
+    activateCreatures(*world);
+
+    std::vector<std::vector<int64_t>> frames;
+    for(int frame = 0; frame < 600; ++frame)
+    {
+      world->gameStep(false);
+      frames.emplace_back(getObjectStates(*world));
+    }
+    return frames;
+  };
+
+  const auto serial = run(false);
+  const auto precomputed = run(true);
+  BOOST_REQUIRE_EQUAL(serial.size(), precomputed.size());
+  for(size_t frame = 0; frame < serial.size(); ++frame)
+  {
+    BOOST_TEST_CONTEXT("frame " << frame)
+    {
+      BOOST_REQUIRE_EQUAL_COLLECTIONS(
+        precomputed[frame].begin(), precomputed[frame].end(), serial[frame].begin(), serial[frame].end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(frame_rate_tests)
+
+BOOST_AUTO_TEST_CASE(test_game_is_independent_of_render_rate)
+{
+  static constexpr auto Duration = 20s;
+
+  const auto reference = simulateLevel(Duration, []() { return StepDuration; });
+  BOOST_REQUIRE_EQUAL(reference.stepHashes.size(), 30u * 20u);
+
+  const auto check = [&reference](const SimulationResult& result) {
+    BOOST_REQUIRE_EQUAL(result.stepHashes.size(), reference.stepHashes.size());
+    for(size_t i = 0; i < result.stepHashes.size(); ++i)
+    {
+      BOOST_TEST_CONTEXT("step " << i)
+      {
+        BOOST_REQUIRE_EQUAL(result.stepHashes[i], reference.stepHashes[i]);
+      }
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(result.finalStates.begin(),
+                                  result.finalStates.end(),
+                                  reference.finalStates.begin(),
+                                  reference.finalStates.end());
+  };
+
+  for(const auto interval : {7ms, 16ms, 17ms, 33ms, 50ms, 100ms})
+  {
+    BOOST_TEST_CONTEXT("interval " << interval.count() << "ms")
+    {
+      check(simulateLevel(Duration, [interval]() { return interval; }));
+    }
+  }
+
+  std::mt19937 rng{1};
+  std::uniform_int_distribution<int> jitter{0, 120};
+  check(simulateLevel(Duration, [&rng, &jitter]() { return std::chrono::milliseconds{jitter(rng)}; }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(render_interpolator_tests)
+
+BOOST_AUTO_TEST_CASE(test_interpolation_and_restore)
+{
+  // NOLINTNEXTLINE(cert-msc51-cpp)
+  std::srand(42);
+  const auto world = loadTestWorld();
+  activateCreatures(*world);
+  const auto& objectManager = world->getObjectManager();
+  auto& camera = *world->getCameraController().getCamera();
+
+  const auto step = [&world](const size_t i) {
+    world->getPresenter().getInputHandler().setActions(getScriptedActions(i));
+    world->gameStep(false);
+  };
+
+  RenderInterpolator interpolator;
+  for(size_t i = 0; i < 60; ++i)
+    step(i);
+  interpolator.capture(objectManager, camera);
+  const auto& laraNode = objectManager.getLara().getNode();
+  const auto previousParent = laraNode->getParent().lock();
+  const auto previousTransform = laraNode->getLocalMatrix();
+  step(60);
+  interpolator.capture(objectManager, camera);
+
+  struct Recorded
+  {
+    glm::mat4 transform;
+    std::vector<glm::mat4> bones;
+  };
+  std::vector<std::pair<std::shared_ptr<render::scene::Node>, Recorded>> recorded;
+  const auto record = [&recorded](const objects::Object& object) {
+    const auto& node = object.getNode();
+    Recorded transforms{node->getLocalMatrix(), {}};
+    if(const auto skeleton = dynamic_cast<const SkeletalModelNode*>(node.get()))
+    {
+      for(size_t i = 0; i < skeleton->getBoneCount(); ++i)
+        transforms.bones.emplace_back(skeleton->getMeshMatrix(i));
+    }
+    recorded.emplace_back(node, std::move(transforms));
+  };
+  for(const auto& object : objectManager.getObjects())
+    record(*object);
+  for(const auto& object : objectManager.getDynamicObjects())
+    record(*object);
+  const auto view = camera.getViewMatrix();
+
+  // Lara runs, so her node is interpolated between both steps
+  const auto currentTransform = laraNode->getLocalMatrix();
+  BOOST_REQUIRE(previousParent == laraNode->getParent().lock());
+  BOOST_REQUIRE(previousTransform != currentTransform);
+
+  interpolator.apply(0.5f, camera);
+  BOOST_CHECK(laraNode->getLocalMatrix()
+              == render::scene::interpolateTransform(previousTransform, currentTransform, 0.5f));
+
+  // the simulation continues from the exact state of the last step
+  interpolator.restore(camera);
+  for(const auto& [node, transforms] : recorded)
+  {
+    BOOST_CHECK(node->getLocalMatrix() == transforms.transform);
+    const auto skeleton = dynamic_cast<const SkeletalModelNode*>(node.get());
+    BOOST_REQUIRE_EQUAL(transforms.bones.size(), skeleton == nullptr ? 0 : skeleton->getBoneCount());
+    for(size_t i = 0; i < transforms.bones.size(); ++i)
+      BOOST_CHECK(skeleton->getMeshMatrix(i) == transforms.bones[i]);
+  }
+  BOOST_CHECK(camera.getViewMatrix() == view);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(replay_tests)
+
+BOOST_AUTO_TEST_CASE(test_replay_is_deterministic)
+{
+  hid::InputRecording recording{0, 1234};
+  {
+    hid::InputHandler inputHandler{nullptr};
+    for(size_t i = 0; i < 900; ++i)
+    {
+      inputHandler.setActions(getScriptedActions(i));
+      recording.record(inputHandler.getInputState());
+    }
+  }
+
+  const auto replay = [&recording]() {
+    const auto world = loadTestWorld();
+    activateCreatures(*world);
+    return HeadlessEngine::instance->runBenchmark(*world, std::chrono::microseconds{0}, 0, &recording);
+  };
+
+  const auto first = replay();
+  const auto second = replay();
+  BOOST_CHECK_EQUAL(first, second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
@@ -2,7 +2,9 @@
 
 #include "core/magic.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <thread>
 
 namespace engine
@@ -35,4 +37,61 @@ private:
 
   std::chrono::high_resolution_clock::time_point m_nextFrameTime{};
 };
+
+//! Advances the simulation in steps of exactly 1/core::FrameRate seconds, independent of the rate at which frames are
+//! rendered.
+class FixedStepClock
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using StepDuration = std::chrono::duration<int64_t, std::ratio<1, core::FrameRate.get()>>;
+
+  //! If rendering falls behind more than this, the game is slowed down instead of trying to catch up
+  static constexpr size_t MaxStepsPerFrame = 4;
+
+  explicit FixedStepClock(const Clock::time_point& now = Clock::now())
+      : m_lastTime{now}
+  {
+  }
+
+  //! Returns the number of simulation steps that are due until @a now
+  [[nodiscard]] size_t advance(const Clock::time_point& now = Clock::now())
+  {
+    m_pending += now - m_lastTime;
+    m_lastTime = now;
+
+    const auto steps = m_pending / StepDuration{1};
+    if(steps > static_cast<int64_t>(MaxStepsPerFrame))
+    {
+      m_pending = m_pending % StepDuration{1};
+      return MaxStepsPerFrame;
+    }
+
+    m_pending -= steps * StepDuration{1};
+    return static_cast<size_t>(std::max(steps, int64_t{0}));
+  }
+
+  //! The part of the next step that has already passed, in [0, 1]
+  [[nodiscard]] float getAlpha() const
+  {
+    return std::chrono::duration<float>{m_pending} / std::chrono::duration<float>{StepDuration{1}};
+  }
+
+  [[nodiscard]] Clock::time_point getNextStepTime() const
+  {
+    return m_lastTime + std::chrono::ceil<Clock::duration>(StepDuration{1} - m_pending);
+  }
+
+  //! Discards the time passed since the last step, e.g. after time spent in a menu
+  void reset(const Clock::time_point& now = Clock::now())
+  {
+    m_lastTime = now;
+    m_pending = {};
+  }
+
+private:
+  Clock::time_point m_lastTime;
+  //! The time passed since the last step; the common type of both durations represents both exactly
+  std::common_type_t<Clock::duration, StepDuration> m_pending{};
+};
 } // namespace engine
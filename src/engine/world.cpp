@@ -14,6 +14,7 @@
 #include "objects/modelobject.h"
 #include "objects/pickupobject.h"
 #include "objects/tallblock.h"
+#include "particlepool.h"
 #include "player.h"
 #include "presenter.h"
 #include "render/scene/camera.h"
@@ -36,6 +37,7 @@
 #include "tracks_tr1.h"
 #include "ui/label.h"
 #include "ui/ui.h"
+#include "util/profiler.h"
 
 #include <boost/format.hpp>
 #include <gl/texture2darray.h>
@@ -222,13 +224,12 @@ std::tuple<int8_t, int8_t> getFloorSlantInfo(gsl::not_null<const loader::file::S
 
   if(position.Y + core::QuarterSectorSize * 2 < sector->floorHeight)
     return zero;
-  if(sector->floorData == nullptr)
-    return zero;
-  if(floordata::FloorDataChunk{*sector->floorData}.type != floordata::FloorDataChunkType::FloorSlant)
+
+  const auto& slant = sector->heights.floorSlant;
+  if(!slant.has_value())
     return zero;
 
-  const auto fd = sector->floorData[1];
-  return std::make_tuple(gsl::narrow_cast<int8_t>(fd.get() & 0xffu), gsl::narrow_cast<int8_t>(fd.get() >> 8u));
+  return std::make_tuple(slant->x, slant->z);
 }
 
 void World::swapAllRooms()
@@ -278,6 +279,22 @@ std::vector<loader::file::Room>& World::getRooms()
   return m_level->m_rooms;
 }
 
+const render::PotentiallyVisibleSet& World::getPotentiallyVisibleSet() const
+{
+  return m_level->m_potentiallyVisibleSets[m_roomsAreSwapped ? 1 : 0];
+}
+
+const RoomLightNeighbourhoods& World::getRoomLightNeighbourhoods() const
+{
+  return m_level->m_roomLightNeighbourhoods;
+}
+
+gsl::span<const uint32_t> World::getNeighbourhoodLights(const loader::file::Room& room) const
+{
+  const auto roomIndex = gsl::narrow<size_t>(std::distance(m_level->m_rooms.data(), &room));
+  return m_level->m_roomLightNeighbourhoods.get(roomIndex);
+}
+
 const std::vector<loader::file::Box>& World::getBoxes() const
 {
   return m_level->m_boxes;
@@ -285,6 +302,7 @@ const std::vector<loader::file::Box>& World::getBoxes() const
 
 void World::loadSceneData()
 {
+  UTIL_PROFILE_ZONE("load-scene-data");
   for(size_t i = 0; i < m_level->m_meshes.size(); ++i)
   {
     m_level->m_meshes[i].meshData = std::make_shared<loader::file::RenderMeshData>(
@@ -328,6 +346,19 @@ void World::loadSceneData()
     getPresenter().getRenderer().getScene()->addNode(m_level->m_rooms[i].node);
   }
 
+  {
+    std::vector<uint16_t> overlapIndices;
+    overlapIndices.reserve(m_level->m_boxes.size());
+    for(const auto& box : m_level->m_boxes)
+      overlapIndices.emplace_back(box.overlap_index);
+    m_boxGraph = ai::BoxGraph{overlapIndices, m_level->m_overlaps};
+  }
+
+  m_objectInfos = script::ObjectInfos::fromScript(pybind11::globals()["getObjectInfo"]);
+
+  m_particlePool = std::make_unique<ParticlePool>(*this);
+  m_particlePool->addToScene(*getPresenter().getRenderer().getScene());
+
   m_objectManager.createObjects(*this, m_level->m_items);
   if(m_objectManager.getLaraPtr() == nullptr)
   {
@@ -418,10 +449,7 @@ void World::laraBubblesEffect(objects::Object& object)
 
   while(bubbleCount-- > 0)
   {
-    auto particle
-      = std::make_shared<BubbleParticle>(core::RoomBoundPosition{object.m_state.position.room, position}, *this);
-    setParent(particle, object.m_state.position.room->node);
-    m_objectManager.registerParticle(particle);
+    m_particlePool->emitBubble(core::RoomBoundPosition{object.m_state.position.room, position});
   }
 }
 
@@ -582,20 +610,8 @@ void World::swapWithAlternate(loader::file::Room& orig, loader::file::Room& alte
 {
   // find any blocks in the original room and un-patch the floor heights
 
-  for(const auto& object : m_objectManager.getObjects() | boost::adaptors::map_values)
-  {
-    if(object->m_state.position.room != &orig)
-      continue;
-
-    if(const auto tmp = std::dynamic_pointer_cast<objects::Block>(object.get()))
-    {
-      loader::file::Room::patchHeightsForBlock(*tmp, core::SectorSize);
-    }
-    else if(const auto tmp2 = std::dynamic_pointer_cast<objects::TallBlock>(object.get()))
-    {
-      loader::file::Room::patchHeightsForBlock(*tmp2, core::SectorSize * 2);
-    }
-  }
+  for(const auto& [block, height] : m_objectManager.getBlocksInRoom(&orig))
+    loader::file::Room::patchHeightsForBlock(*block, height);
 
   // now swap the rooms and patch the alternate room ids
   std::swap(orig, alternate);
@@ -604,44 +620,19 @@ void World::swapWithAlternate(loader::file::Room& orig, loader::file::Room& alte
   // patch heights in the new room, and swap object ownerships.
   // note that this is exactly the same code as above,
   // except for the heights.
-  for(const auto& object : m_objectManager.getObjects() | boost::adaptors::map_values)
+  for(const auto& object : m_objectManager.getObjectsInRoom(&alternate))
   {
-    if(object->m_state.position.room == &orig)
-    {
-      // although this seems contradictory, remember the nodes have been swapped above
-      setParent(object->getNode(), orig.node);
-    }
-    else if(object->m_state.position.room == &alternate)
-    {
-      setParent(object->getNode(), alternate.node);
-      continue;
-    }
-    else
-    {
-      continue;
-    }
-
-    if(const auto tmp = std::dynamic_pointer_cast<objects::Block>(object.get()))
-    {
-      loader::file::Room::patchHeightsForBlock(*tmp, -core::SectorSize);
-    }
-    else if(const auto tmp2 = std::dynamic_pointer_cast<objects::TallBlock>(object.get()))
-    {
-      loader::file::Room::patchHeightsForBlock(*tmp2, -core::SectorSize * 2);
-    }
+    setParent(object->getNode(), alternate.node);
   }
 
-  for(const auto& object : m_objectManager.getDynamicObjects())
+  for(const auto& object : m_objectManager.getObjectsInRoom(&orig))
   {
-    if(object->m_state.position.room == &orig)
-    {
-      setParent(object->getNode(), orig.node);
-    }
-    else if(object->m_state.position.room == &alternate)
-    {
-      setParent(object->getNode(), alternate.node);
-    }
+    // although this seems contradictory, remember the nodes have been swapped above
+    setParent(object->getNode(), orig.node);
   }
+
+  for(const auto& [block, height] : m_objectManager.getBlocksInRoom(&orig))
+    loader::file::Room::patchHeightsForBlock(*block, -height);
 }
 
 std::shared_ptr<objects::PickupObject> World::createPickup(const core::TypeId type,
@@ -758,11 +749,6 @@ const std::vector<loader::file::Animation>& World::getAnimations() const
   return m_level->m_animations;
 }
 
-const std::vector<uint16_t>& World::getOverlaps() const
-{
-  return m_level->m_overlaps;
-}
-
 const std::unique_ptr<loader::file::SkeletalModelType>& World::findAnimatedModelForType(core::TypeId type) const
 {
   return m_level->findAnimatedModelForType(type);
@@ -978,6 +964,8 @@ void World::serialize(const serialization::Serializer<World>& ser)
       room.resetScenery();
       getPresenter().getRenderer().getScene()->addNode(room.node);
     }
+    m_particlePool->clear();
+    m_particlePool->addToScene(*getPresenter().getRenderer().getScene());
 
     auto currentRoomOrder = m_roomOrder;
     ser(S_NV("roomOrder", m_roomOrder));
@@ -1017,63 +1005,83 @@ void World::serialize(const serialization::Serializer<World>& ser)
     m_level->updateRoomBasedCaches();
 }
 
-void World::gameLoop(bool godMode)
+void World::gameStep(bool godMode)
 {
-  ui::Ui ui{getPresenter().getMaterialManager()->getScreenSpriteTextured(),
-            getPresenter().getMaterialManager()->getScreenSpriteColorRect(),
-            getPalette()};
-
+  UTIL_PROFILE_ZONE("game-step");
   update(godMode);
   m_player->laraHealth = m_objectManager.getLara().m_state.health;
 
-  const auto waterEntryPortals = m_cameraController->update();
+  m_waterEntryPortals = m_cameraController->update();
   doGlobalEffect();
-  getPresenter().drawBars(ui, *m_level->m_palette, getObjectManager());
-  if(getObjectManager().getLara().getHandStatus() == engine::objects::HandStatus::Combat
-     && m_player->gunType != WeaponId::Pistols)
-  {
-    size_t n = 0;
-    std::string suffix;
-    switch(m_player->gunType)
-    {
-    case WeaponId::Shotgun:
-      n = m_player->getInventory().getAmmo(WeaponId::Shotgun)->ammo / 6;
-      suffix = " A";
-      break;
-    case WeaponId::Magnums:
-      n = m_player->getInventory().getAmmo(WeaponId::Magnums)->ammo;
-      suffix = " B";
-      break;
-    case WeaponId::Uzis:
-      n = m_player->getInventory().getAmmo(WeaponId::Uzis)->ammo;
-      suffix = " C";
-      break;
-    default: Expects(false); break;
-    }
-    auto text = ui::Label{{-17, 22}, ui::makeAmmoString(std::to_string(n) + suffix)};
-    text.alignX = ui::Label::Alignment::Right;
-    text.draw(ui, getPresenter().getTrFont(), getPresenter().getViewport());
-  }
-
-  drawPickupWidgets(ui);
-  getPresenter().renderWorld(ui, getObjectManager(), getRooms(), getCameraController(), waterEntryPortals);
+  getPresenter().updateBars(getObjectManager());
+  m_renderInterpolator.capture(getObjectManager(), *m_cameraController->getCamera());
 }
 
-bool World::cinematicLoop()
+bool World::cinematicStep()
 {
+  UTIL_PROFILE_ZONE("cinematic-step");
   update(false);
 
-  const auto waterEntryPortals
+  m_waterEntryPortals
     = m_cameraController->updateCinematic(m_level->m_cinematicFrames[m_cameraController->m_cinematicFrame], false);
   doGlobalEffect();
+  m_renderInterpolator.capture(getObjectManager(), *m_cameraController->getCamera());
+
+  return ++m_cameraController->m_cinematicFrame < m_level->m_cinematicFrames.size();
+}
 
+void World::renderFrame(const float alpha, const bool withHud)
+{
   ui::Ui ui{getPresenter().getMaterialManager()->getScreenSpriteTextured(),
             getPresenter().getMaterialManager()->getScreenSpriteColorRect(),
             getPalette()};
-  getPresenter().renderWorld(ui, getObjectManager(), getRooms(), getCameraController(), waterEntryPortals);
-  if(++m_cameraController->m_cinematicFrame >= m_level->m_cinematicFrames.size())
-    return false;
-  return true;
+
+  if(withHud)
+  {
+    getPresenter().drawBars(ui, *m_level->m_palette, getObjectManager());
+    if(getObjectManager().getLara().getHandStatus() == engine::objects::HandStatus::Combat
+       && m_player->gunType != WeaponId::Pistols)
+    {
+      size_t n = 0;
+      std::string suffix;
+      switch(m_player->gunType)
+      {
+      case WeaponId::Shotgun:
+        n = m_player->getInventory().getAmmo(WeaponId::Shotgun)->ammo / 6;
+        suffix = " A";
+        break;
+      case WeaponId::Magnums:
+        n = m_player->getInventory().getAmmo(WeaponId::Magnums)->ammo;
+        suffix = " B";
+        break;
+      case WeaponId::Uzis:
+        n = m_player->getInventory().getAmmo(WeaponId::Uzis)->ammo;
+        suffix = " C";
+        break;
+      default: Expects(false); break;
+      }
+      auto text = ui::Label{{-17, 22}, ui::makeAmmoString(std::to_string(n) + suffix)};
+      text.alignX = ui::Label::Alignment::Right;
+      text.draw(ui, getPresenter().getTrFont(), getPresenter().getViewport());
+    }
+
+    drawPickupWidgets(ui);
+  }
+
+  m_particlePool->updateInstances();
+
+  const bool interpolate = alpha < 1;
+  auto& camera = *m_cameraController->getCamera();
+  if(interpolate)
+    m_renderInterpolator.apply(alpha, camera);
+  // the simulation must continue with the exact transforms of the last step
+  const auto restoreTransforms = gsl::finally([this, interpolate, &camera]() {
+    if(interpolate)
+      m_renderInterpolator.restore(camera);
+  });
+
+  getPresenter().renderWorld(
+    ui, getObjectManager(), getRooms(), getRoomLightNeighbourhoods(), getCameraController(), m_waterEntryPortals);
 }
 
 void World::load(const std::filesystem::path& filename)
@@ -1093,6 +1101,7 @@ void World::load(const std::filesystem::path& filename)
   m_objectManager.getLara().m_state.health = m_player->laraHealth;
   m_objectManager.getLara().initWeaponAnimData();
   m_level->updateRoomBasedCaches();
+  m_renderInterpolator.reset();
 }
 
 void World::save(const std::filesystem::path& filename)
@@ -1207,6 +1216,7 @@ World::World(Engine& engine,
     , m_player{player}
 {
   {
+    UTIL_PROFILE_ZONE("load-world");
     getPresenter().drawLoadingScreen(m_engine.i18n()(I18n::BuildingTextures));
     for(auto& texture : m_level->m_textures)
     {
@@ -1452,10 +1462,13 @@ World::World(Engine& engine,
 
     BOOST_LOG_TRIVIAL(info) << "Loading samples...";
 
-    for(const auto offset : m_level->m_sampleIndices)
     {
-      Expects(offset < m_level->m_samplesData.size());
-      m_audioEngine->addWav(&m_level->m_samplesData[offset]);
+      UTIL_PROFILE_ZONE("load-samples");
+      for(const auto offset : m_level->m_sampleIndices)
+      {
+        Expects(offset < m_level->m_samplesData.size());
+        m_audioEngine->addWav(&m_level->m_samplesData[offset]);
+      }
     }
 
     getPresenter().drawLoadingScreen(util::unescape(m_title));
@@ -1477,6 +1490,7 @@ World::~World() = default;
 
 void World::createMipmaps(const std::vector<std::shared_ptr<gl::CImgWrapper>>& images, size_t nMips)
 {
+  UTIL_PROFILE_ZONE("create-mipmaps");
   std::map<int, std::set<UVRect>> tilesByTexture;
   BOOST_LOG_TRIVIAL(debug) << m_level->m_textureTiles.size() << " total texture tiles";
   for(const auto& tile : m_level->m_textureTiles)
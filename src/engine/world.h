@@ -1,13 +1,19 @@
 #pragma once
 
+#include "ai/pathsearch.h"
 #include "audio/soundengine.h"
 #include "floordata/floordata.h"
+#include "lighting.h"
 #include "loader/file/datatypes.h"
 #include "loader/file/item.h"
 #include "objectmanager.h"
+#include "renderinterpolator.h"
+#include "script/objectinfos.h"
 #include "ui/pickupwidget.h"
 
+#include <map>
 #include <pybind11/pytypes.h>
+#include <unordered_set>
 
 namespace gl
 {
@@ -31,8 +37,9 @@ class Level;
 
 namespace render
 {
+class PotentiallyVisibleSet;
 class TextureAnimator;
-}
+} // namespace render
 
 namespace engine
 {
@@ -51,6 +58,7 @@ class AudioEngine;
 struct SavegameMeta;
 class CameraController;
 class Player;
+class ParticlePool;
 enum class TR1TrackId : int32_t;
 
 class World final
@@ -97,6 +105,11 @@ public:
     return m_objectManager;
   }
 
+  ParticlePool& getParticlePool()
+  {
+    return *m_particlePool;
+  }
+
   void finishLevel()
   {
     m_levelFinished = true;
@@ -156,6 +169,10 @@ public:
   [[nodiscard]] const std::vector<loader::file::Box>& getBoxes() const;
   [[nodiscard]] const std::vector<loader::file::Room>& getRooms() const;
   std::vector<loader::file::Room>& getRooms();
+  [[nodiscard]] const render::PotentiallyVisibleSet& getPotentiallyVisibleSet() const;
+  [[nodiscard]] const RoomLightNeighbourhoods& getRoomLightNeighbourhoods() const;
+  //! The indices into getRoomLightNeighbourhoods().getLights() of the lights that may affect \p room
+  [[nodiscard]] gsl::span<const uint32_t> getNeighbourhoodLights(const loader::file::Room& room) const;
   [[nodiscard]] const loader::file::StaticMesh* findStaticMeshById(core::StaticMeshId meshId) const;
   [[nodiscard]] const std::unique_ptr<loader::file::SpriteSequence>& findSpriteSequenceForType(core::TypeId type) const;
   [[nodiscard]] const loader::file::Animation& getAnimation(loader::file::AnimationId id) const;
@@ -187,7 +204,21 @@ public:
   [[nodiscard]] const std::unique_ptr<loader::file::SkeletalModelType>&
     findAnimatedModelForType(core::TypeId type) const;
   [[nodiscard]] const std::vector<loader::file::Animation>& getAnimations() const;
-  [[nodiscard]] const std::vector<uint16_t>& getOverlaps() const;
+  [[nodiscard]] const ai::BoxGraph& getBoxGraph() const
+  {
+    return m_boxGraph;
+  }
+
+  ai::PathSearchCache& getPathSearchCache()
+  {
+    return m_pathSearchCache;
+  }
+
+  //! Throws std::out_of_range for unknown types
+  [[nodiscard]] const script::ObjectInfo& getObjectInfo(const core::TypeId& type) const
+  {
+    return m_objectInfos.get(type);
+  }
   [[nodiscard]] const std::vector<int16_t>& getPoseFrames() const;
   [[nodiscard]] gsl::not_null<std::shared_ptr<loader::file::RenderMeshData>> getRenderMesh(size_t idx) const;
   [[nodiscard]] const std::vector<loader::file::Mesh>& getMeshes() const;
@@ -200,8 +231,12 @@ public:
   core::TypeId find(const loader::file::SkeletalModelType* model) const;
   core::TypeId find(const loader::file::Sprite* sprite) const;
   void serialize(const serialization::Serializer<World>& ser);
-  void gameLoop(bool godMode);
-  bool cinematicLoop();
+  //! Advances the game by one frame
+  void gameStep(bool godMode);
+  //! Advances the cutscene by one frame; returns false if it has ended
+  bool cinematicStep();
+  //! Renders the state of the last step, interpolated from the step before by @a alpha if it is less than 1
+  void renderFrame(float alpha, bool withHud);
   void load(const std::filesystem::path& filename);
   void load(size_t slot);
   void save(const std::filesystem::path& filename);
@@ -289,6 +324,8 @@ private:
 
   gsl::not_null<std::unique_ptr<loader::file::level::Level>> m_level;
   std::unique_ptr<CameraController> m_cameraController;
+  std::unordered_set<const loader::file::Portal*> m_waterEntryPortals;
+  RenderInterpolator m_renderInterpolator;
 
   core::Frame m_effectTimer = 0_frame;
   std::optional<size_t> m_activeEffect{};
@@ -300,7 +337,11 @@ private:
   // list of meshes and models, resolved through m_meshIndices
   std::vector<gsl::not_null<const loader::file::Mesh*>> m_meshesDirect;
 
+  ai::BoxGraph m_boxGraph;
+  ai::PathSearchCache m_pathSearchCache;
+  script::ObjectInfos m_objectInfos;
   ObjectManager m_objectManager;
+  std::unique_ptr<ParticlePool> m_particlePool;
 
   bool m_levelFinished = false;
 
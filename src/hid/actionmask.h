@@ -0,0 +1,16 @@
+#pragma once
+
+#include "actions.h"
+
+#include <cstdint>
+
+namespace hid
+{
+//! The actions pressed during a single simulation step, one bit per Action
+using ActionMask = uint32_t;
+
+[[nodiscard]] constexpr ActionMask toActionMask(const Action action)
+{
+  return ActionMask{1} << static_cast<uint32_t>(action);
+}
+} // namespace hid
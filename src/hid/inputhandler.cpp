@@ -41,9 +41,15 @@ bool isKeyPressed(GlfwKey key)
 }
 } // namespace
 
-InputHandler::InputHandler(gsl::not_null<GLFWwindow*> window)
-    : m_window{std::move(window)}
+InputHandler::InputHandler(GLFWwindow* window)
+    : m_window{window}
 {
+  if(m_window == nullptr)
+  {
+    BOOST_LOG_TRIVIAL(info) << "No window available, input is disabled";
+    return;
+  }
+
   installHandlers(m_window);
 
   for(auto i = GLFW_JOYSTICK_1; i <= GLFW_JOYSTICK_LAST; ++i)
@@ -79,6 +85,26 @@ void InputHandler::update()
     m_inputState.actions[action] = isKeyPressed(key) || gamepadButtonPressed;
   }
 
+  updateAxes();
+}
+
+void InputHandler::setActions(const ActionMask actions)
+{
+  for(auto& [action, state] : m_inputState.actions)
+    state = (actions & toActionMask(action)) != 0;
+
+  for(uint32_t i = 0; i < sizeof(ActionMask) * 8; ++i)
+  {
+    const auto action = static_cast<Action>(i);
+    if((actions & toActionMask(action)) != 0 && m_inputState.actions.count(action) == 0)
+      m_inputState.actions[action] = true;
+  }
+
+  updateAxes();
+}
+
+void InputHandler::updateAxes()
+{
   m_inputState.setXAxisMovement(m_inputState.actions[Action::Left], m_inputState.actions[Action::Right]);
   m_inputState.setZAxisMovement(m_inputState.actions[Action::Backward], m_inputState.actions[Action::Forward]);
   m_inputState.setStepMovement(m_inputState.actions[Action::StepLeft], m_inputState.actions[Action::StepRight]);
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "actionmask.h"
 #include "inputstate.h"
 
 #include <GLFW/glfw3.h>
+#include <algorithm>
 #include <gsl-lite.hpp>
+#include <map>
 #include <variant>
+#include <vector>
 
 namespace hid
 {
@@ -16,11 +20,15 @@ using InputMapping = std::map<Action, std::vector<std::variant<GlfwGamepadButton
 class InputHandler final
 {
 public:
-  explicit InputHandler(gsl::not_null<GLFWwindow*> window);
+  //! If window is null, no input will be received
+  explicit InputHandler(GLFWwindow* window);
   void setMapping(const InputMapping& inputMapping);
 
   void update();
 
+  //! Replaces the input of the current step, e.g. when replaying an InputRecording
+  void setActions(ActionMask actions);
+
   [[nodiscard]] const InputState& getInputState() const
   {
     return m_inputState;
@@ -48,8 +56,10 @@ public:
   }
 
 private:
+  void updateAxes();
+
   InputState m_inputState{};
-  const gsl::not_null<GLFWwindow*> m_window;
+  GLFWwindow* const m_window;
   int m_controllerIndex = -1;
   boost::container::flat_map<Action, GlfwKey> m_inputKeyMap{};
   boost::container::flat_map<Action, GlfwGamepadButton> m_inputGamepadMap{};
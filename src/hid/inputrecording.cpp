@@ -0,0 +1,155 @@
+#include "inputrecording.h"
+
+#include <boost/log/trivial.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstring>
+#include <fstream>
+#include <gsl-lite.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace hid
+{
+namespace
+{
+constexpr uint32_t Magic = 0x52494545u; // "EEIR"
+constexpr uint32_t Version = 1;
+
+// the seed TR1 uses for its demos
+constexpr uint32_t Tr1DemoSeed = 0xD371F947u;
+constexpr uint32_t Tr1DemoEnd = 0xFFFFFFFFu;
+
+// the bits of the TR1 input word, as used by its demos
+constexpr std::pair<uint32_t, Action> Tr1DemoInputs[]{
+  {1u << 0u, Action::Forward},
+  {1u << 1u, Action::Backward},
+  {1u << 2u, Action::Left},
+  {1u << 3u, Action::Right},
+  {1u << 4u, Action::Jump},
+  {1u << 5u, Action::Holster},
+  {1u << 6u, Action::Action},
+  {1u << 7u, Action::MoveSlow},
+  {1u << 9u, Action::FreeLook},
+  {1u << 10u, Action::StepLeft},
+  {1u << 11u, Action::StepRight},
+  {1u << 12u, Action::Roll},
+};
+
+void write(std::ofstream& file, const uint32_t value)
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint32_t read(std::ifstream& file)
+{
+  uint32_t value = 0;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.read(reinterpret_cast<char*>(&value), sizeof(value));
+  if(!file)
+  {
+    BOOST_LOG_TRIVIAL(error) << "Unexpected end of input recording";
+    BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected end of input recording"));
+  }
+  return value;
+}
+} // namespace
+
+ActionMask toActionMask(const InputState& inputState)
+{
+  ActionMask mask = 0;
+  for(const auto& [action, state] : inputState.actions)
+  {
+    Expects(static_cast<uint32_t>(action) < sizeof(ActionMask) * 8);
+    if(state.current)
+      mask |= toActionMask(action);
+  }
+  return mask;
+}
+
+void InputRecording::save(const std::filesystem::path& filename) const
+{
+  if(!m_valid)
+  {
+    BOOST_LOG_TRIVIAL(error) << "Refusing to write input recording " << filename
+                             << ", as the game state was changed outside of the recorded steps";
+    BOOST_THROW_EXCEPTION(std::runtime_error("Input recording is not replayable"));
+  }
+
+  std::ofstream file{filename, std::ios::out | std::ios::trunc | std::ios::binary};
+  if(!file.is_open())
+  {
+    BOOST_LOG_TRIVIAL(error) << "Failed to write input recording " << filename;
+    BOOST_THROW_EXCEPTION(std::runtime_error("Failed to write input recording"));
+  }
+
+  write(file, Magic);
+  write(file, Version);
+  write(file, gsl::narrow<uint32_t>(m_levelSequenceIndex));
+  write(file, m_seed);
+  write(file, gsl::narrow<uint32_t>(m_frames.size()));
+  for(const auto frame : m_frames)
+    write(file, frame);
+
+  BOOST_LOG_TRIVIAL(info) << "Wrote " << m_frames.size() << " steps of input to " << filename;
+}
+
+InputRecording InputRecording::load(const std::filesystem::path& filename)
+{
+  std::ifstream file{filename, std::ios::in | std::ios::binary};
+  if(!file.is_open())
+  {
+    BOOST_LOG_TRIVIAL(error) << "Failed to open input recording " << filename;
+    BOOST_THROW_EXCEPTION(std::runtime_error("Failed to open input recording"));
+  }
+
+  if(read(file) != Magic || read(file) != Version)
+  {
+    BOOST_LOG_TRIVIAL(error) << "Unsupported input recording " << filename;
+    BOOST_THROW_EXCEPTION(std::runtime_error("Unsupported input recording"));
+  }
+
+  const auto levelSequenceIndex = read(file);
+  const auto seed = read(file);
+  InputRecording recording{levelSequenceIndex, seed};
+  recording.m_frames.resize(read(file));
+  for(auto& frame : recording.m_frames)
+    frame = read(file);
+  return recording;
+}
+
+InputRecording InputRecording::fromTr1Demo(const size_t levelSequenceIndex, const std::vector<uint8_t>& demoData)
+{
+  static constexpr size_t HeaderWords = 7;
+
+  std::vector<uint32_t> words(demoData.size() / sizeof(uint32_t));
+  std::memcpy(words.data(), demoData.data(), words.size() * sizeof(uint32_t));
+  if(words.size() < HeaderWords)
+  {
+    BOOST_LOG_TRIVIAL(error) << "The level does not contain a demo";
+    BOOST_THROW_EXCEPTION(std::runtime_error("The level does not contain a demo"));
+  }
+
+  InputRecording recording{levelSequenceIndex, Tr1DemoSeed};
+  recording.m_demoStart = DemoStart{static_cast<int32_t>(words[0]),
+                                    static_cast<int32_t>(words[1]),
+                                    static_cast<int32_t>(words[2]),
+                                    static_cast<int16_t>(words[3]),
+                                    static_cast<int16_t>(words[4]),
+                                    static_cast<int16_t>(words[5]),
+                                    words[6]};
+
+  for(size_t i = HeaderWords; i < words.size() && words[i] != Tr1DemoEnd; ++i)
+  {
+    ActionMask mask = 0;
+    for(const auto& [bit, action] : Tr1DemoInputs)
+    {
+      if((words[i] & bit) != 0)
+        mask |= toActionMask(action);
+    }
+    recording.m_frames.emplace_back(mask);
+  }
+
+  return recording;
+}
+} // namespace hid
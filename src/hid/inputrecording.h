@@ -0,0 +1,90 @@
+#pragma once
+
+#include "actionmask.h"
+#include "inputstate.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace hid
+{
+[[nodiscard]] extern ActionMask toActionMask(const InputState& inputState);
+
+//! Lara's initial placement in a TR1 demo
+struct DemoStart
+{
+  int32_t x = 0;
+  int32_t y = 0;
+  int32_t z = 0;
+  int16_t rotationX = 0;
+  int16_t rotationY = 0;
+  int16_t rotationZ = 0;
+  size_t room = 0;
+};
+
+//! The input of a level session, one entry per simulation step, along with everything else needed to replay it
+class InputRecording final
+{
+public:
+  explicit InputRecording(size_t levelSequenceIndex, uint32_t seed)
+      : m_levelSequenceIndex{levelSequenceIndex}
+      , m_seed{seed}
+  {
+  }
+
+  [[nodiscard]] size_t getLevelSequenceIndex() const noexcept
+  {
+    return m_levelSequenceIndex;
+  }
+
+  //! The seed of the random number generator when the first step is simulated
+  [[nodiscard]] uint32_t getSeed() const noexcept
+  {
+    return m_seed;
+  }
+
+  [[nodiscard]] const std::vector<ActionMask>& getFrames() const noexcept
+  {
+    return m_frames;
+  }
+
+  [[nodiscard]] const std::optional<DemoStart>& getDemoStart() const noexcept
+  {
+    return m_demoStart;
+  }
+
+  void record(const InputState& inputState)
+  {
+    m_frames.emplace_back(toActionMask(inputState));
+  }
+
+  //! Marks the recording as not replayable, because the game state was changed outside of the recorded steps, e.g. in
+  //! the inventory
+  void invalidate() noexcept
+  {
+    m_valid = false;
+  }
+
+  [[nodiscard]] bool isValid() const noexcept
+  {
+    return m_valid;
+  }
+
+  //! Throws if the recording is not valid
+  void save(const std::filesystem::path& filename) const;
+
+  [[nodiscard]] static InputRecording load(const std::filesystem::path& filename);
+
+  //! Converts the demo data of a TR1 level, which consists of Lara's placement followed by one input word per step
+  [[nodiscard]] static InputRecording fromTr1Demo(size_t levelSequenceIndex, const std::vector<uint8_t>& demoData);
+
+private:
+  size_t m_levelSequenceIndex;
+  uint32_t m_seed;
+  std::vector<ActionMask> m_frames{};
+  std::optional<DemoStart> m_demoStart{};
+  bool m_valid = true;
+};
+} // namespace hid
@@ -0,0 +1,96 @@
+#define BOOST_TEST_MODULE hid_test
+
+#include "inputrecording.h"
+
+#include <boost/test/included/unit_test.hpp>
+#include <cstring>
+#include <fstream>
+
+using namespace hid;
+
+BOOST_AUTO_TEST_SUITE(input_recording_tests)
+
+BOOST_AUTO_TEST_CASE(test_action_mask)
+{
+  InputState state;
+  BOOST_CHECK_EQUAL(toActionMask(state), 0u);
+
+  state.actions[Action::Jump] = true;
+  state.actions[Action::Forward] = true;
+  BOOST_CHECK_EQUAL(toActionMask(state), toActionMask(Action::Jump) | toActionMask(Action::Forward));
+
+  state.actions[Action::Jump] = false;
+  BOOST_CHECK_EQUAL(toActionMask(state), toActionMask(Action::Forward));
+}
+
+BOOST_AUTO_TEST_CASE(test_save_and_load)
+{
+  InputRecording recording{3, 0x12345678u};
+  InputState state;
+  for(int i = 0; i < 100; ++i)
+  {
+    state.actions[Action::Roll] = i % 3 == 0;
+    state.actions[Action::Left] = i % 7 == 0;
+    recording.record(state);
+  }
+
+  const auto filename = boost::unit_test::framework::current_test_case().p_name.get() + ".rec";
+  recording.save(filename);
+  const auto loaded = InputRecording::load(filename);
+  std::filesystem::remove(filename);
+
+  BOOST_CHECK_EQUAL(loaded.getLevelSequenceIndex(), 3u);
+  BOOST_CHECK_EQUAL(loaded.getSeed(), 0x12345678u);
+  BOOST_CHECK(loaded.getFrames() == recording.getFrames());
+  BOOST_CHECK(!loaded.getDemoStart().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(test_load_rejects_other_files)
+{
+  const auto filename = boost::unit_test::framework::current_test_case().p_name.get() + ".rec";
+  {
+    std::ofstream file{filename, std::ios::out | std::ios::trunc | std::ios::binary};
+    file << "not a recording";
+  }
+  BOOST_CHECK_THROW(InputRecording::load(filename), std::runtime_error);
+  std::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(test_tr1_demo)
+{
+  // x, y, z, rotation x, y, z, room, followed by forward, forward+jump, nothing, the end marker and garbage
+  const uint32_t words[]{1024, static_cast<uint32_t>(-512), 2048, 0, 0x4000, 0, 5, 1, 1 | 16, 0, 0xffffffffu, 1};
+  std::vector<uint8_t> data(sizeof(words));
+  std::memcpy(data.data(), words, sizeof(words));
+
+  const auto recording = InputRecording::fromTr1Demo(2, data);
+  BOOST_REQUIRE(recording.getDemoStart().has_value());
+  BOOST_CHECK_EQUAL(recording.getDemoStart()->x, 1024);
+  BOOST_CHECK_EQUAL(recording.getDemoStart()->y, -512);
+  BOOST_CHECK_EQUAL(recording.getDemoStart()->rotationY, 0x4000);
+  BOOST_CHECK_EQUAL(recording.getDemoStart()->room, 5u);
+
+  BOOST_REQUIRE_EQUAL(recording.getFrames().size(), 3u);
+  BOOST_CHECK_EQUAL(recording.getFrames()[0], toActionMask(Action::Forward));
+  BOOST_CHECK_EQUAL(recording.getFrames()[1], toActionMask(Action::Forward) | toActionMask(Action::Jump));
+  BOOST_CHECK_EQUAL(recording.getFrames()[2], 0u);
+
+  BOOST_CHECK_THROW(InputRecording::fromTr1Demo(2, {}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_recording_is_not_saved)
+{
+  const auto filename = boost::unit_test::framework::current_test_case().p_name.get() + ".rec";
+  std::filesystem::remove(filename);
+
+  InputRecording recording{0, 1};
+  recording.record(InputState{});
+  BOOST_CHECK(recording.isValid());
+  recording.invalidate();
+  BOOST_CHECK(!recording.isValid());
+
+  BOOST_CHECK_THROW(recording.save(filename), std::runtime_error);
+  BOOST_CHECK(!std::filesystem::exists(filename));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 #include "render/scene/mesh.h"
 #include "render/scene/names.h"
 #include "render/scene/sprite.h"
+#include "render/scene/vertexpacking.h"
 #include "render/textureanimator.h"
 #include "serialization/box_ptr.h"
 #include "serialization/quantity.h"
@@ -28,14 +29,15 @@ namespace
 struct RenderVertex
 {
   glm::vec3 position{};
-  glm::vec4 color{1.0f};
-  glm::vec3 normal{0.0f};
+  glm::u8vec4 color{render::scene::packVertexColor(glm::vec4{1.0f})};
+  gl::Int2101010Rev normal{};
 
   static const gl::VertexFormat<RenderVertex>& getFormat()
   {
-    static const gl::VertexFormat<RenderVertex> format{{VERTEX_ATTRIBUTE_POSITION_NAME, &RenderVertex::position},
-                                                       {VERTEX_ATTRIBUTE_NORMAL_NAME, &RenderVertex::normal},
-                                                       {VERTEX_ATTRIBUTE_COLOR_NAME, &RenderVertex::color}};
+    static const gl::VertexFormat<RenderVertex> format{
+      {VERTEX_ATTRIBUTE_POSITION_NAME, &RenderVertex::position},
+      {VERTEX_ATTRIBUTE_NORMAL_NAME, gl::VertexAttribute<RenderVertex>{&RenderVertex::normal, true}},
+      {VERTEX_ATTRIBUTE_COLOR_NAME, gl::VertexAttribute<RenderVertex>{&RenderVertex::color, true}}};
 
     return format;
   }
@@ -45,7 +47,7 @@ struct RenderVertex
 
 struct RenderMesh
 {
-  using IndexType = uint16_t;
+  using IndexType = uint32_t;
   std::vector<IndexType> m_indices;
   std::shared_ptr<render::scene::Material> m_materialFull;
   std::shared_ptr<render::scene::Material> m_materialCSMDepthOnly;
@@ -62,13 +64,32 @@ struct RenderMesh
     }
 #endif
 
-    auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<IndexType>>();
-    indexBuffer->setData(m_indices, gl::api::BufferUsageARB::StaticDraw);
+    // only use 32 bit indices if the vertices can't be addressed with 16 bit indices
+    if(vbuf->size() <= static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1)
+      return toMesh<uint16_t>(vbuf, uvBuf);
+    else
+      return toMesh<uint32_t>(vbuf, uvBuf);
+  }
+
+private:
+  template<typename IndexT>
+  std::shared_ptr<render::scene::Mesh>
+    toMesh(const gsl::not_null<std::shared_ptr<gl::VertexBuffer<RenderVertex>>>& vbuf,
+           const gsl::not_null<std::shared_ptr<gl::VertexBuffer<render::TextureAnimator::AnimatedUV>>>& uvBuf)
+  {
+    std::vector<IndexT> indices;
+    indices.reserve(m_indices.size());
+    std::transform(m_indices.begin(), m_indices.end(), std::back_inserter(indices), [](auto idx) {
+      return gsl::narrow_cast<IndexT>(idx);
+    });
+
+    auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<IndexT>>();
+    indexBuffer->setData(indices, gl::api::BufferUsageARB::StaticDraw);
 
     auto vBufs = std::make_tuple(vbuf, uvBuf);
 
-    auto mesh = std::make_shared<render::scene::MeshImpl<IndexType, RenderVertex, render::TextureAnimator::AnimatedUV>>(
-      std::make_shared<gl::VertexArray<IndexType, RenderVertex, render::TextureAnimator::AnimatedUV>>(
+    auto mesh = std::make_shared<render::scene::MeshImpl<IndexT, RenderVertex, render::TextureAnimator::AnimatedUV>>(
+      std::make_shared<gl::VertexArray<IndexT, RenderVertex, render::TextureAnimator::AnimatedUV>>(
         indexBuffer,
         vBufs,
         std::vector{&m_materialFull->getShaderProgram()->getHandle(),
@@ -121,8 +142,9 @@ void Room::createSceneNode(const size_t roomId,
   auto vbuf = std::make_shared<gl::VertexBuffer<RenderVertex>>(RenderVertex::getFormat(), label);
 
   static const gl::VertexFormat<render::TextureAnimator::AnimatedUV> uvAttribs{
-    {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, gl::VertexAttribute{&render::TextureAnimator::AnimatedUV::uv}},
-    {VERTEX_ATTRIBUTE_TEXINDEX_NAME, gl::VertexAttribute{&render::TextureAnimator::AnimatedUV::index}},
+    {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME,
+     gl::VertexAttribute<render::TextureAnimator::AnimatedUV>{&render::TextureAnimator::AnimatedUV::uv, true}},
+    {VERTEX_ATTRIBUTE_TEXINDEX_NAME, &render::TextureAnimator::AnimatedUV::index},
   };
   auto uvCoords = std::make_shared<gl::VertexBuffer<render::TextureAnimator::AnimatedUV>>(uvAttribs, label + "-uv");
 
@@ -151,22 +173,24 @@ void Room::createSceneNode(const size_t roomId,
     {
       RenderVertex iv;
       iv.position = quad.vertices[i].from(vertices).position.toRenderSystem();
-      iv.color = quad.vertices[i].from(vertices).color;
+      iv.color = render::scene::packVertexColor(quad.vertices[i].from(vertices).color);
       uvCoordsData.emplace_back(tile.textureKey.tileAndFlag & texMask, tile.uvCoordinates[i].toGl());
 
       if(i <= 2)
       {
         static const std::array<int, 3> indices{0, 1, 2};
-        iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(vertices).position,
-                                   quad.vertices[indices[(i + 1) % 3]].from(vertices).position,
-                                   quad.vertices[indices[(i + 2) % 3]].from(vertices).position);
+        iv.normal = render::scene::packVertexNormal(
+          generateNormal(quad.vertices[indices[(i + 0) % 3]].from(vertices).position,
+                         quad.vertices[indices[(i + 1) % 3]].from(vertices).position,
+                         quad.vertices[indices[(i + 2) % 3]].from(vertices).position));
       }
       else
       {
         static const std::array<int, 3> indices{0, 2, 3};
-        iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(vertices).position,
-                                   quad.vertices[indices[(i + 1) % 3]].from(vertices).position,
-                                   quad.vertices[indices[(i + 2) % 3]].from(vertices).position);
+        iv.normal = render::scene::packVertexNormal(
+          generateNormal(quad.vertices[indices[(i + 0) % 3]].from(vertices).position,
+                         quad.vertices[indices[(i + 1) % 3]].from(vertices).position,
+                         quad.vertices[indices[(i + 2) % 3]].from(vertices).position));
       }
 
       vbufData.emplace_back(iv);
@@ -203,13 +227,14 @@ void Room::createSceneNode(const size_t roomId,
     {
       RenderVertex iv;
       iv.position = tri.vertices[i].from(vertices).position.toRenderSystem();
-      iv.color = tri.vertices[i].from(vertices).color;
+      iv.color = render::scene::packVertexColor(tri.vertices[i].from(vertices).color);
       uvCoordsData.emplace_back(tile.textureKey.tileAndFlag & texMask, tile.uvCoordinates[i].toGl());
 
       static const std::array<int, 3> indices{0, 1, 2};
-      iv.normal = generateNormal(tri.vertices[indices[(i + 0) % 3]].from(vertices).position,
-                                 tri.vertices[indices[(i + 1) % 3]].from(vertices).position,
-                                 tri.vertices[indices[(i + 2) % 3]].from(vertices).position);
+      iv.normal = render::scene::packVertexNormal(
+        generateNormal(tri.vertices[indices[(i + 0) % 3]].from(vertices).position,
+                       tri.vertices[indices[(i + 1) % 3]].from(vertices).position,
+                       tri.vertices[indices[(i + 2) % 3]].from(vertices).position));
 
       vbufData.push_back(iv);
     }
@@ -234,11 +259,6 @@ void Room::createSceneNode(const size_t roomId,
   node->addUniformSetter("u_lightAmbient",
                          [](const render::scene::Node& /*node*/, gl::Uniform& uniform) { uniform.set(1.0f); });
 
-  static gl::ShaderStorageBuffer<engine::Lighting::Light> emptyBuffer{"lights-buffer-empty"};
-  node->addBufferBinder("b_lights", [](const render::scene::Node&, gl::ShaderStorageBlock& shaderStorageBlock) {
-    shaderStorageBlock.bind(emptyBuffer);
-  });
-
   for(const RoomStaticMesh& sm : staticMeshes)
   {
     const auto staticRenderMesh = level.findStaticRenderMeshById(sm.meshId);
@@ -291,9 +311,38 @@ void Room::createSceneNode(const size_t roomId,
   for(auto& portal : portals)
     portal.buildMesh(materialManager.getPortal());
 
+  buildOcclusionQueryMesh(materialManager.getOcclusionQuery());
+
   resetScenery();
 }
 
+void Room::buildOcclusionQueryMesh(const gsl::not_null<std::shared_ptr<render::scene::Material>>& material)
+{
+  if(vertices.empty())
+  {
+    occlusionQueryMesh = nullptr;
+    return;
+  }
+
+  // objects belong to exactly one room, but may extend into neighbouring rooms
+  static constexpr auto Margin = core::SectorSize.get<float>();
+
+  occlusionBoxMin = glm::vec3{std::numeric_limits<float>::max()};
+  occlusionBoxMax = glm::vec3{std::numeric_limits<float>::lowest()};
+  for(const auto& vertex : vertices)
+  {
+    const auto p = (vertex.position + position).toRenderSystem();
+    occlusionBoxMin = glm::min(occlusionBoxMin, p);
+    occlusionBoxMax = glm::max(occlusionBoxMax, p);
+  }
+  occlusionBoxMin -= glm::vec3{Margin};
+  occlusionBoxMax += glm::vec3{Margin};
+
+  occlusionQueryMesh
+    = render::scene::createBoxMesh(occlusionBoxMin, occlusionBoxMax, material->getShaderProgram()->getHandle());
+  occlusionQueryMesh->getMaterial().set(render::scene::RenderMode::DepthOnly, material);
+}
+
 core::BoundingBox StaticMesh::getCollisionBox(const core::TRVec& pos, const core::Angle& angle) const
 {
   auto result = collision_box;
@@ -1013,6 +1062,7 @@ void Sector::serialize(const serialization::Serializer<engine::World>& ser)
     roomAbove = nullptr;
     floorData = nullptr;
     portalTarget = nullptr;
+    heights = {};
   }
 }
 
@@ -1059,11 +1109,14 @@ void Sector::updateCaches(std::vector<Room>& rooms,
     {
       portalTarget = nullptr;
     }
+
+    heights = engine::floordata::SectorHeights::decode(floorData);
   }
   else
   {
     floorData = nullptr;
     portalTarget = nullptr;
+    heights = {};
   }
 }
 
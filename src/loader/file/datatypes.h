@@ -5,6 +5,7 @@
 #include "core/id.h"
 #include "core/magic.h"
 #include "core/vec.h"
+#include "engine/floordata/sectorheights.h"
 #include "engine/floordata/types.h"
 #include "meshes.h"
 #include "primitives.h"
@@ -81,6 +82,7 @@ struct Sector
   core::ContainerIndex<uint16_t, engine::floordata::FloorDataValue> floorDataIndex;
   const engine::floordata::FloorDataValue* floorData = nullptr;
   Room* portalTarget = nullptr;
+  engine::floordata::SectorHeights heights{}; // cached from floordata
 
   core::BoxId boxIndex{int16_t(-1)}; //!< Index into Boxes[]/Zones[] (-1 if none)
   const Box* box = nullptr;
@@ -99,6 +101,7 @@ struct Sector
     floorDataIndex = uint16_t{0};
     floorData = nullptr;
     portalTarget = nullptr; // cached from floordata
+    heights = {};
     boxIndex = int16_t(-1);
     box = nullptr;
     roomIndexBelow = uint8_t(-1);
@@ -276,6 +279,10 @@ struct Room
 {
   std::shared_ptr<render::scene::Node> node = nullptr;
   std::vector<std::shared_ptr<render::scene::Node>> sceneryNodes{};
+  //! World space proxy geometry for occlusion queries, enlarged to also cover objects sticking out of the room
+  std::shared_ptr<render::scene::Mesh> occlusionQueryMesh = nullptr;
+  glm::vec3 occlusionBoxMin{};
+  glm::vec3 occlusionBoxMax{};
 
   // Various room flags specify various room options. Mostly, they
   // specify environment type and some additional actions which should
@@ -464,6 +471,8 @@ struct Room
 
   void resetScenery();
 
+  void buildOcclusionQueryMesh(const gsl::not_null<std::shared_ptr<render::scene::Material>>& material);
+
   void serialize(const serialization::Serializer<engine::World>& ser);
 };
 
@@ -269,6 +269,36 @@ void Level::updateRoomBasedCaches()
       sector.updateCaches(m_rooms, m_boxes, m_floorData);
     }
   }
+
+  m_roomLightNeighbourhoods = engine::RoomLightNeighbourhoods{m_rooms};
+}
+
+void Level::buildPotentiallyVisibleSets()
+{
+  render::PotentiallyVisibleSet::RoomPortals roomPortals;
+  roomPortals.reserve(m_rooms.size());
+  for(const Room& room : m_rooms)
+  {
+    auto& portals = roomPortals.emplace_back();
+    for(const Portal& portal : room.portals)
+    {
+      auto& geometry = portals.emplace_back();
+      geometry.adjoiningRoom = portal.adjoining_room.get();
+      geometry.normal = portal.normal.toRenderSystem();
+      for(size_t i = 0; i < portal.vertices.size(); ++i)
+        geometry.vertices[i] = portal.vertices[i].toRenderSystem();
+    }
+  }
+
+  m_potentiallyVisibleSets[0] = render::PotentiallyVisibleSet{roomPortals};
+
+  // swapping the rooms keeps their indices, so the portals still lead to the same slots
+  for(size_t i = 0; i < m_rooms.size(); ++i)
+  {
+    if(m_rooms[i].alternateRoom.get() >= 0)
+      std::swap(roomPortals[i], roomPortals.at(m_rooms[i].alternateRoom.get()));
+  }
+  m_potentiallyVisibleSets[1] = render::PotentiallyVisibleSet{roomPortals};
 }
 
 void Level::postProcessDataStructures()
@@ -276,6 +306,7 @@ void Level::postProcessDataStructures()
   BOOST_LOG_TRIVIAL(info) << "Post-processing data structures";
 
   updateRoomBasedCaches();
+  buildPotentiallyVisibleSets();
 
   Expects(m_baseZones.flyZone.size() == m_boxes.size());
   Expects(m_baseZones.groundZone1.size() == m_boxes.size());
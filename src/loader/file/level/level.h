@@ -9,7 +9,9 @@
 #include "loader/file/io/sdlreader.h"
 #include "loader/file/item.h"
 #include "loader/file/mesh.h"
+#include "render/potentiallyvisibleset.h"
 
+#include <array>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -51,6 +53,11 @@ public:
 
   std::vector<Room> m_rooms;
 
+  //! Conservative room visibility for the original rooms and with the alternate rooms swapped in
+  std::array<render::PotentiallyVisibleSet, 2> m_potentiallyVisibleSets;
+
+  engine::RoomLightNeighbourhoods m_roomLightNeighbourhoods;
+
   std::vector<uint32_t> m_meshIndices;
 
   std::vector<Animation> m_animations;
@@ -145,6 +152,9 @@ public:
 
   void updateRoomBasedCaches();
 
+  //! Builds both entries of m_potentiallyVisibleSets; the rooms must be in their original order
+  void buildPotentiallyVisibleSets();
+
   const auto& getFilename() const
   {
     return m_filename;
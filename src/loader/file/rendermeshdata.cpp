@@ -6,102 +6,118 @@
 #include "render/scene/rendermode.h"
 #include "util.h"
 
+#include <boost/container_hash/hash.hpp>
 #include <gl/vertexarray.h>
 #include <render/renderpipeline.h>
 
 namespace loader::file
 {
+namespace
+{
+struct RenderVertexHash
+{
+  size_t operator()(const RenderMeshData::RenderVertex& v) const noexcept
+  {
+    size_t seed = 0;
+    boost::hash_combine(seed, v.position.x);
+    boost::hash_combine(seed, v.position.y);
+    boost::hash_combine(seed, v.position.z);
+    boost::hash_combine(seed, v.normal.value);
+    boost::hash_combine(seed, v.color.r);
+    boost::hash_combine(seed, v.color.g);
+    boost::hash_combine(seed, v.color.b);
+    boost::hash_combine(seed, v.color.a);
+    boost::hash_combine(seed, v.uv.x);
+    boost::hash_combine(seed, v.uv.y);
+    boost::hash_combine(seed, v.textureIndex);
+    boost::hash_combine(seed, v.boneIndex);
+    return seed;
+  }
+};
+
+template<size_t N>
+glm::vec3 getNormal(const Mesh& mesh, const std::array<VertexIndex, N>& faceVertices, const int i)
+{
+  if(mesh.isFlatShaded() || mesh.normals.empty()
+     || faceVertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
+  {
+    if(i <= 2)
+    {
+      static const std::array<int, 3> indices{0, 1, 2};
+      return generateNormal(faceVertices[indices[(i + 0) % 3]].from(mesh.vertices),
+                            faceVertices[indices[(i + 1) % 3]].from(mesh.vertices),
+                            faceVertices[indices[(i + 2) % 3]].from(mesh.vertices));
+    }
+    else
+    {
+      static const std::array<int, 3> indices{0, 2, 3};
+      return generateNormal(faceVertices[indices[(i + 0) % 3]].from(mesh.vertices),
+                            faceVertices[indices[(i + 1) % 3]].from(mesh.vertices),
+                            faceVertices[indices[(i + 2) % 3]].from(mesh.vertices));
+    }
+  }
+  else
+  {
+    // stored normals have a length of about 16384, but the packed format only holds unit vectors
+    return glm::normalize(faceVertices[i].from(mesh.normals).toRenderSystem());
+  }
+}
+} // namespace
+
 RenderMeshData::RenderMeshData(const Mesh& mesh, const std::vector<TextureTile>& textureTiles, const Palette& palette)
 {
+  // faces of a mesh often share vertices with identical attributes, so only unique vertices are stored
+  render::scene::VertexWelder<RenderVertex, IndexType, RenderVertexHash> welder{m_vertices};
+
   for(const QuadFace& quad : mesh.textured_rectangles)
   {
     const TextureTile& tile = textureTiles.at(quad.tileId.get());
 
-    const auto firstVertex = m_vertices.size();
+    std::array<IndexType, 4> quadIndices{};
     for(int i = 0; i < 4; ++i)
     {
       RenderVertex iv{};
-      iv.textureIndex = tile.textureKey.tileAndFlag & TextureIndexMask;
+      iv.textureIndex = gsl::narrow<glm::int16_t>(tile.textureKey.tileAndFlag & TextureIndexMask);
 
       if(mesh.normals.empty())
-        iv.color = glm::vec4(glm::vec3{toBrightness(quad.vertices[i].from(mesh.vertexShades)).get()}, 1.0f);
-
-      if(mesh.isFlatShaded() || mesh.normals.empty()
-         || quad.vertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
-      {
-        if(i <= 2)
-        {
-          static const std::array<int, 3> indices{0, 1, 2};
-          iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-        }
-        else
-        {
-          static const std::array<int, 3> indices{0, 2, 3};
-          iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-        }
-      }
-      else
-      {
-        iv.normal = quad.vertices[i].from(mesh.normals).toRenderSystem();
-      }
+        iv.color = render::scene::packVertexColor(
+          glm::vec4(glm::vec3{toBrightness(quad.vertices[i].from(mesh.vertexShades)).get()}, 1.0f));
 
+      iv.normal = render::scene::packVertexNormal(getNormal(mesh, quad.vertices, i));
       iv.position = quad.vertices[i].from(mesh.vertices).toRenderSystem();
-      iv.uv = tile.uvCoordinates[i].toGl();
-      m_vertices.emplace_back(iv);
+      iv.uv = render::scene::packVertexUV(tile.uvCoordinates[i].toGl());
+      quadIndices[i] = welder.add(iv);
     }
 
     for(size_t i : {0, 1, 2, 0, 2, 3})
     {
       // cppcheck-suppress useStlAlgorithm
-      m_indices.emplace_back(gsl::narrow<IndexType>(firstVertex + i));
+      m_indices.emplace_back(quadIndices[i]);
     }
   }
   for(const QuadFace& quad : mesh.colored_rectangles)
   {
     const auto color = glm::vec4{gsl::at(palette.colors, quad.tileId.get() & 0xffu).toGLColor3(), 1.0f};
 
-    const auto firstVertex = m_vertices.size();
+    std::array<IndexType, 4> quadIndices{};
     for(int i = 0; i < 4; ++i)
     {
       RenderVertex iv{};
       iv.position = quad.vertices[i].from(mesh.vertices).toRenderSystem();
       iv.textureIndex = -1;
-      iv.color = color;
       if(mesh.normals.empty())
-        iv.color *= toBrightness(quad.vertices[i].from(mesh.vertexShades)).get();
-
-      if(mesh.isFlatShaded() || mesh.normals.empty()
-         || quad.vertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
-      {
-        if(i <= 2)
-        {
-          static const std::array<int, 3> indices{0, 1, 2};
-          iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-        }
-        else
-        {
-          static const std::array<int, 3> indices{0, 2, 3};
-          iv.normal = generateNormal(quad.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                     quad.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-        }
-      }
+        iv.color = render::scene::packVertexColor(color
+                                                  * toBrightness(quad.vertices[i].from(mesh.vertexShades)).get());
       else
-      {
-        iv.normal = quad.vertices[i].from(mesh.normals).toRenderSystem();
-      }
-      m_vertices.emplace_back(iv);
+        iv.color = render::scene::packVertexColor(color);
+
+      iv.normal = render::scene::packVertexNormal(getNormal(mesh, quad.vertices, i));
+      quadIndices[i] = welder.add(iv);
     }
     for(size_t i : {0, 1, 2, 0, 2, 3})
     {
       // cppcheck-suppress useStlAlgorithm
-      m_indices.emplace_back(gsl::narrow<IndexType>(firstVertex + i));
+      m_indices.emplace_back(quadIndices[i]);
     }
   }
 
@@ -113,25 +129,14 @@ RenderMeshData::RenderMeshData(const Mesh& mesh, const std::vector<TextureTile>&
     {
       RenderVertex iv{};
       iv.position = tri.vertices[i].from(mesh.vertices).toRenderSystem();
-      iv.textureIndex = tile.textureKey.tileAndFlag & TextureIndexMask;
-      iv.uv = tile.uvCoordinates[i].toGl();
+      iv.textureIndex = gsl::narrow<glm::int16_t>(tile.textureKey.tileAndFlag & TextureIndexMask);
+      iv.uv = render::scene::packVertexUV(tile.uvCoordinates[i].toGl());
       if(mesh.normals.empty())
-        iv.color = glm::vec4{glm::vec3{toBrightness(tri.vertices[i].from(mesh.vertexShades)).get()}, 1.0f};
-
-      if(mesh.isFlatShaded() || mesh.normals.empty()
-         || tri.vertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
-      {
-        static const std::array<int, 3> indices{0, 1, 2};
-        iv.normal = generateNormal(tri.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                   tri.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                   tri.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-      }
-      else
-      {
-        iv.normal = tri.vertices[i].from(mesh.normals).toRenderSystem();
-      }
-      m_indices.emplace_back(gsl::narrow<IndexType>(m_vertices.size()));
-      m_vertices.emplace_back(iv);
+        iv.color = render::scene::packVertexColor(
+          glm::vec4{glm::vec3{toBrightness(tri.vertices[i].from(mesh.vertexShades)).get()}, 1.0f});
+
+      iv.normal = render::scene::packVertexNormal(getNormal(mesh, tri.vertices, i));
+      m_indices.emplace_back(welder.add(iv));
     }
   }
 
@@ -144,26 +149,18 @@ RenderMeshData::RenderMeshData(const Mesh& mesh, const std::vector<TextureTile>&
       RenderVertex iv{};
       iv.position = tri.vertices[i].from(mesh.vertices).toRenderSystem();
       iv.textureIndex = -1;
-      iv.color = color;
       if(mesh.normals.empty())
-        iv.color *= glm::vec4{glm::vec3{toBrightness(tri.vertices[i].from(mesh.vertexShades)).get()}, 1.0f};
-
-      if(mesh.isFlatShaded() || mesh.normals.empty()
-         || tri.vertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
-      {
-        static const std::array<int, 3> indices{0, 1, 2};
-        iv.normal = generateNormal(tri.vertices[indices[(i + 0) % 3]].from(mesh.vertices),
-                                   tri.vertices[indices[(i + 1) % 3]].from(mesh.vertices),
-                                   tri.vertices[indices[(i + 2) % 3]].from(mesh.vertices));
-      }
+        iv.color = render::scene::packVertexColor(
+          color * glm::vec4{glm::vec3{toBrightness(tri.vertices[i].from(mesh.vertexShades)).get()}, 1.0f});
       else
-      {
-        iv.normal = tri.vertices[i].from(mesh.normals).toRenderSystem();
-      }
-      m_indices.emplace_back(gsl::narrow<IndexType>(m_vertices.size()));
-      m_vertices.emplace_back(iv);
+        iv.color = render::scene::packVertexColor(color);
+
+      iv.normal = render::scene::packVertexNormal(getNormal(mesh, tri.vertices, i));
+      m_indices.emplace_back(welder.add(iv));
     }
   }
+
+  m_vertices.shrink_to_fit();
 }
 
 gsl::not_null<std::shared_ptr<render::scene::Mesh>> RenderMeshDataCompositor::toMesh(
@@ -179,21 +176,42 @@ gsl::not_null<std::shared_ptr<render::scene::Mesh>> RenderMeshDataCompositor::to
     BOOST_ASSERT(idx < m_vertices.size());
   }
 #endif
-  auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<RenderMeshData::IndexType>>();
-  indexBuffer->setData(m_indices, gl::api::BufferUsageARB::DynamicDraw);
+
+  // only use 32 bit indices if the vertices can't be addressed with 16 bit indices
+  if(m_vertices.size() <= static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1)
+    return toMesh<uint16_t>(materialManager, skeletal, label, vb);
+  else
+    return toMesh<uint32_t>(materialManager, skeletal, label, vb);
+}
+
+template<typename IndexT>
+gsl::not_null<std::shared_ptr<render::scene::Mesh>> RenderMeshDataCompositor::toMesh(
+  render::scene::MaterialManager& materialManager,
+  bool skeletal,
+  const std::string& label,
+  const gsl::not_null<std::shared_ptr<gl::VertexBuffer<RenderMeshData::RenderVertex>>>& vb)
+{
+  std::vector<IndexT> indices;
+  indices.reserve(m_indices.size());
+  std::transform(m_indices.begin(), m_indices.end(), std::back_inserter(indices), [](auto idx) {
+    return gsl::narrow_cast<IndexT>(idx);
+  });
+
+  auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<IndexT>>();
+  indexBuffer->setData(indices, gl::api::BufferUsageARB::StaticDraw);
 
   const auto material = materialManager.getGeometry(false, skeletal, false);
   const auto materialCSMDepthOnly = materialManager.getCSMDepthOnly(skeletal);
   const auto materialDepthOnly = materialManager.getDepthOnly(skeletal);
 
-  auto va = std::make_shared<gl::VertexArray<RenderMeshData::IndexType, RenderMeshData::RenderVertex>>(
+  auto va = std::make_shared<gl::VertexArray<IndexT, RenderMeshData::RenderVertex>>(
     indexBuffer,
     vb,
     std::vector<const gl::Program*>{&material->getShaderProgram()->getHandle(),
                                     &materialDepthOnly->getShaderProgram()->getHandle(),
                                     &materialCSMDepthOnly->getShaderProgram()->getHandle()},
     label);
-  auto mesh = std::make_shared<render::scene::MeshImpl<RenderMeshData::IndexType, RenderMeshData::RenderVertex>>(
+  auto mesh = std::make_shared<render::scene::MeshImpl<IndexT, RenderMeshData::RenderVertex>>(
     va, gl::api::PrimitiveType::Triangles);
   mesh->getMaterial()
     .set(render::scene::RenderMode::Full, material)
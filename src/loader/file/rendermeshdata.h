@@ -2,6 +2,7 @@
 
 #include "mesh.h"
 #include "render/scene/names.h"
+#include "render/scene/vertexpacking.h"
 #include "texture.h"
 
 #include <gl/vertexbuffer.h>
@@ -18,25 +19,32 @@ namespace loader::file
 class RenderMeshData final
 {
 public:
-  using IndexType = uint16_t;
+  using IndexType = uint32_t;
 
   struct RenderVertex
   {
-    glm::vec3 position;
-    glm::vec3 normal;
-    glm::vec4 color{1.0f};
-    glm::vec2 uv;
-    glm::int32_t textureIndex{-1};
-    glm::int32_t boneIndex{-1};
+    glm::vec3 position{};
+    gl::Int2101010Rev normal{};
+    glm::u8vec4 color{render::scene::packVertexColor(glm::vec4{1.0f})};
+    glm::u16vec2 uv{};
+    glm::int16_t textureIndex{-1};
+    glm::int16_t boneIndex{-1};
+
+    bool operator==(const RenderVertex& rhs) const noexcept
+    {
+      return position == rhs.position && normal == rhs.normal && color == rhs.color && uv == rhs.uv
+             && textureIndex == rhs.textureIndex && boneIndex == rhs.boneIndex;
+    }
 
     static const gl::VertexFormat<RenderVertex>& getFormat()
     {
-      static const gl::VertexFormat<RenderVertex> format{{VERTEX_ATTRIBUTE_POSITION_NAME, &RenderVertex::position},
-                                                         {VERTEX_ATTRIBUTE_NORMAL_NAME, &RenderVertex::normal},
-                                                         {VERTEX_ATTRIBUTE_COLOR_NAME, &RenderVertex::color},
-                                                         {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, &RenderVertex::uv},
-                                                         {VERTEX_ATTRIBUTE_TEXINDEX_NAME, &RenderVertex::textureIndex},
-                                                         {VERTEX_ATTRIBUTE_BONE_INDEX_NAME, &RenderVertex::boneIndex}};
+      static const gl::VertexFormat<RenderVertex> format{
+        {VERTEX_ATTRIBUTE_POSITION_NAME, &RenderVertex::position},
+        {VERTEX_ATTRIBUTE_NORMAL_NAME, gl::VertexAttribute<RenderVertex>{&RenderVertex::normal, true}},
+        {VERTEX_ATTRIBUTE_COLOR_NAME, gl::VertexAttribute<RenderVertex>{&RenderVertex::color, true}},
+        {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, gl::VertexAttribute<RenderVertex>{&RenderVertex::uv, true}},
+        {VERTEX_ATTRIBUTE_TEXINDEX_NAME, &RenderVertex::textureIndex},
+        {VERTEX_ATTRIBUTE_BONE_INDEX_NAME, &RenderVertex::boneIndex}};
 
       return format;
     }
@@ -74,7 +82,7 @@ public:
     for(auto i : data.getIndices())
     {
       // cppcheck-suppress useStlAlgorithm
-      m_indices.emplace_back(gsl::narrow<RenderMeshData::IndexType>(i + vertexOffset));
+      m_indices.emplace_back(i + vertexOffset);
     }
 
     ++m_boneIndex;
@@ -93,9 +101,21 @@ public:
     return m_vertices.empty() || m_indices.empty();
   }
 
+  [[nodiscard]] const auto& getVertices() const
+  {
+    return m_vertices;
+  }
+
 private:
+  template<typename IndexT>
+  gsl::not_null<std::shared_ptr<render::scene::Mesh>>
+    toMesh(render::scene::MaterialManager& materialManager,
+           bool skeletal,
+           const std::string& label,
+           const gsl::not_null<std::shared_ptr<gl::VertexBuffer<RenderMeshData::RenderVertex>>>& vb);
+
   std::vector<RenderMeshData::RenderVertex> m_vertices{};
   std::vector<RenderMeshData::IndexType> m_indices{};
-  glm::int32_t m_boneIndex = 0;
+  glm::int16_t m_boneIndex = 0;
 };
-} // namespace loader::file
\ No newline at end of file
+} // namespace loader::file
@@ -0,0 +1,195 @@
+#define BOOST_TEST_MODULE loader_test
+
+#include "loader/file/level/level.h"
+#include "loader/file/rendermeshdata.h"
+#include "loader/file/util.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace loader::file;
+
+namespace
+{
+std::unique_ptr<level::Level> loadTestLevel()
+{
+  auto level = level::Level::createLoader(TEST_LEVEL, level::Game::Unknown);
+  level->loadFileData();
+  return level;
+}
+
+//! A face corner in the unpacked vertex format used before the packed one
+struct FloatVertex
+{
+  glm::vec3 normal;
+  glm::vec4 color{1.0f};
+  glm::vec2 uv{0.0f};
+  glm::int32_t textureIndex{-1};
+};
+
+//! The normal of a face corner as the unpacked vertex format used it, i.e. as a float vector normalized in the shader
+template<size_t N>
+glm::vec3 getFloatNormal(const Mesh& mesh, const std::array<VertexIndex, N>& faceVertices, const int i)
+{
+  if(mesh.isFlatShaded() || mesh.normals.empty()
+     || faceVertices[i].from(mesh.normals) == core::TRVec{0_len, 0_len, 0_len})
+  {
+    const std::array<int, 3> indices = i <= 2 ? std::array<int, 3>{0, 1, 2} : std::array<int, 3>{0, 2, 3};
+    return generateNormal(faceVertices[indices[(i + 0) % 3]].from(mesh.vertices),
+                          faceVertices[indices[(i + 1) % 3]].from(mesh.vertices),
+                          faceVertices[indices[(i + 2) % 3]].from(mesh.vertices));
+  }
+
+  return glm::normalize(glm::vec3{faceVertices[i].from(mesh.normals).toRenderSystem()});
+}
+
+template<size_t N>
+float getBrightness(const Mesh& mesh, const std::array<VertexIndex, N>& faceVertices, const int i)
+{
+  return toBrightness(faceVertices[i].from(mesh.vertexShades)).get();
+}
+
+//! The corners of all faces in the order the render mesh emits them, quads as the triangles (0, 1, 2) and (0, 2, 3),
+//! computed like the unpacked vertex format did
+std::vector<FloatVertex>
+  getFloatVertices(const Mesh& mesh, const std::vector<TextureTile>& textureTiles, const Palette& palette)
+{
+  std::vector<FloatVertex> vertices;
+  for(const QuadFace& quad : mesh.textured_rectangles)
+  {
+    const TextureTile& tile = textureTiles.at(quad.tileId.get());
+    for(const int i : {0, 1, 2, 0, 2, 3})
+    {
+      FloatVertex v{getFloatNormal(mesh, quad.vertices, i)};
+      v.textureIndex = tile.textureKey.tileAndFlag & TextureIndexMask;
+      v.uv = tile.uvCoordinates[i].toGl();
+      if(mesh.normals.empty())
+        v.color = glm::vec4{glm::vec3{getBrightness(mesh, quad.vertices, i)}, 1.0f};
+      vertices.emplace_back(v);
+    }
+  }
+  for(const QuadFace& quad : mesh.colored_rectangles)
+  {
+    for(const int i : {0, 1, 2, 0, 2, 3})
+    {
+      FloatVertex v{getFloatNormal(mesh, quad.vertices, i)};
+      v.color = glm::vec4{gsl::at(palette.colors, quad.tileId.get() & 0xffu).toGLColor3(), 1.0f};
+      if(mesh.normals.empty())
+        v.color *= getBrightness(mesh, quad.vertices, i);
+      vertices.emplace_back(v);
+    }
+  }
+  for(const Triangle& tri : mesh.textured_triangles)
+  {
+    const TextureTile& tile = textureTiles.at(tri.tileId.get());
+    for(const int i : {0, 1, 2})
+    {
+      FloatVertex v{getFloatNormal(mesh, tri.vertices, i)};
+      v.textureIndex = tile.textureKey.tileAndFlag & TextureIndexMask;
+      v.uv = tile.uvCoordinates[i].toGl();
+      if(mesh.normals.empty())
+        v.color = glm::vec4{glm::vec3{getBrightness(mesh, tri.vertices, i)}, 1.0f};
+      vertices.emplace_back(v);
+    }
+  }
+  for(const Triangle& tri : mesh.colored_triangles)
+  {
+    for(const int i : {0, 1, 2})
+    {
+      FloatVertex v{getFloatNormal(mesh, tri.vertices, i)};
+      v.color = glm::vec4{gsl::at(palette.colors, tri.tileId.get() & 0xffu).toGLColor3(), 1.0f};
+      if(mesh.normals.empty())
+        v.color *= glm::vec4{glm::vec3{getBrightness(mesh, tri.vertices, i)}, 1.0f};
+      vertices.emplace_back(v);
+    }
+  }
+  return vertices;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(render_mesh_data_tests)
+
+BOOST_AUTO_TEST_CASE(test_packed_vertices_match_float_vertices)
+{
+  const auto level = loadTestLevel();
+
+  // the precision of a 10 bit signed normalized component
+  constexpr float NormalTolerance = 2.0f / 511.0f;
+  constexpr float ColorTolerance = 0.5f / render::scene::VertexColorScale;
+  constexpr float UVTolerance = 0.5f / 65535.0f;
+
+  size_t smoothVertices = 0;
+  size_t shadedVertices = 0;
+  size_t texturedVertices = 0;
+  for(const Mesh& mesh : level->m_meshes)
+  {
+    const RenderMeshData data{mesh, level->m_textureTiles, *level->m_palette};
+    const auto expected = getFloatVertices(mesh, level->m_textureTiles, *level->m_palette);
+
+    BOOST_REQUIRE_EQUAL(data.getIndices().size(), expected.size());
+    for(size_t i = 0; i < expected.size(); ++i)
+    {
+      const auto& packed = data.getVertices().at(data.getIndices()[i]);
+
+      // degenerate faces have no normal in either path
+      if(!glm::any(glm::isnan(expected[i].normal)))
+      {
+        BOOST_CHECK_LE(glm::length(render::scene::unpackVertexNormal(packed.normal) - expected[i].normal),
+                       NormalTolerance);
+        if(!mesh.normals.empty() && !mesh.isFlatShaded())
+          ++smoothVertices;
+      }
+
+      // the packed colors cover the overbright range, and opacity can't exceed 1
+      const auto expectedColor = glm::clamp(
+        expected[i].color, glm::vec4{0.0f}, glm::vec4{glm::vec3{255.0f / render::scene::VertexColorScale}, 1.0f});
+      const auto colorError = glm::abs(render::scene::unpackVertexColor(packed.color) - expectedColor);
+      BOOST_CHECK(glm::all(
+        glm::lessThanEqual(colorError, glm::vec4{ColorTolerance, ColorTolerance, ColorTolerance, 0.5f / 255.0f})));
+      if(mesh.normals.empty())
+        ++shadedVertices;
+
+      BOOST_CHECK_EQUAL(packed.textureIndex, expected[i].textureIndex);
+      if(expected[i].textureIndex >= 0)
+      {
+        BOOST_CHECK(glm::all(glm::lessThanEqual(glm::abs(render::scene::unpackVertexUV(packed.uv) - expected[i].uv),
+                                                glm::vec2{UVTolerance})));
+        ++texturedVertices;
+      }
+
+      // the bone is assigned when composing meshes
+      BOOST_CHECK_EQUAL(packed.boneIndex, -1);
+    }
+  }
+
+  // the test level must actually contain smooth shaded, vertex shaded and textured meshes
+  BOOST_CHECK_GT(smoothVertices, 0);
+  BOOST_CHECK_GT(shadedVertices, 0);
+  BOOST_CHECK_GT(texturedVertices, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_composed_vertices_have_mesh_bone_index)
+{
+  const auto level = loadTestLevel();
+
+  RenderMeshDataCompositor compositor;
+  std::vector<size_t> vertexCounts;
+  for(const Mesh& mesh : level->m_meshes)
+  {
+    const RenderMeshData data{mesh, level->m_textureTiles, *level->m_palette};
+    compositor.append(data);
+    vertexCounts.emplace_back(data.getVertices().size());
+  }
+
+  const auto& vertices = compositor.getVertices();
+  size_t first = 0;
+  for(size_t bone = 0; bone < vertexCounts.size(); ++bone)
+  {
+    BOOST_REQUIRE_LE(first + vertexCounts[bone], vertices.size());
+    for(size_t i = first; i < first + vertexCounts[bone]; ++i)
+      BOOST_REQUIRE_EQUAL(vertices[i].boneIndex, static_cast<glm::int16_t>(bone));
+    first += vertexCounts[bone];
+  }
+  BOOST_CHECK_EQUAL(first, vertices.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -53,6 +53,22 @@ RenderSettingsMenuState::RenderSettingsMenuState(const std::shared_ptr<MenuRingT
     engine.i18n()(engine::I18n::WaterDenoise),
     [&engine]() { return engine.getEngineConfig().renderSettings.waterDenoise; },
     [&engine]() { toggle(engine, engine.getEngineConfig().renderSettings.waterDenoise); });
+  addSetting(
+    engine.i18n()(engine::I18n::OcclusionCulling),
+    [&engine]() { return engine.getEngineConfig().renderSettings.occlusionCulling; },
+    [&engine]() { toggle(engine, engine.getEngineConfig().renderSettings.occlusionCulling); });
+  addSetting(
+    engine.i18n()(engine::I18n::ClusteredLighting),
+    [&engine]() { return engine.getEngineConfig().renderSettings.clusteredLighting; },
+    [&engine]() { toggle(engine, engine.getEngineConfig().renderSettings.clusteredLighting); });
+  addSetting(
+    engine.i18n()(engine::I18n::UncappedFrameRate),
+    [&engine]() { return engine.getEngineConfig().renderSettings.uncappedFrameRate; },
+    [&engine]() { toggle(engine, engine.getEngineConfig().renderSettings.uncappedFrameRate); });
+  addSetting(
+    engine.i18n()(engine::I18n::VSync),
+    [&engine]() { return engine.getEngineConfig().renderSettings.vsync; },
+    [&engine]() { toggle(engine, engine.getEngineConfig().renderSettings.vsync); });
 }
 
 std::unique_ptr<MenuState>
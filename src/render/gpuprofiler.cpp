@@ -0,0 +1,26 @@
+#include "gpuprofiler.h"
+
+namespace render
+{
+GpuProfiler::Zone::Zone(GpuProfiler& profiler, const gsl::czstring name)
+{
+  if(!util::profiler::isEnabled())
+    return;
+
+  auto& timer = profiler.m_timers[name];
+  if(timer == nullptr)
+    timer = std::make_unique<gl::TimerQuery>(name);
+
+  timer->collect([name](const gl::TimerQuery::Clock::time_point& issued, const std::chrono::nanoseconds& elapsed) {
+    util::profiler::recordGpuZone(name, issued, elapsed);
+  });
+  timer->begin();
+  m_timer = timer.get();
+}
+
+GpuProfiler::Zone::~Zone()
+{
+  if(m_timer != nullptr)
+    m_timer->end();
+}
+} // namespace render
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "util/profiler.h"
+
+#include <gl/timerquery.h>
+#include <gsl-lite.hpp>
+#include <memory>
+#include <unordered_map>
+
+namespace render
+{
+//! Measures render passes on the GPU while the profiler is enabled; the results are recorded as GPU zones a few frames
+//! late. Passes must not be nested.
+class GpuProfiler final
+{
+public:
+  class Zone final
+  {
+  public:
+    explicit Zone(GpuProfiler& profiler, gsl::czstring name);
+
+    Zone(const Zone&) = delete;
+
+    Zone(Zone&&) noexcept = delete;
+
+    Zone& operator=(const Zone&) = delete;
+
+    Zone& operator=(Zone&&) = delete;
+
+    ~Zone();
+
+  private:
+    gl::TimerQuery* m_timer = nullptr;
+  };
+
+private:
+  // zone names are literals, so they are keyed by address
+  std::unordered_map<gsl::czstring, std::unique_ptr<gl::TimerQuery>> m_timers;
+};
+} // namespace render
+
+//! Measures the GPU time of the remainder of the enclosing scope as a zone named @a name, a string literal
+#define RENDER_GPU_ZONE(profiler, name)                                                                \
+  [[maybe_unused]] const ::render::GpuProfiler::Zone UTIL_PROFILER_DETAIL_CAT(renderGpuZone, __LINE__) \
+  {                                                                                                    \
+    profiler, name                                                                                     \
+  }
@@ -0,0 +1,144 @@
+#include "lightclustergrid.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <cmath>
+
+namespace render
+{
+namespace
+{
+// cluster bounds are slightly enlarged to tolerate rounding differences between the cluster assignment and the
+// cluster lookup
+constexpr float SliceEpsilon = 1e-3f;
+constexpr float NdcEpsilon = 1e-3f;
+
+uint32_t getTile(const float ndc, const uint32_t tiles)
+{
+  const auto tile = static_cast<int64_t>(std::floor((ndc + 1.0f) * 0.5f * static_cast<float>(tiles)));
+  return static_cast<uint32_t>(std::clamp(tile, int64_t{0}, static_cast<int64_t>(tiles) - 1));
+}
+
+//! Tiles covered by a view space coordinate range within a depth range, \p scale is the projection's scale factor of
+//! that axis
+std::optional<std::pair<uint32_t, uint32_t>> getTileRange(
+  const float min, const float max, const float depth0, const float depth1, const float scale, const uint32_t tiles)
+{
+  // the projected coordinate is scale * v / depth with depth > 0, so the extrema are at the range's corners
+  const auto ndcMin = scale * std::min(min / depth0, min / depth1) - NdcEpsilon;
+  const auto ndcMax = scale * std::max(max / depth0, max / depth1) + NdcEpsilon;
+  if(ndcMax < -1.0f || ndcMin > 1.0f)
+    return std::nullopt;
+
+  return std::pair{getTile(ndcMin, tiles), getTile(ndcMax, tiles)};
+}
+} // namespace
+
+template<typename F>
+void LightClusterGrid::forEachCluster(const glm::vec4& light, const F& f) const
+{
+  const auto center = glm::vec3{m_view * glm::vec4{glm::vec3{light}, 1.0f}};
+  const auto radius = light.w;
+
+  // the view direction is -z
+  const auto depthMin = std::max(-center.z - radius, m_nearPlane);
+  const auto depthMax = std::min(-center.z + radius, m_farPlane);
+  if(depthMin > depthMax)
+    return;
+
+  const auto sliceMax = getSlice(depthMax);
+  for(auto z = getSlice(depthMin); z <= sliceMax; ++z)
+  {
+    // the part of the sphere's bounding box within this slice
+    const auto depth0 = std::max(depthMin, std::min(getSliceDepth(z) * (1.0f - SliceEpsilon), depthMax));
+    const auto depth1 = std::min(depthMax, std::max(getSliceDepth(z + 1) * (1.0f + SliceEpsilon), depthMin));
+
+    const auto xRange = getTileRange(center.x - radius, center.x + radius, depth0, depth1, m_projection[0][0], SizeX);
+    if(!xRange.has_value())
+      continue;
+    const auto yRange = getTileRange(center.y - radius, center.y + radius, depth0, depth1, m_projection[1][1], SizeY);
+    if(!yRange.has_value())
+      continue;
+
+    for(auto y = yRange->first; y <= yRange->second; ++y)
+    {
+      for(auto x = xRange->first; x <= xRange->second; ++x)
+      {
+        f(getClusterIndex(x, y, z));
+      }
+    }
+  }
+}
+
+void LightClusterGrid::build(const glm::mat4& view,
+                             const glm::mat4& projection,
+                             const float nearPlane,
+                             const float farPlane,
+                             const std::vector<glm::vec4>& lights)
+{
+  BOOST_ASSERT(nearPlane > 0 && nearPlane < farPlane);
+
+  m_view = view;
+  m_projection = projection;
+  m_nearPlane = nearPlane;
+  m_farPlane = farPlane;
+
+  m_clusters.assign(ClusterCount, Cluster{});
+  for(const auto& light : lights)
+    forEachCluster(light, [this](const uint32_t cluster) { ++m_clusters[cluster].count; });
+
+  uint32_t offset = 0;
+  for(auto& cluster : m_clusters)
+  {
+    cluster.offset = offset;
+    offset += cluster.count;
+  }
+
+  m_lightIndices.resize(offset);
+  m_fillCounts.assign(ClusterCount, 0);
+  for(uint32_t i = 0; i < lights.size(); ++i)
+  {
+    forEachCluster(lights[i], [this, i](const uint32_t cluster) {
+      m_lightIndices[m_clusters[cluster].offset + m_fillCounts[cluster]++] = i;
+    });
+  }
+}
+
+std::optional<uint32_t> LightClusterGrid::findCluster(const glm::vec3& position) const
+{
+  const auto viewPos = m_view * glm::vec4{position, 1.0f};
+  const auto depth = -viewPos.z;
+  if(depth < m_nearPlane || depth > m_farPlane)
+    return std::nullopt;
+
+  const auto clipPos = m_projection * viewPos;
+  const auto ndc = glm::vec2{clipPos} / clipPos.w;
+  if(glm::any(glm::lessThan(ndc, glm::vec2{-1.0f})) || glm::any(glm::greaterThan(ndc, glm::vec2{1.0f})))
+    return std::nullopt;
+
+  return getClusterIndex(getTile(ndc.x, SizeX), getTile(ndc.y, SizeY), getSlice(depth));
+}
+
+std::vector<uint32_t> LightClusterGrid::getLights(const glm::vec3& position) const
+{
+  const auto cluster = findCluster(position);
+  if(!cluster.has_value() || m_clusters.empty())
+    return {};
+
+  const auto& range = m_clusters[*cluster];
+  return std::vector<uint32_t>{m_lightIndices.begin() + range.offset,
+                               m_lightIndices.begin() + range.offset + range.count};
+}
+
+uint32_t LightClusterGrid::getSlice(const float depth) const
+{
+  const auto slice = static_cast<int64_t>(
+    std::floor(std::log(depth / m_nearPlane) / std::log(m_farPlane / m_nearPlane) * static_cast<float>(SizeZ)));
+  return static_cast<uint32_t>(std::clamp(slice, int64_t{0}, int64_t{SizeZ} - 1));
+}
+
+float LightClusterGrid::getSliceDepth(const uint32_t slice) const
+{
+  return m_nearPlane * std::pow(m_farPlane / m_nearPlane, static_cast<float>(slice) / static_cast<float>(SizeZ));
+}
+} // namespace render
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace render
+{
+//! Assigns light spheres to clusters subdividing the view frustum into screen tiles and exponential depth slices.
+//! Assumes a symmetric perspective projection; keep the cluster lookup in sync with lighting.glsl.
+class LightClusterGrid final
+{
+public:
+  static constexpr uint32_t SizeX = 16;
+  static constexpr uint32_t SizeY = 9;
+  static constexpr uint32_t SizeZ = 24;
+  static constexpr uint32_t ClusterCount = SizeX * SizeY * SizeZ;
+
+  //! Range of a cluster's entries in the light index list, matches a uvec2 in std430 layout
+  struct Cluster
+  {
+    uint32_t offset = 0;
+    uint32_t count = 0;
+  };
+
+  //! \p lights contains world space positions and radii of the light spheres
+  void build(const glm::mat4& view,
+             const glm::mat4& projection,
+             float nearPlane,
+             float farPlane,
+             const std::vector<glm::vec4>& lights);
+
+  [[nodiscard]] const std::vector<Cluster>& getClusters() const noexcept
+  {
+    return m_clusters;
+  }
+
+  [[nodiscard]] const std::vector<uint32_t>& getLightIndices() const noexcept
+  {
+    return m_lightIndices;
+  }
+
+  [[nodiscard]] static constexpr uint32_t getClusterIndex(const uint32_t x, const uint32_t y, const uint32_t z)
+  {
+    return x + SizeX * (y + SizeY * z);
+  }
+
+  //! The cluster containing a world space position, the same way the shader determines it
+  [[nodiscard]] std::optional<uint32_t> findCluster(const glm::vec3& position) const;
+
+  //! The lights of the cluster containing a world space position
+  [[nodiscard]] std::vector<uint32_t> getLights(const glm::vec3& position) const;
+
+private:
+  glm::mat4 m_view{1.0f};
+  glm::mat4 m_projection{1.0f};
+  float m_nearPlane = 1.0f;
+  float m_farPlane = 2.0f;
+  std::vector<Cluster> m_clusters;
+  std::vector<uint32_t> m_lightIndices;
+  std::vector<uint32_t> m_fillCounts;
+
+  [[nodiscard]] uint32_t getSlice(float depth) const;
+  [[nodiscard]] float getSliceDepth(uint32_t slice) const;
+
+  template<typename F>
+  void forEachCluster(const glm::vec4& light, const F& f) const;
+};
+} // namespace render
@@ -0,0 +1,30 @@
+#include "occlusionquerytracker.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+
+namespace render
+{
+void OcclusionQueryTracker::reset(const size_t size)
+{
+  m_entries.clear();
+  m_entries.resize(size);
+}
+
+void OcclusionQueryTracker::invalidate(const size_t index)
+{
+  m_entries.at(index) = Entry{};
+}
+
+void OcclusionQueryTracker::setQueryIssued(const size_t index)
+{
+  auto& entry = m_entries.at(index);
+  BOOST_ASSERT(!entry.pending);
+  entry.pending = true;
+}
+
+size_t OcclusionQueryTracker::getOccludedCount() const
+{
+  return std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return entry.occluded; });
+}
+} // namespace render
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace render
+{
+//! Keeps track of asynchronous occlusion queries of a fixed set of candidates, e.g. rooms.
+//! Results are consumed with a latency of at least one frame so that the pipeline never stalls; a candidate is only
+//! considered occluded after a query has explicitly reported it as hidden, anything else counts as visible.
+class OcclusionQueryTracker final
+{
+public:
+  explicit OcclusionQueryTracker(size_t size = 0)
+      : m_entries(size)
+  {
+  }
+
+  //! Drops all states and queries
+  void reset(size_t size);
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return m_entries.size();
+  }
+
+  //! Polls all pending queries; \p tryGetResult is called with the candidate index and returns whether any sample
+  //! passed, or \c std::nullopt if the result is not yet available.
+  template<typename F>
+  void collectResults(F&& tryGetResult)
+  {
+    for(size_t i = 0; i < m_entries.size(); ++i)
+    {
+      auto& entry = m_entries[i];
+      if(!entry.pending)
+        continue;
+
+      if(const std::optional<bool> anySamplesPassed = tryGetResult(i); anySamplesPassed.has_value())
+      {
+        entry.pending = false;
+        entry.occluded = !*anySamplesPassed;
+      }
+    }
+  }
+
+  //! Forgets the state of a candidate, e.g. if it left the view or the camera is inside its bounds
+  void invalidate(size_t index);
+
+  //! A new query is only issued if the previous one has delivered its result
+  [[nodiscard]] bool needsQuery(size_t index) const
+  {
+    return !m_entries.at(index).pending;
+  }
+
+  void setQueryIssued(size_t index);
+
+  [[nodiscard]] bool isOccluded(size_t index) const
+  {
+    return m_entries.at(index).occluded;
+  }
+
+  [[nodiscard]] bool isPending(size_t index) const
+  {
+    return m_entries.at(index).pending;
+  }
+
+  [[nodiscard]] size_t getOccludedCount() const;
+
+private:
+  struct Entry
+  {
+    bool pending = false;
+    bool occluded = false;
+  };
+
+  std::vector<Entry> m_entries;
+};
+} // namespace render
@@ -3,6 +3,7 @@
 #include "engine/cameracontroller.h"
 #include "engine/world.h"
 #include "loader/file/datatypes.h"
+#include "potentiallyvisibleset.h"
 #include "scene/camera.h"
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -127,27 +128,35 @@ std::optional<PortalTracer::CullBox> PortalTracer::narrowCullBox(const PortalTra
 }
 
 bool PortalTracer::traceRoom(const loader::file::Room& room,
+                             const size_t roomIndex,
                              const PortalTracer::CullBox& roomCullBox,
                              const engine::World& world,
-                             std::vector<const loader::file::Room*>& seenRooms,
+                             const boost::dynamic_bitset<>& potentiallyVisibleRooms,
+                             boost::dynamic_bitset<>& seenRooms,
                              const bool inWater,
                              std::unordered_set<const loader::file::Portal*>& waterSurfacePortals,
                              const bool startFromWater)
 {
-  if(std::find(seenRooms.rbegin(), seenRooms.rend(), &room) != seenRooms.rend())
+  if(seenRooms.test(roomIndex))
     return false;
-  seenRooms.emplace_back(&room);
+  seenRooms.set(roomIndex);
 
   room.node->setVisible(true);
   for(const auto& portal : room.portals)
   {
+    const auto childIndex = portal.adjoining_room.get();
+    if(!potentiallyVisibleRooms.test(childIndex) || seenRooms.test(childIndex))
+      continue;
+
     if(const auto narrowedCullBox = narrowCullBox(roomCullBox, portal, world.getCameraController()))
     {
-      const auto& childRoom = world.getRooms().at(portal.adjoining_room.get());
+      const auto& childRoom = world.getRooms().at(childIndex);
       const bool waterChanged = inWater == startFromWater && childRoom.isWaterRoom() != startFromWater;
       if(traceRoom(childRoom,
+                   childIndex,
                    *narrowedCullBox,
                    world,
+                   potentiallyVisibleRooms,
                    seenRooms,
                    inWater || childRoom.isWaterRoom(),
                    waterSurfacePortals,
@@ -158,19 +167,32 @@ bool PortalTracer::traceRoom(const loader::file::Room& room,
       }
     }
   }
-  seenRooms.pop_back();
+  seenRooms.reset(roomIndex);
   return true;
 }
 
 std::unordered_set<const loader::file::Portal*> PortalTracer::trace(const loader::file::Room& startRoom,
                                                                     const engine::World& world)
 {
-  std::vector<const loader::file::Room*> seenRooms;
-  seenRooms.reserve(32);
+  const auto& rooms = world.getRooms();
+  const auto startIndex = gsl::narrow<size_t>(std::distance(rooms.data(), &startRoom));
+  Expects(startIndex < rooms.size());
+
+  // rooms outside of the start room's PVS can't be seen through any portal chain, so they don't need to be traced
+  const auto& potentiallyVisibleRooms = world.getPotentiallyVisibleSet().getVisibleRooms(startIndex);
+
+  boost::dynamic_bitset<> seenRooms(rooms.size());
   std::unordered_set<const loader::file::Portal*> waterSurfacePortals;
-  traceRoom(
-    startRoom, {-1, -1, 1, 1}, world, seenRooms, startRoom.isWaterRoom(), waterSurfacePortals, startRoom.isWaterRoom());
-  Expects(seenRooms.empty());
+  traceRoom(startRoom,
+            startIndex,
+            {-1, -1, 1, 1},
+            world,
+            potentiallyVisibleRooms,
+            seenRooms,
+            startRoom.isWaterRoom(),
+            waterSurfacePortals,
+            startRoom.isWaterRoom());
+  Expects(seenRooms.none());
   return waterSurfacePortals;
 }
 } // namespace render
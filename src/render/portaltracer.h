@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/dynamic_bitset.hpp>
 #include <glm/glm.hpp>
 #include <gsl-lite.hpp>
 #include <optional>
@@ -38,9 +39,11 @@ struct PortalTracer
                                                                const engine::World& world);
 
   static bool traceRoom(const loader::file::Room& room,
+                        size_t roomIndex,
                         const CullBox& roomCullBox,
                         const engine::World& world,
-                        std::vector<const loader::file::Room*>& seenRooms,
+                        const boost::dynamic_bitset<>& potentiallyVisibleRooms,
+                        boost::dynamic_bitset<>& seenRooms,
                         bool inWater,
                         std::unordered_set<const loader::file::Portal*>& waterSurfacePortals,
                         bool startFromWater);
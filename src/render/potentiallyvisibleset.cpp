@@ -0,0 +1,133 @@
+#include "potentiallyvisibleset.h"
+
+#include <algorithm>
+#include <boost/log/trivial.hpp>
+#include <queue>
+
+namespace render
+{
+namespace
+{
+struct PortalPlane
+{
+  glm::vec3 normal;
+  float distance;
+
+  explicit PortalPlane(const PotentiallyVisibleSet::PortalGeometry& portal)
+      : normal{glm::normalize(portal.normal)}
+      , distance{glm::dot(normal, portal.vertices[0])}
+  {
+  }
+
+  //! A view through this portal only reaches the half space opposite to its normal
+  [[nodiscard]] bool canSee(const PotentiallyVisibleSet::PortalGeometry& portal) const
+  {
+    // tolerate slight inaccuracies in the level data, this only makes the result more conservative
+    static constexpr float Eps = 1.0f;
+
+    return std::any_of(portal.vertices.begin(), portal.vertices.end(), [this](const glm::vec3& v) {
+      return glm::dot(normal, v) - distance < Eps;
+    });
+  }
+};
+
+struct ChainTracer
+{
+  const PotentiallyVisibleSet::RoomPortals& roomPortals;
+  boost::dynamic_bitset<>& visible;
+  boost::dynamic_bitset<> roomsInChain;
+  std::vector<PortalPlane> planes{};
+  size_t expansions = 0;
+
+  explicit ChainTracer(const PotentiallyVisibleSet::RoomPortals& roomPortals, boost::dynamic_bitset<>& visible)
+      : roomPortals{roomPortals}
+      , visible{visible}
+      , roomsInChain(roomPortals.size())
+  {
+  }
+
+  //! Returns false if the expansion limit was hit
+  bool trace(const size_t room)
+  {
+    roomsInChain.set(room);
+    for(const auto& portal : roomPortals[room])
+    {
+      if(roomsInChain.test(portal.adjoiningRoom))
+        continue;
+
+      if(!std::all_of(
+           planes.begin(), planes.end(), [&portal](const PortalPlane& plane) { return plane.canSee(portal); }))
+        continue;
+
+      if(++expansions > PotentiallyVisibleSet::MaxExpansionsPerRoom)
+        return false;
+
+      visible.set(portal.adjoiningRoom);
+      planes.emplace_back(portal);
+      const bool completed = trace(portal.adjoiningRoom);
+      planes.pop_back();
+      if(!completed)
+        return false;
+    }
+    roomsInChain.reset(room);
+    return true;
+  }
+};
+
+void markReachable(const PotentiallyVisibleSet::RoomPortals& roomPortals,
+                   const size_t startRoom,
+                   boost::dynamic_bitset<>& visible)
+{
+  boost::dynamic_bitset<> reached(roomPortals.size());
+  std::queue<size_t> pending;
+  pending.emplace(startRoom);
+  reached.set(startRoom);
+  while(!pending.empty())
+  {
+    const auto room = pending.front();
+    pending.pop();
+    for(const auto& portal : roomPortals[room])
+    {
+      if(reached.test(portal.adjoiningRoom))
+        continue;
+
+      reached.set(portal.adjoiningRoom);
+      pending.emplace(portal.adjoiningRoom);
+    }
+  }
+
+  visible |= reached;
+}
+} // namespace
+
+PotentiallyVisibleSet::PotentiallyVisibleSet(const RoomPortals& roomPortals)
+    : m_visibleRooms(roomPortals.size(), boost::dynamic_bitset<>(roomPortals.size()))
+{
+  for(size_t room = 0; room < roomPortals.size(); ++room)
+  {
+    auto& visible = m_visibleRooms[room];
+    visible.set(room);
+
+    ChainTracer tracer{roomPortals, visible};
+    if(!tracer.trace(room))
+    {
+      BOOST_LOG_TRIVIAL(debug) << "Too many portal chains starting at room " << room
+                               << ", falling back to portal graph reachability";
+      markReachable(roomPortals, room, visible);
+    }
+  }
+
+  // lines of sight are symmetric, so a room pair is only visible if both traces agree
+  for(size_t a = 0; a < m_visibleRooms.size(); ++a)
+  {
+    for(size_t b = a + 1; b < m_visibleRooms.size(); ++b)
+    {
+      if(m_visibleRooms[a].test(b) && m_visibleRooms[b].test(a))
+        continue;
+
+      m_visibleRooms[a].reset(b);
+      m_visibleRooms[b].reset(a);
+    }
+  }
+}
+} // namespace render
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <boost/dynamic_bitset.hpp>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace render
+{
+//! A conservative room-to-room visibility table derived from the portal graph.
+class PotentiallyVisibleSet final
+{
+public:
+  struct PortalGeometry
+  {
+    size_t adjoiningRoom = 0;
+    //! Faces into the room the portal belongs to
+    glm::vec3 normal{};
+    std::array<glm::vec3, 4> vertices{};
+  };
+
+  using RoomPortals = std::vector<std::vector<PortalGeometry>>;
+
+  //! Upper limit of portal chains evaluated per room before falling back to plain reachability
+  static constexpr size_t MaxExpansionsPerRoom = 1u << 15u;
+
+  PotentiallyVisibleSet() = default;
+
+  explicit PotentiallyVisibleSet(const RoomPortals& roomPortals);
+
+  [[nodiscard]] bool empty() const noexcept
+  {
+    return m_visibleRooms.empty();
+  }
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return m_visibleRooms.size();
+  }
+
+  [[nodiscard]] const boost::dynamic_bitset<>& getVisibleRooms(const size_t roomIndex) const
+  {
+    return m_visibleRooms.at(roomIndex);
+  }
+
+  [[nodiscard]] bool isVisible(const size_t fromRoom, const size_t toRoom) const
+  {
+    return getVisibleRooms(fromRoom).test(toRoom);
+  }
+
+private:
+  std::vector<boost::dynamic_bitset<>> m_visibleRooms{};
+};
+} // namespace render
@@ -31,9 +31,19 @@ RenderPipeline::RenderPipeline(scene::MaterialManager& materialManager, const gl
 void RenderPipeline::compositionPass(const bool water)
 {
   if(m_renderSettings.waterDenoise)
+  {
+    RENDER_GPU_ZONE(m_gpuProfiler, "portal-blur-pass");
     m_portalStage.blur.render();
-  m_ssaoStage.render(m_size / 2);
-  m_fxaaStage.render(m_size);
+  }
+  {
+    RENDER_GPU_ZONE(m_gpuProfiler, "ssao-pass");
+    m_ssaoStage.render(m_size / 2);
+  }
+  {
+    RENDER_GPU_ZONE(m_gpuProfiler, "fxaa-pass");
+    m_fxaaStage.render(m_size);
+  }
+  RENDER_GPU_ZONE(m_gpuProfiler, "postprocess-pass");
   m_compositionStage.render(water, m_renderSettings);
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "gpuprofiler.h"
 #include "rendersettings.h"
 #include "scene/blur.h"
 #include "scene/camera.h"
@@ -123,6 +124,7 @@ private:
 
   RenderSettings m_renderSettings{};
   glm::ivec2 m_size{-1};
+  GpuProfiler m_gpuProfiler{};
   PortalStage m_portalStage;
   GeometryStage m_geometryStage;
   SSAOStage m_ssaoStage;
@@ -146,6 +148,11 @@ public:
 
   void compositionPass(bool water);
 
+  [[nodiscard]] GpuProfiler& getGpuProfiler()
+  {
+    return m_gpuProfiler;
+  }
+
   void updateCamera(const gsl::not_null<std::shared_ptr<scene::Camera>>& camera);
 
   void resize(const glm::ivec2& viewport, bool force = false)
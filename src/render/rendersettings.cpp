@@ -13,6 +13,10 @@ void RenderSettings::serialize(const serialization::Serializer<engine::EngineCon
       S_NVD("filmGrain", filmGrain, true),
       S_NVD("fullscreen", fullscreen, false),
       S_NVD("bilinearFiltering", bilinearFiltering, false),
-      S_NVD("waterDenoise", waterDenoise, true));
+      S_NVD("waterDenoise", waterDenoise, true),
+      S_NVD("occlusionCulling", occlusionCulling, true),
+      S_NVD("clusteredLighting", clusteredLighting, true),
+      S_NVD("uncappedFrameRate", uncappedFrameRate, false),
+      S_NVD("vsync", vsync, false));
 }
 } // namespace render
@@ -18,6 +18,12 @@ struct RenderSettings
   bool fullscreen = false;
   bool bilinearFiltering = false;
   bool waterDenoise = true;
+  bool occlusionCulling = true;
+  bool clusteredLighting = true;
+  //! Renders as fast as possible, or at the display rate with vsync, and interpolates between the simulation steps;
+  //! otherwise exactly one frame is rendered per simulation step
+  bool uncappedFrameRate = false;
+  bool vsync = false;
 
   void serialize(const serialization::Serializer<engine::EngineConfig>& ser);
 };
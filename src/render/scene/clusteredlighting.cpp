@@ -0,0 +1,26 @@
+#include "clusteredlighting.h"
+
+#include "camera.h"
+
+namespace render::scene
+{
+void ClusteredLighting::update(const Camera& camera)
+{
+  m_grid.build(camera.getViewMatrix(),
+               camera.getProjectionMatrix(),
+               camera.getNearPlane(),
+               camera.getFarPlane(),
+               m_lightSpheres);
+
+  // empty buffers can't be bound, and the shader never reads these placeholders as no cluster references them
+  if(m_lights.empty())
+    m_lights.emplace_back();
+  m_indices.assign(m_grid.getLightIndices().begin(), m_grid.getLightIndices().end());
+  if(m_indices.empty())
+    m_indices.emplace_back(0);
+
+  m_lightsBuffer.setData(m_lights, gl::api::BufferUsageARB::StreamDraw);
+  m_clustersBuffer.setData(m_grid.getClusters(), gl::api::BufferUsageARB::StreamDraw);
+  m_indicesBuffer.setData(m_indices, gl::api::BufferUsageARB::StreamDraw);
+}
+} // namespace render::scene
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "engine/lighting.h"
+#include "render/lightclustergrid.h"
+
+#include <gl/buffer.h>
+#include <vector>
+
+namespace render::scene
+{
+class Camera;
+
+//! Clustered forward lighting: a single buffer with all lights that may affect the visible scene, and a grid over the
+//! view frustum referencing the lights affecting each cluster
+class ClusteredLighting final
+{
+public:
+  [[nodiscard]] bool isEnabled() const noexcept
+  {
+    return m_enabled;
+  }
+
+  void setEnabled(bool enabled) noexcept
+  {
+    m_enabled = enabled;
+  }
+
+  void clear()
+  {
+    m_lightSpheres.clear();
+    m_lights.clear();
+  }
+
+  //! \p radius is the distance beyond which the light's contribution is negligible
+  void addLight(const engine::Lighting::Light& light, const float radius)
+  {
+    m_lightSpheres.emplace_back(glm::vec3{light.position}, radius);
+    m_lights.emplace_back(light);
+  }
+
+  //! Assigns the added lights to the clusters of the camera's view and uploads the buffers
+  void update(const Camera& camera);
+
+  [[nodiscard]] const gl::ShaderStorageBuffer<engine::Lighting::Light>& getLightsBuffer() const
+  {
+    return m_lightsBuffer;
+  }
+
+  [[nodiscard]] const gl::ShaderStorageBuffer<LightClusterGrid::Cluster>& getClustersBuffer() const
+  {
+    return m_clustersBuffer;
+  }
+
+  [[nodiscard]] const gl::ShaderStorageBuffer<uint32_t>& getIndicesBuffer() const
+  {
+    return m_indicesBuffer;
+  }
+
+private:
+  bool m_enabled = true;
+  LightClusterGrid m_grid;
+  std::vector<glm::vec4> m_lightSpheres;
+  std::vector<engine::Lighting::Light> m_lights;
+  std::vector<uint32_t> m_indices;
+  gl::ShaderStorageBuffer<engine::Lighting::Light> m_lightsBuffer{"clustered-lights"};
+  gl::ShaderStorageBuffer<LightClusterGrid::Cluster> m_clustersBuffer{"light-clusters"};
+  gl::ShaderStorageBuffer<uint32_t> m_indicesBuffer{"light-cluster-indices"};
+};
+} // namespace render::scene
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <glm/glm.hpp>
+#include <limits>
+#include <vector>
+
+namespace render::scene
+{
+//! An axis-aligned rectangle of pixels; @a max is exclusive
+struct PixelRect
+{
+  glm::ivec2 min{0};
+  glm::ivec2 max{0};
+
+  [[nodiscard]] bool isEmpty() const noexcept
+  {
+    return max.x <= min.x || max.y <= min.y;
+  }
+
+  [[nodiscard]] size_t getArea() const noexcept
+  {
+    return isEmpty() ? 0 : static_cast<size_t>(max.x - min.x) * static_cast<size_t>(max.y - min.y);
+  }
+
+  [[nodiscard]] bool intersects(const PixelRect& rhs) const noexcept
+  {
+    return min.x < rhs.max.x && rhs.min.x < max.x && min.y < rhs.max.y && rhs.min.y < max.y;
+  }
+
+  [[nodiscard]] PixelRect united(const PixelRect& rhs) const noexcept
+  {
+    return PixelRect{glm::min(min, rhs.min), glm::max(max, rhs.max)};
+  }
+};
+
+//! Collects the changed parts of an image as disjoint rectangles, so that only those need to be uploaded or cleared.
+//! Overlapping rectangles are merged; once there are more than MaxRects, the two rectangles whose union covers the
+//! least additional area are merged, which keeps distant regions separate.
+class DirtyRegions final
+{
+public:
+  static constexpr size_t MaxRects = 16;
+
+  explicit DirtyRegions(const glm::ivec2& bounds = glm::ivec2{0})
+      : m_bounds{bounds}
+  {
+  }
+
+  //! Clips @a rect to the bounds and adds it
+  void add(PixelRect rect)
+  {
+    rect.min = glm::clamp(rect.min, glm::ivec2{0}, m_bounds);
+    rect.max = glm::clamp(rect.max, glm::ivec2{0}, m_bounds);
+    if(rect.isEmpty())
+      return;
+
+    // the union may overlap rectangles which the original one didn't, so restart after each merge
+    for(auto it = m_rects.begin(); it != m_rects.end();)
+    {
+      if(!it->intersects(rect))
+      {
+        ++it;
+        continue;
+      }
+
+      rect = rect.united(*it);
+      m_rects.erase(it);
+      it = m_rects.begin();
+    }
+
+    m_rects.emplace_back(rect);
+    if(m_rects.size() > MaxRects)
+      mergeCheapestPair();
+  }
+
+  //! Marks the whole area within the bounds
+  void addAll()
+  {
+    m_rects.clear();
+    add(PixelRect{glm::ivec2{0}, m_bounds});
+  }
+
+  void reset(const glm::ivec2& bounds)
+  {
+    m_bounds = bounds;
+    m_rects.clear();
+  }
+
+  void clear()
+  {
+    m_rects.clear();
+  }
+
+  [[nodiscard]] bool empty() const noexcept
+  {
+    return m_rects.empty();
+  }
+
+  [[nodiscard]] const std::vector<PixelRect>& getRects() const noexcept
+  {
+    return m_rects;
+  }
+
+private:
+  glm::ivec2 m_bounds;
+  std::vector<PixelRect> m_rects{};
+
+  void mergeCheapestPair()
+  {
+    BOOST_ASSERT(m_rects.size() >= 2);
+
+    size_t bestA = 0;
+    size_t bestB = 1;
+    auto bestCost = std::numeric_limits<size_t>::max();
+    for(size_t a = 0; a < m_rects.size(); ++a)
+    {
+      for(size_t b = a + 1; b < m_rects.size(); ++b)
+      {
+        // the rectangles are disjoint, so the union is never smaller than both of them
+        const auto cost = m_rects[a].united(m_rects[b]).getArea() - m_rects[a].getArea() - m_rects[b].getArea();
+        if(cost < bestCost)
+        {
+          bestCost = cost;
+          bestA = a;
+          bestB = b;
+        }
+      }
+    }
+
+    const auto merged = m_rects[bestA].united(m_rects[bestB]);
+    m_rects.erase(m_rects.begin() + bestB);
+    m_rects.erase(m_rects.begin() + bestA);
+    add(merged);
+  }
+};
+} // namespace render::scene
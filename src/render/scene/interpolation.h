@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace render::scene
+{
+//! Interpolates between two rigid transforms, i.e. transforms without scaling or shearing.
+//!
+//! The translation is interpolated linearly, and the rotation spherically, so that the result is a rigid transform,
+//! too. @a bias is clamped to [0, 1].
+[[nodiscard]] inline glm::mat4 interpolateTransform(const glm::mat4& a, const glm::mat4& b, const float bias)
+{
+  if(bias <= 0)
+    return a;
+  if(bias >= 1)
+    return b;
+
+  auto result = glm::mat4_cast(glm::slerp(glm::quat_cast(glm::mat3{a}), glm::quat_cast(glm::mat3{b}), bias));
+  result[3] = glm::vec4{glm::mix(glm::vec3{a[3]}, glm::vec3{b[3]}, bias), 1.0f};
+  return result;
+}
+} // namespace render::scene
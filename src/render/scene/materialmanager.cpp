@@ -1,5 +1,6 @@
 #include "materialmanager.h"
 
+#include "clusteredlighting.h"
 #include "csm.h"
 #include "node.h"
 #include "renderer.h"
@@ -19,10 +20,30 @@ const std::shared_ptr<Material>& MaterialManager::getSprite()
 
   m_sprite->getUniformBlock("Transform")->bindTransformBuffer();
   m_sprite->getUniformBlock("Camera")->bindCameraBuffer(m_renderer->getCamera());
+  bindClusteredLighting(*m_sprite);
 
   return m_sprite;
 }
 
+const std::shared_ptr<Material>& MaterialManager::getParticle()
+{
+  Expects(m_geometryTextures != nullptr);
+  if(m_particle != nullptr)
+    return m_particle;
+
+  m_particle = std::make_shared<Material>(m_shaderManager->getParticle());
+  m_particle->getRenderState().setCullFace(false);
+
+  m_particle->getUniform("u_diffuseTextures")->set(m_geometryTextures);
+  m_particle->getUniformBlock("Camera")->bindCameraBuffer(m_renderer->getCamera());
+  m_particle->getUniformBlock("CSM")->bind(
+    [this](const Node& node, gl::UniformBlock& ub) { ub.bind(m_csm->getBuffer(node.getModelMatrix())); });
+  m_particle->getUniform("u_csmVsm[0]")->set(m_csm->getTextures());
+  bindClusteredLighting(*m_particle);
+
+  return m_particle;
+}
+
 const std::shared_ptr<Material>& MaterialManager::getCSMDepthOnly(bool skeletal)
 {
   if(const auto& tmp = m_csmDepthOnly[skeletal])
@@ -73,6 +94,7 @@ std::shared_ptr<Material> MaterialManager::getGeometry(bool water, bool skeletal
     [this](const Node& node, gl::UniformBlock& ub) { ub.bind(m_csm->getBuffer(node.getModelMatrix())); });
 
   m->getUniform("u_csmVsm[0]")->set(m_csm->getTextures());
+  bindClusteredLighting(*m);
 
   if(water)
   {
@@ -103,6 +125,22 @@ const std::shared_ptr<Material>& MaterialManager::getPortal()
   return m_portal;
 }
 
+const std::shared_ptr<Material>& MaterialManager::getOcclusionQuery()
+{
+  if(m_occlusionQuery != nullptr)
+    return m_occlusionQuery;
+
+  m_occlusionQuery = std::make_shared<Material>(m_shaderManager->getOcclusionQuery());
+  // the camera may be inside the box, so back faces must be tested, too
+  m_occlusionQuery->getRenderState().setCullFace(false);
+  m_occlusionQuery->getRenderState().setDepthTest(true);
+  m_occlusionQuery->getRenderState().setDepthWrite(false);
+
+  m_occlusionQuery->getUniformBlock("Camera")->bindCameraBuffer(m_renderer->getCamera());
+
+  return m_occlusionQuery;
+}
+
 const std::shared_ptr<Material>& MaterialManager::getLightning()
 {
   if(m_lightning != nullptr)
@@ -117,13 +155,30 @@ const std::shared_ptr<Material>& MaterialManager::getLightning()
 
 MaterialManager::MaterialManager(gsl::not_null<std::shared_ptr<ShaderManager>> shaderManager,
                                  gsl::not_null<std::shared_ptr<CSM>> csm,
-                                 gsl::not_null<std::shared_ptr<Renderer>> renderer)
+                                 gsl::not_null<std::shared_ptr<Renderer>> renderer,
+                                 gsl::not_null<std::shared_ptr<ClusteredLighting>> clusteredLighting)
     : m_shaderManager{std::move(shaderManager)}
     , m_csm{std::move(csm)}
     , m_renderer{std::move(renderer)}
+    , m_clusteredLighting{std::move(clusteredLighting)}
 {
 }
 
+void MaterialManager::bindClusteredLighting(Material& material)
+{
+  material.getUniform("u_clusteredLighting")
+    ->bind([clusteredLighting = m_clusteredLighting](const Node&, gl::Uniform& uniform) {
+      uniform.set(clusteredLighting->isEnabled() ? 1 : 0);
+    });
+  // nodes affected by positional lights override this
+  material.getUniform("u_dynamicLighting")->set(0);
+
+  const auto clusteredLighting = m_clusteredLighting.get().get();
+  material.getBuffer("b_clusteredLights")->bind(clusteredLighting, &ClusteredLighting::getLightsBuffer);
+  material.getBuffer("b_lightClusters")->bind(clusteredLighting, &ClusteredLighting::getClustersBuffer);
+  material.getBuffer("b_lightClusterIndices")->bind(clusteredLighting, &ClusteredLighting::getIndicesBuffer);
+}
+
 std::shared_ptr<Material> MaterialManager::getComposition(bool water, bool lensDistortion, bool dof, bool filmGrain)
 {
   if(auto tmp = m_composition[water][lensDistortion][dof][filmGrain])
@@ -196,6 +251,8 @@ void MaterialManager::setGeometryTextures(std::shared_ptr<gl::Texture2DArray<gl:
       for(const auto& c : b)
         if(c != nullptr)
           c->getUniform("u_diffuseTextures")->set(m_geometryTextures);
+  if(m_particle != nullptr)
+    m_particle->getUniform("u_diffuseTextures")->set(m_geometryTextures);
   if(m_screenSpriteTextured != nullptr)
     m_screenSpriteTextured->getUniform("u_input")->set(m_geometryTextures);
 }
@@ -8,6 +8,7 @@ namespace render::scene
 {
 class CSM;
 class Camera;
+class ClusteredLighting;
 class Material;
 class Renderer;
 class ShaderManager;
@@ -17,7 +18,8 @@ class MaterialManager final
 public:
   explicit MaterialManager(gsl::not_null<std::shared_ptr<ShaderManager>> shaderManager,
                            gsl::not_null<std::shared_ptr<CSM>> csm,
-                           gsl::not_null<std::shared_ptr<Renderer>> renderer);
+                           gsl::not_null<std::shared_ptr<Renderer>> renderer,
+                           gsl::not_null<std::shared_ptr<ClusteredLighting>> clusteredLighting);
 
   [[nodiscard]] const auto& getShaderManager() const
   {
@@ -26,6 +28,8 @@ public:
 
   [[nodiscard]] const std::shared_ptr<Material>& getSprite();
 
+  [[nodiscard]] const std::shared_ptr<Material>& getParticle();
+
   [[nodiscard]] const std::shared_ptr<Material>& getCSMDepthOnly(bool skeletal);
   [[nodiscard]] const std::shared_ptr<Material>& getDepthOnly(bool skeletal);
 
@@ -33,6 +37,8 @@ public:
 
   [[nodiscard]] const std::shared_ptr<Material>& getPortal();
 
+  [[nodiscard]] const std::shared_ptr<Material>& getOcclusionQuery();
+
   [[nodiscard]] const std::shared_ptr<Material>& getLightning();
 
   [[nodiscard]] std::shared_ptr<Material> getComposition(bool water, bool lensDistortion, bool dof, bool filmGrain);
@@ -47,13 +53,17 @@ public:
   void setBilinearFiltering(bool enabled);
 
 private:
+  void bindClusteredLighting(Material& material);
+
   const gsl::not_null<std::shared_ptr<ShaderManager>> m_shaderManager;
 
   std::shared_ptr<Material> m_sprite{nullptr};
+  std::shared_ptr<Material> m_particle{nullptr};
   std::array<std::shared_ptr<Material>, 2> m_csmDepthOnly{};
   std::array<std::shared_ptr<Material>, 2> m_depthOnly{};
   std::array<std::array<std::array<std::shared_ptr<Material>, 2>, 2>, 2> m_geometry{};
   std::shared_ptr<Material> m_portal{nullptr};
+  std::shared_ptr<Material> m_occlusionQuery{nullptr};
   std::shared_ptr<Material> m_lightning{nullptr};
   std::array<std::array<std::array<std::array<std::shared_ptr<Material>, 2>, 2>, 2>, 2> m_composition{};
   std::shared_ptr<Material> m_crt{nullptr};
@@ -62,6 +72,7 @@ private:
 
   const gsl::not_null<std::shared_ptr<CSM>> m_csm;
   const gsl::not_null<std::shared_ptr<Renderer>> m_renderer;
+  const gsl::not_null<std::shared_ptr<ClusteredLighting>> m_clusteredLighting;
   std::shared_ptr<gl::Texture2DArray<gl::SRGBA8>> m_geometryTextures;
 };
 } // namespace render::scene
@@ -38,6 +38,44 @@ gsl::not_null<std::shared_ptr<Mesh>>
     std::make_shared<gl::VertexArray<uint16_t, Vertex>>(indexBuffer, vertexBuffer, std::vector{&program}));
 }
 
+gsl::not_null<std::shared_ptr<Mesh>>
+  createBoxMesh(const glm::vec3& min, const glm::vec3& max, const gl::Program& program)
+{
+  struct Vertex
+  {
+    glm::vec3 pos;
+  };
+
+  std::array<Vertex, 8> vertices{};
+  for(size_t i = 0; i < vertices.size(); ++i)
+  {
+    vertices[i].pos
+      = glm::vec3{(i & 1u) != 0 ? max.x : min.x, (i & 2u) != 0 ? max.y : min.y, (i & 4u) != 0 ? max.z : min.z};
+  }
+
+  static const gl::VertexFormat<Vertex> format{{VERTEX_ATTRIBUTE_POSITION_NAME, &Vertex::pos}};
+
+  auto vertexBuffer = std::make_shared<gl::VertexBuffer<Vertex>>(format);
+  vertexBuffer->setData(&vertices[0], 8, gl::api::BufferUsageARB::StaticDraw);
+
+  // clang-format off
+  static const std::array<uint16_t, 36> indices{
+    0, 2, 6, 0, 6, 4, // -x
+    1, 5, 7, 1, 7, 3, // +x
+    0, 4, 5, 0, 5, 1, // -y
+    2, 3, 7, 2, 7, 6, // +y
+    0, 1, 3, 0, 3, 2, // -z
+    4, 6, 7, 4, 7, 5, // +z
+  };
+  // clang-format on
+
+  auto indexBuffer = std::make_shared<gl::ElementArrayBuffer<uint16_t>>();
+  indexBuffer->setData(&indices[0], 36, gl::api::BufferUsageARB::StaticDraw);
+
+  return std::make_shared<MeshImpl<uint16_t, Vertex>>(
+    std::make_shared<gl::VertexArray<uint16_t, Vertex>>(indexBuffer, vertexBuffer, std::vector{&program}));
+}
+
 Mesh::~Mesh() = default;
 
 bool Mesh::render(RenderContext& context)
@@ -54,7 +92,15 @@ bool Mesh::render(RenderContext& context)
 
   material->bind(*context.getCurrentNode());
 
-  drawIndexBuffer(m_primitiveType);
+  if(m_instanceCount.has_value())
+  {
+    if(*m_instanceCount > 0)
+      drawIndexBufferInstanced(m_primitiveType, *m_instanceCount);
+  }
+  else
+  {
+    drawIndexBuffer(m_primitiveType);
+  }
 
   context.popState();
   context.popState();
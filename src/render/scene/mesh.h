@@ -5,6 +5,7 @@
 
 #include <gl/api/gl.hpp>
 #include <gl/soglb_fwd.h>
+#include <optional>
 
 namespace render::scene
 {
@@ -37,11 +38,21 @@ public:
 
   bool render(RenderContext& context) final;
 
+  //! Draws the mesh multiple times in a single call; shaders distinguish the instances by gl_InstanceID
+  void setInstanceCount(const gl::api::core::SizeType instanceCount)
+  {
+    Expects(instanceCount >= 0);
+    m_instanceCount = instanceCount;
+  }
+
 private:
   MultiPassMaterial m_material{};
   const gl::api::PrimitiveType m_primitiveType{};
+  std::optional<gl::api::core::SizeType> m_instanceCount{};
 
   virtual void drawIndexBuffer(gl::api::PrimitiveType primitiveType) = 0;
+  virtual void drawIndexBufferInstanced(gl::api::PrimitiveType primitiveType, gl::api::core::SizeType instanceCount)
+    = 0;
 };
 
 template<typename IndexT, typename... VertexTs>
@@ -74,8 +85,18 @@ private:
   {
     m_vao->drawIndexBuffer(primitiveType);
   }
+
+  void drawIndexBufferInstanced(gl::api::PrimitiveType primitiveType,
+                                gl::api::core::SizeType instanceCount) override
+  {
+    m_vao->drawIndexBufferInstanced(primitiveType, instanceCount);
+  }
 };
 
 extern gsl::not_null<std::shared_ptr<Mesh>>
   createQuadFullscreen(float width, float height, const gl::Program& program, bool invertY = false);
+
+//! Creates an axis-aligned box with untransformed positions only, e.g. as a proxy for occlusion queries
+extern gsl::not_null<std::shared_ptr<Mesh>>
+  createBoxMesh(const glm::vec3& min, const glm::vec3& max, const gl::Program& program);
 } // namespace render::scene
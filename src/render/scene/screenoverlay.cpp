@@ -7,6 +7,8 @@
 #include "shadermanager.h"
 #include "uniformparameter.h"
 
+#include <algorithm>
+#include <gl/font.h>
 #include <gl/image.h>
 #include <gl/texture2d.h>
 
@@ -24,13 +26,69 @@ bool ScreenOverlay::render(RenderContext& context)
   if(context.getRenderMode() != RenderMode::Full)
     return false;
 
+  if(!m_dirty.empty())
+  {
+    // the regions are uploaded directly from the image, which is the source's row length
+    GL_ASSERT(gl::api::pixelStore(gl::api::PixelStoreParameter::UnpackRowLength, m_image->getSize().x));
+    for(const auto& rect : m_dirty.getRects())
+    {
+      const auto size = rect.max - rect.min;
+      GL_ASSERT(gl::api::textureSubImage2D(m_texture->getHandle(),
+                                           0,
+                                           rect.min.x,
+                                           rect.min.y,
+                                           size.x,
+                                           size.y,
+                                           gl::SRGBA8::PixelFormat,
+                                           gl::SRGBA8::PixelType,
+                                           &m_image->at(rect.min)));
+    }
+    GL_ASSERT(gl::api::pixelStore(gl::api::PixelStoreParameter::UnpackRowLength, 0));
+    m_dirty.clear();
+  }
+
+  // nothing to blend over the scene if everything was cleared
+  if(m_drawn.empty())
+    return false;
+
   context.pushState(getRenderState());
-  m_texture->assign(m_image->getRawData());
   m_mesh->render(context);
   context.popState();
   return true;
 }
 
+void ScreenOverlay::clear()
+{
+  for(const auto& rect : m_drawn.getRects())
+  {
+    for(int y = rect.min.y; y < rect.max.y; ++y)
+    {
+      std::fill_n(&m_image->at({rect.min.x, y}), rect.max.x - rect.min.x, gl::SRGBA8{0, 0, 0, 0});
+    }
+    m_dirty.add(rect);
+  }
+  m_drawn.clear();
+}
+
+void ScreenOverlay::markDirty(const PixelRect& rect)
+{
+  m_dirty.add(rect);
+  m_drawn.add(rect);
+}
+
+void ScreenOverlay::markAllDirty()
+{
+  m_dirty.addAll();
+  m_drawn.addAll();
+}
+
+void ScreenOverlay::drawText(
+  gl::Font& font, const std::string& text, const glm::ivec2& xy, const gl::SRGBA8& color, const int size)
+{
+  const auto [min, max] = font.drawText(*m_image, text.c_str(), xy, color, size);
+  markDirty(PixelRect{min, max});
+}
+
 void ScreenOverlay::init(ShaderManager& shaderManager, const glm::ivec2& viewport)
 {
   *m_image = gl::Image<gl::SRGBA8>(viewport);
@@ -48,6 +106,9 @@ void ScreenOverlay::init(ShaderManager& shaderManager, const glm::ivec2& viewpor
     .set(gl::api::TextureParameterName::TextureWrapS, gl::api::TextureWrapMode::ClampToEdge)
     .set(gl::api::TextureParameterName::TextureWrapT, gl::api::TextureWrapMode::ClampToEdge);
 
+  m_dirty.reset(viewport);
+  m_drawn.reset(viewport);
+
   m_mesh = createQuadFullscreen(
     gsl::narrow<float>(viewport.x), gsl::narrow<float>(viewport.y), screenOverlayProgram->getHandle());
   m_mesh->getMaterial().set(RenderMode::Full, std::make_shared<Material>(screenOverlayProgram));
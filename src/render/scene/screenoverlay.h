@@ -1,17 +1,22 @@
 #pragma once
 
+#include "dirtyregions.h"
 #include "renderable.h"
 
 #include <gl/image.h>
 #include <gl/pixel.h>
 #include <gl/soglb_fwd.h>
 #include <memory>
+#include <string>
 
 namespace render::scene
 {
 class Mesh;
 class ShaderManager;
 
+//! A full screen image for text and splash screens. Only the regions which were drawn to since the last upload are
+//! uploaded, and clearing only touches the regions which were drawn to since the last clear; writers to the image
+//! must report what they changed with markDirty().
 class ScreenOverlay : public Renderable
 {
 public:
@@ -28,6 +33,17 @@ public:
 
   bool render(RenderContext& context) override;
 
+  //! Clears everything drawn since the last call
+  void clear();
+
+  //! Marks the region of the image which changed
+  void markDirty(const PixelRect& rect);
+
+  //! Marks the whole image as changed
+  void markAllDirty();
+
+  void drawText(gl::Font& font, const std::string& text, const glm::ivec2& xy, const gl::SRGBA8& color, int size);
+
   [[nodiscard]] const auto& getImage() const
   {
     return m_image;
@@ -42,5 +58,9 @@ private:
   const gsl::not_null<std::shared_ptr<gl::Image<gl::SRGBA8>>> m_image{std::make_shared<gl::Image<gl::SRGBA8>>()};
   std::shared_ptr<gl::Texture2D<gl::SRGBA8>> m_texture;
   std::shared_ptr<Mesh> m_mesh{nullptr};
+  //! The regions which need to be uploaded
+  DirtyRegions m_dirty;
+  //! The regions which need to be cleared
+  DirtyRegions m_drawn;
 };
 } // namespace render::scene
@@ -33,6 +33,11 @@ public:
     return get("flat.vert", "flat.frag", {"INVERT_Y"});
   }
 
+  auto getYuv()
+  {
+    return get("flat.vert", "yuv.frag", {"INVERT_Y"});
+  }
+
   auto getGeometry(bool water, bool skeletal, bool roomShadowing)
   {
     std::vector<std::string> defines;
@@ -66,6 +71,16 @@ public:
     return get("portal.vert", "portal.frag");
   }
 
+  auto getOcclusionQuery()
+  {
+    return get("occlusion_query.vert", "empty.frag");
+  }
+
+  auto getParticle()
+  {
+    return get("particle.vert", "geometry.frag", {"ROOM_SHADOWING"});
+  }
+
   auto getFXAA()
   {
     return get("flat.vert", "fxaa.frag");
@@ -6,6 +6,7 @@
 #include "names.h"
 #include "node.h"
 #include "scene.h"
+#include "vertexpacking.h"
 
 #include <gl/vertexarray.h>
 #include <gl/vertexbuffer.h>
@@ -28,8 +29,8 @@ gsl::not_null<std::shared_ptr<Mesh>> createSpriteMesh(const float x0,
     glm::vec3 pos;
     glm::vec2 uv;
     int textureIdx;
-    glm::vec4 color{1.0f};
-    glm::vec3 normal{0, 0, 1};
+    glm::u8vec4 color{packVertexColor(glm::vec4{1.0f})};
+    gl::Int2101010Rev normal{packVertexNormal(glm::vec3{0, 0, 1})};
   };
 
   const std::array<SpriteVertex, 4> vertices{SpriteVertex{{x0, y0, 0}, {t0.x, t0.y}, textureIdx},
@@ -40,8 +41,8 @@ gsl::not_null<std::shared_ptr<Mesh>> createSpriteMesh(const float x0,
   gl::VertexFormat<SpriteVertex> format{{VERTEX_ATTRIBUTE_POSITION_NAME, &SpriteVertex::pos},
                                         {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, &SpriteVertex::uv},
                                         {VERTEX_ATTRIBUTE_TEXINDEX_NAME, &SpriteVertex::textureIdx},
-                                        {VERTEX_ATTRIBUTE_COLOR_NAME, &SpriteVertex::color},
-                                        {VERTEX_ATTRIBUTE_NORMAL_NAME, &SpriteVertex::normal}};
+                                        {VERTEX_ATTRIBUTE_COLOR_NAME, gl::VertexAttribute{&SpriteVertex::color, true}},
+                                        {VERTEX_ATTRIBUTE_NORMAL_NAME, gl::VertexAttribute{&SpriteVertex::normal, true}}};
   auto vb = std::make_shared<gl::VertexBuffer<SpriteVertex>>(format);
   vb->setData(&vertices[0], 4, gl::api::BufferUsageARB::StaticDraw);
 
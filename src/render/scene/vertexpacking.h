@@ -0,0 +1,68 @@
+#pragma once
+
+#include <gl/typetraits.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <gsl-lite.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace render::scene
+{
+// vertex colors are in range [0, 2] because of overbright shading, so they are stored with an 8 bit fixed point
+// representation where 127 means 1.0; keep in sync with VERTEX_COLOR_SCALE in vtx_input.glsl
+constexpr float VertexColorScale = 127.0f;
+
+[[nodiscard]] inline glm::u8vec4 packVertexColor(const glm::vec4& color)
+{
+  return glm::u8vec4{glm::round(glm::clamp(color, glm::vec4{0.0f}, glm::vec4{glm::vec3{255.0f / VertexColorScale}, 1.0f})
+                                * glm::vec4{glm::vec3{VertexColorScale}, 255.0f})};
+}
+
+[[nodiscard]] inline glm::vec4 unpackVertexColor(const glm::u8vec4& color)
+{
+  return glm::vec4{color} / glm::vec4{glm::vec3{VertexColorScale}, 255.0f};
+}
+
+[[nodiscard]] inline gl::Int2101010Rev packVertexNormal(const glm::vec3& normal)
+{
+  return gl::Int2101010Rev{glm::packSnorm3x10_1x2(glm::vec4{normal, 0.0f})};
+}
+
+[[nodiscard]] inline glm::vec3 unpackVertexNormal(const gl::Int2101010Rev& normal)
+{
+  return glm::vec3{glm::unpackSnorm3x10_1x2(normal.value)};
+}
+
+[[nodiscard]] inline glm::u16vec2 packVertexUV(const glm::vec2& uv)
+{
+  return glm::u16vec2{glm::round(glm::clamp(uv, glm::vec2{0.0f}, glm::vec2{1.0f}) * 65535.0f)};
+}
+
+[[nodiscard]] inline glm::vec2 unpackVertexUV(const glm::u16vec2& uv)
+{
+  return glm::vec2{uv} / 65535.0f;
+}
+//! Appends vertices to a buffer, re-using the index of a bitwise identical vertex if it has been added before
+template<typename VertexT, typename IndexT, typename HashT>
+class VertexWelder final
+{
+public:
+  explicit VertexWelder(std::vector<VertexT>& vertices)
+      : m_vertices{vertices}
+  {
+  }
+
+  [[nodiscard]] IndexT add(const VertexT& vertex)
+  {
+    const auto [it, inserted] = m_indices.emplace(vertex, gsl::narrow<IndexT>(m_vertices.size()));
+    if(inserted)
+      m_vertices.emplace_back(vertex);
+    return it->second;
+  }
+
+private:
+  std::vector<VertexT>& m_vertices;
+  std::unordered_map<VertexT, IndexT, HashT> m_indices{};
+};
+} // namespace render::scene
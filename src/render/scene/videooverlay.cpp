@@ -0,0 +1,121 @@
+#include "videooverlay.h"
+
+#include "material.h"
+#include "mesh.h"
+#include "rendercontext.h"
+#include "shadermanager.h"
+#include "uniformparameter.h"
+
+#include <algorithm>
+#include <gl/texture2d.h>
+
+namespace render::scene
+{
+VideoOverlay::VideoOverlay(ShaderManager& shaderManager, const glm::ivec2& viewport)
+    : m_viewport{viewport}
+{
+  const auto program = shaderManager.getYuv();
+
+  m_mesh = createQuadFullscreen(
+    gsl::narrow<float>(viewport.x), gsl::narrow<float>(viewport.y), program->getHandle());
+  m_mesh->getMaterial().set(RenderMode::Full, std::make_shared<Material>(program));
+
+  m_mesh->getRenderState().setCullFace(false);
+  m_mesh->getRenderState().setDepthWrite(false);
+  m_mesh->getRenderState().setDepthTest(false);
+  m_mesh->getRenderState().setBlend(false);
+}
+
+VideoOverlay::~VideoOverlay() = default;
+
+void VideoOverlay::setViewport(const glm::ivec2& viewport)
+{
+  m_viewport = viewport;
+  updateScale();
+}
+
+void VideoOverlay::resize(const glm::ivec2& size)
+{
+  m_size = size;
+  m_layout = getYuv420Layout(size);
+
+  const auto material = m_mesh->getMaterial().get(RenderMode::Full);
+  static constexpr std::array<const char*, 3> Names{"u_y", "u_u", "u_v"};
+  for(size_t i = 0; i < m_planes.size(); ++i)
+  {
+    m_planes[i]
+      = std::make_shared<gl::Texture2D<gl::ScalarByte>>(m_layout.planes[i].size, std::string{"video-"} + Names[i]);
+    m_planes[i]
+      ->set(gl::api::TextureMinFilter::Linear)
+      .set(gl::api::TextureMagFilter::Linear)
+      .set(gl::api::TextureParameterName::TextureWrapS, gl::api::TextureWrapMode::ClampToEdge)
+      .set(gl::api::TextureParameterName::TextureWrapT, gl::api::TextureWrapMode::ClampToEdge);
+    material->getUniform(Names[i])->set(m_planes[i]);
+  }
+
+  updateScale();
+}
+
+void VideoOverlay::updateScale()
+{
+  if(m_size.x == 0 || m_size.y == 0 || m_viewport.x == 0 || m_viewport.y == 0)
+    return;
+
+  const glm::vec2 size{m_size};
+  const glm::vec2 viewport{m_viewport};
+  const auto scale = std::min(viewport.x / size.x, viewport.y / size.y);
+  m_mesh->getMaterial().get(RenderMode::Full)->getUniform("u_scale")->set(size * scale / viewport);
+}
+
+void VideoOverlay::upload(const glm::ivec2& size,
+                          const std::array<const uint8_t*, 3>& planes,
+                          const std::array<int, 3>& strides)
+{
+  Expects(size.x > 0 && size.y > 0);
+  if(size != m_size)
+    resize(size);
+
+  // re-specifying the storage orphans the previous frame's data, so mapping never waits for its upload to finish
+  const auto handle = m_pixelBuffer.getHandle();
+  GL_ASSERT(gl::api::namedBufferData(handle, m_layout.size, nullptr, gl::api::BufferUsageARB::StreamDraw));
+  auto data = static_cast<uint8_t*>(GL_ASSERT_FN(gl::api::mapNamedBufferRange(
+    handle,
+    0,
+    m_layout.size,
+    gl::api::MapBufferAccessMask::MapWriteBit | gl::api::MapBufferAccessMask::MapInvalidateBufferBit)));
+  Expects(data != nullptr);
+  packYuvPlanes(m_layout, planes, strides, data);
+  GL_ASSERT(gl::api::unmapNamedBuffer(handle));
+
+  // with a bound unpack buffer, the data pointers are offsets into it; the planes' rows are tightly packed
+  m_pixelBuffer.bind();
+  GL_ASSERT(gl::api::pixelStore(gl::api::PixelStoreParameter::UnpackAlignment, 1));
+  for(size_t i = 0; i < m_planes.size(); ++i)
+  {
+    const auto& plane = m_layout.planes[i];
+    GL_ASSERT(gl::api::textureSubImage2D(
+      m_planes[i]->getHandle(),
+      0,
+      0,
+      0,
+      plane.size.x,
+      plane.size.y,
+      gl::ScalarByte::PixelFormat,
+      gl::ScalarByte::PixelType,
+      reinterpret_cast<const void*>(plane.offset))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  }
+  GL_ASSERT(gl::api::pixelStore(gl::api::PixelStoreParameter::UnpackAlignment, 4));
+  m_pixelBuffer.unbind();
+}
+
+bool VideoOverlay::render(RenderContext& context)
+{
+  if(context.getRenderMode() != RenderMode::Full || m_size.x == 0 || m_size.y == 0)
+    return false;
+
+  context.pushState(getRenderState());
+  m_mesh->render(context);
+  context.popState();
+  return true;
+}
+} // namespace render::scene
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "renderable.h"
+#include "yuvconversion.h"
+
+#include <array>
+#include <gl/buffer.h>
+#include <gl/pixel.h>
+#include <gl/soglb_fwd.h>
+#include <memory>
+
+namespace render::scene
+{
+class Mesh;
+class ShaderManager;
+
+//! Presents 4:2:0 video frames; the planes are uploaded as they are, and the shader converts them to RGB and scales
+//! them to the viewport, so the CPU only copies the decoded data.
+class VideoOverlay final : public Renderable
+{
+public:
+  explicit VideoOverlay(ShaderManager& shaderManager, const glm::ivec2& viewport);
+
+  ~VideoOverlay() override;
+
+  //! Letterboxes the video to fit into @a viewport
+  void setViewport(const glm::ivec2& viewport);
+
+  //! Uploads a frame of the given luma @a size; @a planes are the Y, U and V planes with rows of @a strides bytes
+  void upload(const glm::ivec2& size, const std::array<const uint8_t*, 3>& planes, const std::array<int, 3>& strides);
+
+  bool render(RenderContext& context) override;
+
+private:
+  using PixelUnpackBuffer = gl::Buffer<uint8_t, gl::api::BufferTargetARB::PixelUnpackBuffer>;
+
+  std::array<std::shared_ptr<gl::Texture2D<gl::ScalarByte>>, 3> m_planes{};
+  PixelUnpackBuffer m_pixelBuffer{"video-pixel-buffer"};
+  YuvLayout m_layout{};
+  glm::ivec2 m_size{0};
+  glm::ivec2 m_viewport;
+  std::shared_ptr<Mesh> m_mesh;
+
+  void resize(const glm::ivec2& size);
+  void updateScale();
+};
+} // namespace render::scene
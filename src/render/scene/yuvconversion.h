@@ -0,0 +1,71 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace render::scene
+{
+struct YuvPlane
+{
+  glm::ivec2 size{0};
+  //! The byte offset of the plane's first row within the packed frame; rows are tightly packed
+  size_t offset = 0;
+};
+
+//! The layout of a packed 4:2:0 frame, i.e. a full resolution Y plane followed by the half resolution U and V planes
+struct YuvLayout
+{
+  std::array<YuvPlane, 3> planes{};
+  size_t size = 0;
+};
+
+[[nodiscard]] inline YuvLayout getYuv420Layout(const glm::ivec2& size)
+{
+  BOOST_ASSERT(size.x > 0 && size.y > 0);
+
+  // odd sizes are rounded up, as the last column or row still has its chroma sample
+  const glm::ivec2 chromaSize{(size.x + 1) / 2, (size.y + 1) / 2};
+
+  YuvLayout layout;
+  layout.planes[0] = YuvPlane{size, 0};
+  layout.planes[1] = YuvPlane{chromaSize, static_cast<size_t>(size.x) * size.y};
+  layout.planes[2] = YuvPlane{chromaSize, layout.planes[1].offset + static_cast<size_t>(chromaSize.x) * chromaSize.y};
+  layout.size = layout.planes[2].offset + static_cast<size_t>(chromaSize.x) * chromaSize.y;
+  return layout;
+}
+
+//! Copies the planes of a frame, which may have padded rows of @a strides bytes, into @a dst according to @a layout
+inline void packYuvPlanes(const YuvLayout& layout,
+                          const std::array<const uint8_t*, 3>& planes,
+                          const std::array<int, 3>& strides,
+                          uint8_t* dst)
+{
+  for(size_t i = 0; i < planes.size(); ++i)
+  {
+    const auto& plane = layout.planes[i];
+    BOOST_ASSERT(strides[i] >= plane.size.x);
+    auto src = planes[i];
+    auto planeDst = dst + plane.offset;
+    for(int y = 0; y < plane.size.y; ++y)
+    {
+      std::copy_n(src, plane.size.x, planeDst);
+      src += strides[i];
+      planeDst += plane.size.x;
+    }
+  }
+}
+
+//! Converts a limited range BT.601 sample to gamma encoded RGB in [0, 1]; keep in sync with yuv.frag. The video player
+//! converts all frames to this color space in its filter graph.
+[[nodiscard]] inline glm::vec3 yuvToRgb(const uint8_t y, const uint8_t u, const uint8_t v)
+{
+  const auto luma = (static_cast<float>(y) - 16.0f) / 219.0f;
+  const auto cb = (static_cast<float>(u) - 128.0f) / 224.0f;
+  const auto cr = (static_cast<float>(v) - 128.0f) / 224.0f;
+  return glm::clamp(
+    glm::vec3{luma + 1.402f * cr, luma - 0.344136f * cb - 0.714136f * cr, luma + 1.772f * cb}, 0.0f, 1.0f);
+}
+} // namespace render::scene
@@ -0,0 +1,545 @@
+#define BOOST_TEST_MODULE render_test
+
+#include "lightclustergrid.h"
+#include "occlusionquerytracker.h"
+#include "potentiallyvisibleset.h"
+#include "scene/dirtyregions.h"
+#include "scene/interpolation.h"
+#include "scene/vertexpacking.h"
+#include "scene/yuvconversion.h"
+
+#include <algorithm>
+#include <array>
+#include <boost/test/included/unit_test.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace render::scene;
+
+BOOST_AUTO_TEST_SUITE(vertex_packing_tests)
+
+BOOST_AUTO_TEST_CASE(test_vertex_color)
+{
+  // the geometry shader reconstructs colors with VERTEX_COLOR_SCALE
+  constexpr float shaderScale = 255.0f / 127.0f;
+
+  for(const float c : {0.0f, 0.25f, 0.5f, 1.0f, 1.5f, 2.0f})
+  {
+    const auto packed = packVertexColor(glm::vec4{c, c, c, 1.0f});
+    const auto unpacked = unpackVertexColor(packed);
+    BOOST_CHECK_CLOSE_FRACTION(unpacked.r + 1.0f, c + 1.0f, 1.0f / VertexColorScale);
+    BOOST_CHECK_CLOSE_FRACTION(float(packed.r) / 255.0f * shaderScale + 1.0f, c + 1.0f, 1.0f / VertexColorScale);
+    BOOST_CHECK_EQUAL(packed.a, 255);
+  }
+
+  // 1.0 and 2.0 must be represented exactly
+  BOOST_CHECK_EQUAL(unpackVertexColor(packVertexColor(glm::vec4{1.0f})).r, 1.0f);
+  BOOST_CHECK_EQUAL(unpackVertexColor(packVertexColor(glm::vec4{2.0f})).r, 2.0f);
+}
+
+BOOST_AUTO_TEST_CASE(test_vertex_normal)
+{
+  for(const auto& n : {glm::vec3{1, 0, 0},
+                       glm::vec3{0, -1, 0},
+                       glm::vec3{0, 0, 1},
+                       glm::normalize(glm::vec3{1, 2, 3}),
+                       glm::normalize(glm::vec3{-3, 0.5f, -1})})
+  {
+    const auto unpacked = unpackVertexNormal(packVertexNormal(n));
+    BOOST_CHECK_SMALL(glm::length(unpacked - n), 2.0f / 511.0f);
+    BOOST_CHECK_GT(glm::dot(glm::normalize(unpacked), n), 0.9999f);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_vertex_uv)
+{
+  for(uint32_t raw = 0; raw <= 0xffffu; raw += 0x101u)
+  {
+    // this is how the level data UVs are converted to GL coordinates
+    const auto uv = glm::vec2{float(raw) / 65536.0f, 1.0f - float(raw) / 65536.0f};
+    const auto unpacked = unpackVertexUV(packVertexUV(uv));
+    BOOST_CHECK_SMALL(std::abs(unpacked.x - uv.x), 1.0f / 65535.0f);
+    BOOST_CHECK_SMALL(std::abs(unpacked.y - uv.y), 1.0f / 65535.0f);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(vertex_welding_tests)
+
+namespace
+{
+struct TestVertex
+{
+  glm::vec3 position{};
+  gl::Int2101010Rev normal{};
+  glm::u8vec4 color{};
+
+  bool operator==(const TestVertex& rhs) const noexcept
+  {
+    return position == rhs.position && normal == rhs.normal && color == rhs.color;
+  }
+};
+
+struct TestVertexHash
+{
+  size_t operator()(const TestVertex& v) const noexcept
+  {
+    return std::hash<float>{}(v.position.x) ^ std::hash<uint32_t>{}(v.normal.value);
+  }
+};
+
+// a cube emitted as de-indexed quads, the way meshes were emitted without welding
+std::vector<TestVertex> createFatCube(bool smooth)
+{
+  static const std::array<glm::vec3, 6> faceNormals{glm::vec3{1, 0, 0},
+                                                    glm::vec3{-1, 0, 0},
+                                                    glm::vec3{0, 1, 0},
+                                                    glm::vec3{0, -1, 0},
+                                                    glm::vec3{0, 0, 1},
+                                                    glm::vec3{0, 0, -1}};
+
+  std::vector<TestVertex> result;
+  for(const auto& n : faceNormals)
+  {
+    const glm::vec3 u = n.x != 0 ? glm::vec3{0, 1, 0} : glm::vec3{1, 0, 0};
+    const glm::vec3 v = glm::cross(n, u);
+    for(const auto& corner : {-u - v, u - v, u + v, -u + v})
+    {
+      const auto position = n + corner;
+      result.emplace_back(TestVertex{position,
+                                     packVertexNormal(smooth ? glm::normalize(position) : n),
+                                     packVertexColor(glm::vec4{glm::abs(n) * 2.0f, 1.0f})});
+      if(smooth)
+        result.back().color = packVertexColor(glm::vec4{1.0f});
+    }
+  }
+  return result;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_welded_geometry_matches)
+{
+  for(const bool smooth : {false, true})
+  {
+    const auto fat = createFatCube(smooth);
+
+    std::vector<TestVertex> vertices;
+    std::vector<uint32_t> indices;
+    VertexWelder<TestVertex, uint32_t, TestVertexHash> welder{vertices};
+    for(const auto& v : fat)
+      indices.emplace_back(welder.add(v));
+
+    BOOST_REQUIRE_EQUAL(indices.size(), fat.size());
+    for(size_t i = 0; i < fat.size(); ++i)
+    {
+      BOOST_REQUIRE_LT(indices[i], vertices.size());
+      BOOST_CHECK(vertices[indices[i]] == fat[i]);
+    }
+
+    // flat shaded faces don't share any vertices, smooth shaded cubes only have their 8 corners
+    BOOST_CHECK_EQUAL(vertices.size(), smooth ? 8u : 24u);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(pvs_tests)
+
+namespace
+{
+constexpr float S = 1024.0f;
+
+// a vertical portal in the plane x == const
+render::PotentiallyVisibleSet::PortalGeometry
+  makePortalX(const size_t adjoiningRoom, const float x, const float z0, const float z1, const float normalX)
+{
+  return {adjoiningRoom,
+          glm::vec3{normalX, 0, 0},
+          {glm::vec3{x, 0, z0}, glm::vec3{x, S, z0}, glm::vec3{x, S, z1}, glm::vec3{x, 0, z1}}};
+}
+
+/*
+ * Four rooms forming a U-turn, seen from above:
+ *
+ *      z=2S +------+------+------+
+ *           |  3   |  2   |      |
+ *      z=S  +------+------+  1   |
+ *                  |  0   |      |
+ *      z=0         +------+------+
+ *         x=-S   x=0    x=S    x=2S
+ *
+ * Room 0 connects to room 1 at x=S, room 1 to room 2 at x=S, and room 2 to room 3 at x=0.
+ */
+render::PotentiallyVisibleSet::RoomPortals createUTurn()
+{
+  render::PotentiallyVisibleSet::RoomPortals rooms(4);
+  rooms[0].emplace_back(makePortalX(1, S, 0, S, -1));
+  rooms[1].emplace_back(makePortalX(0, S, 0, S, 1));
+  rooms[1].emplace_back(makePortalX(2, S, S, 2 * S, 1));
+  rooms[2].emplace_back(makePortalX(1, S, S, 2 * S, -1));
+  rooms[2].emplace_back(makePortalX(3, 0, S, 2 * S, 1));
+  rooms[3].emplace_back(makePortalX(2, 0, S, 2 * S, -1));
+  return rooms;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_adjacent_rooms_are_visible)
+{
+  const render::PotentiallyVisibleSet pvs{createUTurn()};
+  BOOST_REQUIRE_EQUAL(pvs.size(), 4);
+  for(size_t i = 0; i < 4; ++i)
+  {
+    BOOST_CHECK(pvs.isVisible(i, i));
+    if(i > 0)
+    {
+      BOOST_CHECK(pvs.isVisible(i, i - 1));
+      BOOST_CHECK(pvs.isVisible(i - 1, i));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_uturn_is_culled)
+{
+  const render::PotentiallyVisibleSet pvs{createUTurn()};
+
+  // the portals 0-1 and 1-2 are coplanar, so the conservative result must keep them
+  BOOST_CHECK(pvs.isVisible(0, 2));
+  BOOST_CHECK(pvs.isVisible(2, 0));
+
+  // room 3 is completely behind the portal room 0 is looking through
+  BOOST_CHECK(!pvs.isVisible(0, 3));
+  BOOST_CHECK(!pvs.isVisible(3, 0));
+}
+
+BOOST_AUTO_TEST_CASE(test_straight_corridor_is_visible)
+{
+  static constexpr size_t N = 10;
+  render::PotentiallyVisibleSet::RoomPortals rooms(N);
+  for(size_t i = 0; i < N; ++i)
+  {
+    const auto x0 = static_cast<float>(i) * S;
+    if(i > 0)
+      rooms[i].emplace_back(makePortalX(i - 1, x0, 0, S, 1));
+    if(i + 1 < N)
+      rooms[i].emplace_back(makePortalX(i + 1, x0 + S, 0, S, -1));
+  }
+
+  const render::PotentiallyVisibleSet pvs{rooms};
+  for(size_t a = 0; a < N; ++a)
+    BOOST_CHECK_EQUAL(pvs.getVisibleRooms(a).count(), N);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(occlusion_query_tests)
+
+BOOST_AUTO_TEST_CASE(test_unknown_is_visible)
+{
+  render::OcclusionQueryTracker tracker{3};
+  for(size_t i = 0; i < tracker.size(); ++i)
+  {
+    BOOST_CHECK(!tracker.isOccluded(i));
+    BOOST_CHECK(tracker.needsQuery(i));
+  }
+
+  // results that are not yet available must not change anything
+  tracker.setQueryIssued(1);
+  tracker.collectResults([](size_t) { return std::optional<bool>{}; });
+  BOOST_CHECK(!tracker.isOccluded(1));
+  BOOST_CHECK(!tracker.needsQuery(1));
+  BOOST_CHECK(tracker.isPending(1));
+}
+
+BOOST_AUTO_TEST_CASE(test_latent_results)
+{
+  render::OcclusionQueryTracker tracker{2};
+  tracker.setQueryIssued(0);
+  tracker.setQueryIssued(1);
+
+  std::vector<size_t> polled;
+  tracker.collectResults([&polled](size_t i) {
+    polled.emplace_back(i);
+    return i == 0 ? std::optional<bool>{false} : std::optional<bool>{};
+  });
+  BOOST_CHECK_EQUAL(polled.size(), 2);
+  BOOST_CHECK(tracker.isOccluded(0));
+  BOOST_CHECK(tracker.needsQuery(0));
+  BOOST_CHECK(!tracker.isOccluded(1));
+  BOOST_CHECK_EQUAL(tracker.getOccludedCount(), 1);
+
+  // only pending queries are polled
+  polled.clear();
+  tracker.collectResults([&polled](size_t i) {
+    polled.emplace_back(i);
+    return std::optional<bool>{true};
+  });
+  BOOST_REQUIRE_EQUAL(polled.size(), 1);
+  BOOST_CHECK_EQUAL(polled[0], 1);
+
+  // an occluded candidate stays occluded until a new result says otherwise
+  BOOST_CHECK(tracker.isOccluded(0));
+  tracker.setQueryIssued(0);
+  BOOST_CHECK(tracker.isOccluded(0));
+  tracker.collectResults([](size_t) { return std::optional<bool>{true}; });
+  BOOST_CHECK(!tracker.isOccluded(0));
+  BOOST_CHECK_EQUAL(tracker.getOccludedCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalidate)
+{
+  render::OcclusionQueryTracker tracker{1};
+  tracker.setQueryIssued(0);
+  tracker.collectResults([](size_t) { return std::optional<bool>{false}; });
+  BOOST_CHECK(tracker.isOccluded(0));
+
+  tracker.setQueryIssued(0);
+  tracker.invalidate(0);
+  BOOST_CHECK(!tracker.isOccluded(0));
+  BOOST_CHECK(!tracker.isPending(0));
+  BOOST_CHECK(tracker.needsQuery(0));
+
+  tracker.setQueryIssued(0);
+  tracker.reset(2);
+  BOOST_CHECK_EQUAL(tracker.size(), 2);
+  BOOST_CHECK(!tracker.isPending(0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(light_cluster_tests)
+
+namespace
+{
+constexpr float NearPlane = 20.0f;
+constexpr float FarPlane = 20480.0f;
+
+render::LightClusterGrid buildGrid(const std::vector<glm::vec4>& lights)
+{
+  const auto view = glm::lookAt(glm::vec3{100, 200, 300}, glm::vec3{1100, 0, -2000}, glm::vec3{0, 1, 0});
+  const auto projection = glm::perspective(glm::radians(80.0f), 16.0f / 9.0f, NearPlane, FarPlane);
+
+  render::LightClusterGrid grid;
+  grid.build(view, projection, NearPlane, FarPlane, lights);
+  return grid;
+}
+
+bool contains(const std::vector<uint32_t>& lights, const uint32_t light)
+{
+  return std::find(lights.begin(), lights.end(), light) != lights.end();
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_clusters_are_conservative)
+{
+  const std::vector<glm::vec4> lights{
+    {1100, 0, -2000, 500}, {100, 200, 250, 300}, {-3000, 500, -1000, 2500}, {5000, -800, -9000, 4000}};
+  const auto grid = buildGrid(lights);
+  BOOST_REQUIRE_EQUAL(grid.getClusters().size(), render::LightClusterGrid::ClusterCount);
+
+  static constexpr int Steps = 12;
+  for(uint32_t i = 0; i < lights.size(); ++i)
+  {
+    const auto center = glm::vec3{lights[i]};
+    const auto radius = lights[i].w;
+    for(int x = -Steps; x <= Steps; ++x)
+    {
+      for(int y = -Steps; y <= Steps; ++y)
+      {
+        for(int z = -Steps; z <= Steps; ++z)
+        {
+          const auto p = center + glm::vec3{x, y, z} * radius / static_cast<float>(Steps);
+          if(glm::distance(p, center) > radius || !grid.findCluster(p).has_value())
+            continue;
+
+          BOOST_CHECK(contains(grid.getLights(p), i));
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_clusters_are_selective)
+{
+  // one light in front of the camera, one behind it
+  const std::vector<glm::vec4> lights{{1100, 0, -2000, 500}, {-900, 400, 2600, 500}};
+  const auto grid = buildGrid(lights);
+
+  BOOST_CHECK(contains(grid.getLights(glm::vec3{1100, 0, -2000}), 0));
+  BOOST_CHECK(!contains(grid.getLights(glm::vec3{1100, 0, -2000}), 1));
+
+  // far behind the light, along the view direction
+  BOOST_CHECK(grid.getLights(glm::vec3{2100, -200, -4300}).empty());
+
+  const auto& indices = grid.getLightIndices();
+  BOOST_CHECK(!indices.empty());
+  BOOST_CHECK(!contains(indices, 1));
+
+  size_t count = 0;
+  for(const auto& cluster : grid.getClusters())
+  {
+    BOOST_CHECK_EQUAL(cluster.offset, count);
+    count += cluster.count;
+  }
+  BOOST_CHECK_EQUAL(count, indices.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(interpolation_tests)
+
+BOOST_AUTO_TEST_CASE(test_interpolate_transform)
+{
+  const glm::mat4 a{1.0f};
+  const auto b
+    = glm::rotate(glm::translate(glm::mat4{1.0f}, glm::vec3{100, -50, 20}), glm::radians(90.0f), glm::vec3{0, 1, 0});
+
+  BOOST_CHECK(interpolateTransform(a, b, 0) == a);
+  BOOST_CHECK(interpolateTransform(a, b, 1) == b);
+  BOOST_CHECK(interpolateTransform(a, b, -1) == a);
+  BOOST_CHECK(interpolateTransform(a, b, 2) == b);
+
+  const auto half = interpolateTransform(a, b, 0.5f);
+  BOOST_CHECK_SMALL(glm::distance(glm::vec3{half[3]}, glm::vec3{50, -25, 10}), 1e-4f);
+
+  // the rotation is halfway, and the result is still a rigid transform
+  const auto expected = glm::rotate(glm::mat4{1.0f}, glm::radians(45.0f), glm::vec3{0, 1, 0});
+  for(int i = 0; i < 3; ++i)
+  {
+    BOOST_CHECK_SMALL(glm::distance(glm::vec3{half[i]}, glm::vec3{expected[i]}), 1e-4f);
+    BOOST_CHECK_CLOSE_FRACTION(glm::length(glm::vec3{half[i]}), 1.0f, 1e-4f);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(yuv_conversion_tests)
+
+BOOST_AUTO_TEST_CASE(test_layout)
+{
+  const auto layout = getYuv420Layout({5, 3});
+  BOOST_CHECK(layout.planes[0].size == glm::ivec2(5, 3));
+  BOOST_CHECK(layout.planes[1].size == glm::ivec2(3, 2));
+  BOOST_CHECK(layout.planes[2].size == glm::ivec2(3, 2));
+  BOOST_CHECK_EQUAL(layout.planes[0].offset, 0);
+  BOOST_CHECK_EQUAL(layout.planes[1].offset, 15);
+  BOOST_CHECK_EQUAL(layout.planes[2].offset, 21);
+  BOOST_CHECK_EQUAL(layout.size, 27);
+}
+
+BOOST_AUTO_TEST_CASE(test_pack_strided_planes)
+{
+  const auto layout = getYuv420Layout({3, 2});
+
+  // each row is padded to 8 bytes, the padding must not end up in the packed frame
+  std::array<uint8_t, 16> y{};
+  std::array<uint8_t, 8> u{};
+  std::array<uint8_t, 8> v{};
+  std::fill(y.begin(), y.end(), 0xff);
+  std::fill(u.begin(), u.end(), 0xff);
+  std::fill(v.begin(), v.end(), 0xff);
+  for(uint8_t i = 0; i < 3; ++i)
+  {
+    y[i] = i;
+    y[8 + i] = 10 + i;
+  }
+  u[0] = 20;
+  u[1] = 21;
+  v[0] = 30;
+  v[1] = 31;
+
+  std::vector<uint8_t> packed(layout.size);
+  packYuvPlanes(layout, {y.data(), u.data(), v.data()}, {8, 8, 8}, packed.data());
+
+  const std::vector<uint8_t> expected{0, 1, 2, 10, 11, 12, 20, 21, 30, 31};
+  BOOST_CHECK_EQUAL_COLLECTIONS(packed.begin(), packed.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_reference_colors)
+{
+  constexpr float Tolerance = 0.01f;
+
+  BOOST_CHECK(glm::all(glm::lessThan(glm::abs(yuvToRgb(16, 128, 128) - glm::vec3{0, 0, 0}), glm::vec3{Tolerance})));
+  BOOST_CHECK(glm::all(glm::lessThan(glm::abs(yuvToRgb(235, 128, 128) - glm::vec3{1, 1, 1}), glm::vec3{Tolerance})));
+  // the BT.601 encodings of the primaries
+  BOOST_CHECK(glm::all(glm::lessThan(glm::abs(yuvToRgb(81, 90, 240) - glm::vec3{1, 0, 0}), glm::vec3{Tolerance})));
+  BOOST_CHECK(glm::all(glm::lessThan(glm::abs(yuvToRgb(145, 54, 34) - glm::vec3{0, 1, 0}), glm::vec3{Tolerance})));
+  BOOST_CHECK(glm::all(glm::lessThan(glm::abs(yuvToRgb(41, 240, 110) - glm::vec3{0, 0, 1}), glm::vec3{Tolerance})));
+
+  // out of gamut samples are clamped
+  BOOST_CHECK(yuvToRgb(0, 128, 128) == glm::vec3{0});
+  BOOST_CHECK(yuvToRgb(255, 128, 128) == glm::vec3{1});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(dirty_regions_tests)
+
+BOOST_AUTO_TEST_CASE(test_clip_and_ignore_empty)
+{
+  DirtyRegions regions{{100, 50}};
+  regions.add(PixelRect{{10, 10}, {10, 20}});
+  regions.add(PixelRect{{200, 0}, {300, 10}});
+  BOOST_CHECK(regions.empty());
+
+  regions.add(PixelRect{{-5, 40}, {20, 60}});
+  BOOST_REQUIRE_EQUAL(regions.getRects().size(), 1);
+  BOOST_CHECK(regions.getRects()[0].min == glm::ivec2(0, 40));
+  BOOST_CHECK(regions.getRects()[0].max == glm::ivec2(20, 50));
+}
+
+BOOST_AUTO_TEST_CASE(test_merge_overlapping)
+{
+  DirtyRegions regions{{100, 100}};
+  regions.add(PixelRect{{0, 0}, {10, 10}});
+  regions.add(PixelRect{{20, 0}, {30, 10}});
+  // touching rectangles stay separate
+  regions.add(PixelRect{{10, 0}, {20, 5}});
+  BOOST_CHECK_EQUAL(regions.getRects().size(), 3);
+
+  // bridges all three, so they collapse into one
+  regions.add(PixelRect{{5, 5}, {25, 8}});
+  BOOST_REQUIRE_EQUAL(regions.getRects().size(), 1);
+  BOOST_CHECK(regions.getRects()[0].min == glm::ivec2(0, 0));
+  BOOST_CHECK(regions.getRects()[0].max == glm::ivec2(30, 10));
+}
+
+BOOST_AUTO_TEST_CASE(test_rect_limit)
+{
+  DirtyRegions regions{{4000, 2000}};
+
+  // a column of text lines and one far away label
+  regions.add(PixelRect{{3900, 1900}, {3950, 1920}});
+  for(int i = 0; i < 20; ++i)
+    regions.add(PixelRect{{10, 10 + i * 14}, {400, 22 + i * 14}});
+
+  BOOST_CHECK_LE(regions.getRects().size(), DirtyRegions::MaxRects);
+
+  // the far label must not be merged with the text column
+  const auto& rects = regions.getRects();
+  BOOST_CHECK(std::any_of(rects.begin(), rects.end(), [](const PixelRect& r) {
+    return r.min == glm::ivec2(3900, 1900) && r.max == glm::ivec2(3950, 1920);
+  }));
+
+  size_t area = 0;
+  for(const auto& r : rects)
+  {
+    area += r.getArea();
+    for(const auto& other : rects)
+      BOOST_CHECK(&r == &other || !r.intersects(other));
+  }
+  BOOST_CHECK_LT(area, 400 * 300 + 50 * 20);
+}
+
+BOOST_AUTO_TEST_CASE(test_add_all)
+{
+  DirtyRegions regions{{64, 32}};
+  regions.add(PixelRect{{1, 1}, {2, 2}});
+  regions.addAll();
+  BOOST_REQUIRE_EQUAL(regions.getRects().size(), 1);
+  BOOST_CHECK_EQUAL(regions.getRects()[0].getArea(), 64 * 32);
+
+  regions.reset({8, 8});
+  BOOST_CHECK(regions.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
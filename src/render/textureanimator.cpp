@@ -44,8 +44,8 @@ void TextureAnimator::Sequence::updateCoordinates(const std::vector<loader::file
       BOOST_ASSERT(vref.queueOffset < tileIds.size());
       const loader::file::TextureTile& tile = tiles[tileIds[vref.queueOffset].get()];
 
-      uvArray[vref.bufferIndex].uv = tile.uvCoordinates[vref.sourceIndex].toGl();
-      uvArray[vref.bufferIndex].index = tile.textureKey.tileAndFlag & loader::file::TextureIndexMask;
+      uvArray[vref.bufferIndex] = AnimatedUV{tile.textureKey.tileAndFlag & loader::file::TextureIndexMask,
+                                             tile.uvCoordinates[vref.sourceIndex].toGl()};
     }
 
     buffer->unmap();
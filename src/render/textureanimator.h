@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/id.h"
+#include "scene/vertexpacking.h"
 
 #include <boost/assert.hpp>
 #include <gl/soglb_fwd.h>
@@ -19,19 +20,21 @@ namespace render
 class TextureAnimator
 {
 public:
+  //! The texture coordinates of a room face corner, packed like the UVs and texture indices of mesh vertices
   struct AnimatedUV
   {
-    glm::int32_t index{-1};
-    glm::vec2 uv{};
+    glm::u16vec2 uv{};
+    glm::int16_t index{-1};
 
     explicit AnimatedUV() = default;
 
-    explicit AnimatedUV(glm::int32_t index, const glm::vec2& uv)
-        : index{index}
-        , uv{uv}
+    explicit AnimatedUV(const glm::int32_t index, const glm::vec2& uv)
+        : uv{scene::packVertexUV(uv)}
+        , index{gsl::narrow<glm::int16_t>(index)}
     {
     }
   };
+  static_assert(sizeof(AnimatedUV) == 6, "Invalid AnimatedUV struct size");
 
   explicit TextureAnimator(const std::vector<uint16_t>& data);
 
@@ -28,13 +28,9 @@ struct ObjectReference final
     else
     {
       ser.tag("objectref");
-      for(const auto& [objId, obj] : ser.context.getObjectManager().getObjects())
+      if(auto id = ser.context.getObjectManager().getObjects().getId(ptr.get()))
       {
-        if(obj.get() == ptr)
-        {
-          engine::ObjectId tmp = objId;
-          ser(S_NV("id", tmp));
-        }
+        ser(S_NV("id", *id));
       }
     }
   }
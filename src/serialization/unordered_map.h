@@ -2,8 +2,11 @@
 
 #include "access.h"
 
+#include <algorithm>
+#include <functional>
 #include <ryml.hpp>
 #include <unordered_map>
+#include <vector>
 
 namespace serialization
 {
@@ -12,10 +15,21 @@ void save(std::unordered_map<T, U>& data, const Serializer<TContext>& ser)
 {
   ser.tag("map");
   ser.node |= ryml::SEQ;
-  for(auto& [key, value] : data)
+
+  // the iteration order depends on the addresses of pointer keys, so the entries are sorted to save equal states
+  // identically, e.g. for the benchmark state hash
+  std::vector<std::pair<const T, U>*> entries;
+  entries.reserve(data.size());
+  for(auto& entry : data)
+    entries.emplace_back(&entry);
+  std::sort(entries.begin(), entries.end(), [](const auto* lhs, const auto* rhs) {
+    return std::less<T>{}(lhs->first, rhs->first);
+  });
+
+  for(const auto& entry : entries)
   {
     const auto tmp = ser.newChild();
-    tmp(S_NV("key", const_cast<T&>(key)), S_NV("value", value));
+    tmp(S_NV("key", const_cast<T&>(entry->first)), S_NV("value", entry->second));
   }
 }
 
@@ -2,8 +2,11 @@
 
 #include "access.h"
 
+#include <algorithm>
+#include <functional>
 #include <ryml.hpp>
 #include <unordered_set>
+#include <vector>
 
 namespace serialization
 {
@@ -12,10 +15,18 @@ void save(std::unordered_set<T>& data, const Serializer<TContext>& ser)
 {
   ser.tag("set");
   ser.node |= ryml::SEQ;
-  for(auto& element : data)
+
+  // see save() for std::unordered_map
+  std::vector<const T*> elements;
+  elements.reserve(data.size());
+  for(const auto& element : data)
+    elements.emplace_back(&element);
+  std::sort(elements.begin(), elements.end(), [](const T* lhs, const T* rhs) { return std::less<T>{}(*lhs, *rhs); });
+
+  for(const auto& element : elements)
   {
     const auto tmp = ser.newChild();
-    access<T>::callSerializeOrSave(element, tmp);
+    access<T>::callSerializeOrSave(*element, tmp);
   }
 }
 
@@ -1,3 +1,7 @@
 #pragma once
 
-#include <GL/glew.h>
+#ifdef SOGLB_NULL_BACKEND
+#  include "../null/nullgl.h"
+#else
+#  include <GL/glew.h>
+#endif
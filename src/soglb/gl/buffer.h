@@ -118,5 +118,14 @@ public:
                                 TypeTraits<T>::DrawElementsType,
                                 nullptr));
   }
+
+  void drawElementsInstanced(api::PrimitiveType primitiveType, const api::core::SizeType instanceCount) const
+  {
+    GL_ASSERT(api::drawElementsInstance(primitiveType,
+                                        Buffer<T, api::BufferTargetARB::ElementArrayBuffer>::size(),
+                                        TypeTraits<T>::DrawElementsType,
+                                        nullptr,
+                                        instanceCount));
+  }
 };
 } // namespace gl
@@ -118,7 +118,8 @@ Font::~Font()
   m_cache = nullptr;
 }
 
-void Font::drawText(Image<SRGBA8>& img, const gsl::czstring text, glm::ivec2 xy, const SRGBA8& color, int size)
+std::pair<glm::ivec2, glm::ivec2>
+  Font::drawText(Image<SRGBA8>& img, const gsl::czstring text, glm::ivec2 xy, const SRGBA8& color, int size)
 {
   Expects(text);
   Expects(size > 0);
@@ -134,6 +135,7 @@ void Font::drawText(Image<SRGBA8>& img, const gsl::czstring text, glm::ivec2 xy,
   imgType.height = size;
   imgType.flags = FT_LOAD_DEFAULT | FT_LOAD_RENDER; // NOLINT(hicpp-signed-bitwise)
 
+  std::optional<std::pair<glm::ivec2, glm::ivec2>> bounds;
   std::optional<char32_t> prevChar = std::nullopt;
   std::vector<char32_t> utf32;
   utf8::utf8to32(text, text + std::strlen(text), std::back_inserter(utf32));
@@ -156,6 +158,16 @@ void Font::drawText(Image<SRGBA8>& img, const gsl::czstring text, glm::ivec2 xy,
       continue;
     }
 
+    if(sbit->width > 0 && sbit->height > 0)
+    {
+      const auto glyphMin = xy + glm::ivec2{sbit->left, -sbit->top};
+      const auto glyphMax = glyphMin + glm::ivec2{sbit->width, sbit->height};
+      if(!bounds.has_value())
+        bounds = std::pair{glyphMin, glyphMax};
+      else
+        bounds = std::pair{glm::min(bounds->first, glyphMin), glm::max(bounds->second, glyphMax)};
+    }
+
     for(int dy = 0, i = 0; dy < sbit->height; dy++)
     {
       for(int dx = 0; dx < sbit->width; dx++, i++)
@@ -174,6 +186,8 @@ void Font::drawText(Image<SRGBA8>& img, const gsl::czstring text, glm::ivec2 xy,
     FTC_Node_Unref(node, m_cache);
     prevChar = chr;
   }
+
+  return bounds.value_or(std::pair{xy, xy});
 }
 
 glm::ivec2 Font::getBounds(const gsl::czstring text, int size) const
@@ -226,16 +240,16 @@ glm::ivec2 Font::getBounds(const gsl::czstring text, int size) const
   return glm::ivec2{x, y};
 }
 
-void Font::drawText(Image<SRGBA8>& img,
-                    const std::string& text,
-                    const glm::ivec2& xy,
-                    const uint8_t red,
-                    const uint8_t green,
-                    const uint8_t blue,
-                    const uint8_t alpha,
-                    const int size)
+std::pair<glm::ivec2, glm::ivec2> Font::drawText(Image<SRGBA8>& img,
+                                                 const std::string& text,
+                                                 const glm::ivec2& xy,
+                                                 const uint8_t red,
+                                                 const uint8_t green,
+                                                 const uint8_t blue,
+                                                 const uint8_t alpha,
+                                                 const int size)
 {
-  drawText(img, text.c_str(), xy, SRGBA8{red, green, blue, alpha}, size);
+  return drawText(img, text.c_str(), xy, SRGBA8{red, green, blue, alpha}, size);
 }
 
 FT_Size_Metrics Font::getMetrics()
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <glm/common.hpp>
 #include <optional>
+#include <utility>
 
 namespace gl
 {
@@ -36,9 +37,12 @@ public:
   Font& operator=(const Font&) = delete;
   Font& operator=(Font&&) = delete;
 
-  void drawText(Image<SRGBA8>& img, gsl::czstring text, glm::ivec2 xy, const SRGBA8& color, int size);
+  //! Returns the top left and the exclusive bottom right corner of the glyph boxes, which are equal if nothing was drawn;
+  //! the corners are not clipped to the image
+  std::pair<glm::ivec2, glm::ivec2>
+    drawText(Image<SRGBA8>& img, gsl::czstring text, glm::ivec2 xy, const SRGBA8& color, int size);
   glm::ivec2 getBounds(gsl::czstring text, int size) const;
-  void drawText(Image<SRGBA8>& img,
+  std::pair<glm::ivec2, glm::ivec2> drawText(Image<SRGBA8>& img,
                 const std::string& text,
                 const glm::ivec2& xy,
                 uint8_t red,
@@ -3,7 +3,8 @@
 #include "glassert.h"
 #include "renderstate.h"
 
-#include <GL/glew.h>
+#include "api/gl_api_provider.hpp"
+
 #include <boost/log/trivial.hpp>
 
 using namespace gl;
@@ -79,6 +80,9 @@ void SOGLB_API debugCallback(const api::DebugSource source,
 
 void gl::initializeGl()
 {
+#ifdef SOGLB_NULL_BACKEND
+  BOOST_LOG_TRIVIAL(info) << "Using the null OpenGL backend, nothing will be rendered";
+#else
   glewExperimental = GL_TRUE; // Let GLEW ignore "GL_INVALID_ENUM in glGetString(GL_EXTENSIONS)"
   const auto err = glewInit();
   if(err != GLEW_OK)
@@ -88,6 +92,7 @@ void gl::initializeGl()
                                   glewGetErrorString(err));
     BOOST_THROW_EXCEPTION(std::runtime_error("Failed to initialize GLEW"));
   }
+#endif
 
   BOOST_LOG_TRIVIAL(info) << "OpenGL version: "
                           << reinterpret_cast<const char*>(api::getString(api::StringName::Version));
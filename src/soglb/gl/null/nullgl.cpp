@@ -0,0 +1,834 @@
+#include "nullgl.h"
+
+#include "statistics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace gl::null
+{
+namespace
+{
+constexpr GLint True = 1;
+
+constexpr GLenum VertexShader = 0x8B31;
+constexpr GLenum FragmentShader = 0x8B30;
+constexpr GLenum CompileStatus = 0x8B81;
+constexpr GLenum LinkStatus = 0x8B82;
+constexpr GLenum ValidateStatus = 0x8B83;
+constexpr GLenum ShaderType = 0x8B4F;
+constexpr GLenum FramebufferComplete = 0x8CD5;
+constexpr GLenum AlreadySignaled = 0x911A;
+constexpr GLenum QueryResult = 0x8866;
+constexpr GLenum QueryResultAvailable = 0x8867;
+constexpr GLenum MaxLabelLength = 0x82E8;
+constexpr GLenum MaxTextureSize = 0x0D33;
+constexpr GLenum TextureWidth = 0x1000;
+constexpr GLenum TextureHeight = 0x1001;
+constexpr GLenum TextureDepth = 0x8071;
+
+constexpr GLenum Uniform = 0x92E1;
+constexpr GLenum UniformBlock = 0x92E2;
+constexpr GLenum ProgramInput = 0x92E3;
+constexpr GLenum ProgramOutput = 0x92E4;
+constexpr GLenum ShaderStorageBlock = 0x92E6;
+constexpr GLenum ActiveResources = 0x92F5;
+constexpr GLenum MaxNameLength = 0x92F6;
+constexpr GLenum NameLength = 0x92F9;
+constexpr GLenum Type = 0x92FA;
+constexpr GLenum ArraySize = 0x92FB;
+constexpr GLenum BlockIndex = 0x92FD;
+constexpr GLenum BufferBinding = 0x9302;
+constexpr GLenum Location = 0x930E;
+constexpr GLenum UniformType = 0x8A37;
+constexpr GLenum UniformSize = 0x8A38;
+constexpr GLenum UniformNameLength = 0x8A39;
+constexpr GLenum UniformBlockIndex = 0x8A3A;
+
+constexpr GLenum Float = 0x1406;
+
+struct ShaderState
+{
+  GLenum type = 0;
+  std::string source{};
+};
+
+struct Resource
+{
+  std::string name;
+  GLint type = Float;
+  GLint arraySize = 1;
+  GLint location = -1;
+  GLint binding = 0;
+};
+
+struct ProgramState
+{
+  std::vector<GLuint> shaders{};
+  std::map<GLenum, std::vector<Resource>> resources{};
+};
+
+struct TextureState
+{
+  GLsizei width = 0;
+  GLsizei height = 0;
+  GLsizei depth = 0;
+};
+
+struct State
+{
+  GLuint nextHandle = 1;
+  // the keys are the names of the entry points, which are string literals
+  std::unordered_map<std::string_view, size_t> calls{};
+  size_t uploadedBufferBytes = 0;
+
+  std::unordered_map<GLuint, std::vector<uint8_t>> buffers{};
+  std::unordered_map<GLuint, TextureState> textures{};
+  std::unordered_map<GLuint, ShaderState> shaders{};
+  std::unordered_map<GLuint, ProgramState> programs{};
+
+  GLuint createHandle()
+  {
+    return nextHandle++;
+  }
+
+  void createHandles(const GLsizei n, GLuint* handles)
+  {
+    for(GLsizei i = 0; i < n; ++i)
+      handles[i] = createHandle();
+  }
+};
+
+State& getState()
+{
+  static State state;
+  return state;
+}
+
+GLint getUniformType(const std::string& glslType)
+{
+  static const std::unordered_map<std::string, GLint> types{
+    {"float", 0x1406},
+    {"vec2", 0x8B50},
+    {"vec3", 0x8B51},
+    {"vec4", 0x8B52},
+    {"int", 0x1404},
+    {"ivec2", 0x8B53},
+    {"ivec3", 0x8B54},
+    {"ivec4", 0x8B55},
+    {"uint", 0x1405},
+    {"bool", 0x8B56},
+    {"mat2", 0x8B5A},
+    {"mat3", 0x8B5B},
+    {"mat4", 0x8B5C},
+    {"sampler1D", 0x8B5D},
+    {"sampler2D", 0x8B5E},
+    {"sampler3D", 0x8B5F},
+    {"samplerCube", 0x8B60},
+    {"sampler1DShadow", 0x8B61},
+    {"sampler2DShadow", 0x8B62},
+    {"sampler1DArray", 0x8DC0},
+    {"sampler2DArray", 0x8DC1},
+    {"sampler2DArrayShadow", 0x8DC4},
+    {"samplerCubeShadow", 0x8DC5},
+  };
+
+  const auto it = types.find(glslType);
+  return it == types.end() ? Float : it->second;
+}
+
+//! Removes comments and inactive conditional blocks; conditions other than (n)def are conservatively assumed to be true
+std::string preprocess(const std::string& source)
+{
+  static const std::regex comments{R"(//[^\n]*|/\*[\s\S]*?\*/)"};
+  const auto stripped = std::regex_replace(source, comments, " ");
+
+  struct Conditional
+  {
+    bool parentActive;
+    std::optional<bool> condition;
+  };
+
+  std::set<std::string> defines;
+  std::vector<Conditional> conditionals;
+  bool active = true;
+  std::string result;
+
+  std::istringstream lines{stripped};
+  std::string line;
+  while(std::getline(lines, line))
+  {
+    std::istringstream tokens{line};
+    std::string directive;
+    std::string name;
+    tokens >> directive >> name;
+
+    if(directive == "#ifdef" || directive == "#ifndef")
+    {
+      const bool condition = (defines.count(name) != 0) == (directive == "#ifdef");
+      conditionals.emplace_back(Conditional{active, condition});
+      active = active && condition;
+    }
+    else if(directive == "#if")
+    {
+      conditionals.emplace_back(Conditional{active, std::nullopt});
+    }
+    else if(directive == "#else" && !conditionals.empty())
+    {
+      const auto& conditional = conditionals.back();
+      active = conditional.parentActive && !conditional.condition.value_or(false);
+    }
+    else if(directive == "#endif" && !conditionals.empty())
+    {
+      active = conditionals.back().parentActive;
+      conditionals.pop_back();
+    }
+    else if(active)
+    {
+      if(directive == "#define")
+        defines.emplace(name);
+      result += line;
+      result += '\n';
+    }
+  }
+
+  return result;
+}
+
+std::optional<GLint> getLayoutQualifier(const std::string& layout, const std::string& qualifier)
+{
+  const std::regex re{"\\b" + qualifier + R"(\s*=\s*(\d+))"};
+  std::smatch match;
+  if(!std::regex_search(layout, match, re))
+    return std::nullopt;
+  return std::stoi(match[1].str());
+}
+
+void addResource(std::vector<Resource>& resources, Resource resource)
+{
+  if(std::any_of(resources.begin(), resources.end(), [&resource](const Resource& existing) {
+       return existing.name == resource.name;
+     }))
+  {
+    return;
+  }
+
+  resources.emplace_back(std::move(resource));
+}
+
+//! Gives every located resource without an explicit location the next location that is not taken yet
+void assignLocations(std::vector<Resource>& resources)
+{
+  GLint next = 0;
+  for(const auto& resource : resources)
+  {
+    if(resource.location >= 0)
+      next = std::max(next, resource.location + resource.arraySize);
+  }
+
+  for(auto& resource : resources)
+  {
+    if(resource.location < 0)
+    {
+      resource.location = next;
+      next += resource.arraySize;
+    }
+  }
+}
+
+//! Finds the resources declared by the shaders, approximating the reflection of a real driver
+void reflect(ProgramState& program)
+{
+  static const std::regex uniformRe{
+    R"((?:layout\s*\(([^)]*)\)\s*)?\buniform\s+(\w+)\s+(\w+)\s*(?:\[\s*(\d+)\s*\])?\s*(?:=[^;]*)?;)"};
+  static const std::regex uniformBlockRe{R"((?:layout\s*\(([^)]*)\)\s*)?\buniform\s+(\w+)\s*\{)"};
+  static const std::regex storageBlockRe{
+    R"((?:layout\s*\(([^)]*)\)\s*)?(?:\b(?:readonly|writeonly|coherent|restrict|volatile)\s+)*\bbuffer\s+(\w+)\s*\{)"};
+  static const std::regex inputRe{R"((?:layout\s*\(([^)]*)\)\s*)?\bin\s+(\w+)\s+(\w+)\s*;)"};
+  static const std::regex outputRe{R"((?:layout\s*\(([^)]*)\)\s*)?\bout\s+(\w+)\s+(\w+)\s*;)"};
+
+  auto& resources = program.resources;
+  resources.clear();
+
+  for(const auto shaderHandle : program.shaders)
+  {
+    const auto it = getState().shaders.find(shaderHandle);
+    if(it == getState().shaders.end())
+      continue;
+
+    const auto& shader = it->second;
+    const auto source = preprocess(shader.source);
+    const auto forEachMatch = [&source](const std::regex& re, const auto& fn) {
+      for(auto match = std::sregex_iterator{source.begin(), source.end(), re}; match != std::sregex_iterator{};
+          ++match)
+        fn(*match);
+    };
+
+    forEachMatch(uniformRe, [&resources](const std::smatch& match) {
+      const auto layout = match[1].str();
+      addResource(resources[Uniform],
+                  Resource{match[3].str(),
+                           getUniformType(match[2].str()),
+                           match[4].matched ? std::stoi(match[4].str()) : 1,
+                           getLayoutQualifier(layout, "location").value_or(-1),
+                           0});
+    });
+    forEachMatch(uniformBlockRe, [&resources](const std::smatch& match) {
+      addResource(resources[UniformBlock],
+                  Resource{match[2].str(), 0, 1, -1, getLayoutQualifier(match[1].str(), "binding").value_or(0)});
+    });
+    forEachMatch(storageBlockRe, [&resources](const std::smatch& match) {
+      addResource(resources[ShaderStorageBlock],
+                  Resource{match[2].str(), 0, 1, -1, getLayoutQualifier(match[1].str(), "binding").value_or(0)});
+    });
+
+    if(shader.type == VertexShader || shader.type == FragmentShader)
+    {
+      const auto interface = shader.type == VertexShader ? ProgramInput : ProgramOutput;
+      forEachMatch(shader.type == VertexShader ? inputRe : outputRe, [&resources, interface](const std::smatch& match) {
+        addResource(resources[interface],
+                    Resource{match[3].str(),
+                             getUniformType(match[2].str()),
+                             1,
+                             getLayoutQualifier(match[1].str(), "location").value_or(-1),
+                             0});
+      });
+    }
+  }
+
+  assignLocations(resources[Uniform]);
+  assignLocations(resources[ProgramInput]);
+  assignLocations(resources[ProgramOutput]);
+}
+
+const Resource* findResource(const GLuint program, const GLenum programInterface, const GLuint index)
+{
+  const auto programIt = getState().programs.find(program);
+  if(programIt == getState().programs.end())
+    return nullptr;
+
+  const auto resourcesIt = programIt->second.resources.find(programInterface);
+  if(resourcesIt == programIt->second.resources.end() || index >= resourcesIt->second.size())
+    return nullptr;
+
+  return &resourcesIt->second[index];
+}
+
+void copyString(const std::string& src, const GLsizei bufSize, GLsizei* length, GLchar* dst)
+{
+  const auto n = bufSize > 0 ? std::min(src.size(), static_cast<size_t>(bufSize - 1)) : size_t{0};
+  if(bufSize > 0)
+  {
+    std::copy_n(src.data(), n, dst);
+    dst[n] = '\0';
+  }
+  if(length != nullptr)
+    *length = static_cast<GLsizei>(n);
+}
+
+template<typename T>
+void getQueryObject(const GLenum pname, T* params)
+{
+  // all queries are immediately available, and every occlusion query has passed
+  *params = pname == QueryResultAvailable || pname == QueryResult ? T{1} : T{0};
+}
+
+void upload(std::vector<uint8_t>& buffer, const size_t offset, const size_t size, const void* data)
+{
+  if(buffer.size() < offset + size)
+    buffer.resize(offset + size);
+  if(data != nullptr)
+    std::memcpy(buffer.data() + offset, data, size);
+  getState().uploadedBufferBytes += size;
+}
+} // namespace
+
+namespace detail
+{
+void recordCall(const char* entryPoint)
+{
+  ++getState().calls[entryPoint];
+}
+} // namespace detail
+
+size_t Statistics::getTotalCalls() const
+{
+  size_t total = 0;
+  for(const auto& [name, count] : calls)
+    total += count;
+  return total;
+}
+
+size_t Statistics::getDrawCalls() const
+{
+  size_t total = 0;
+  for(const auto& [name, count] : calls)
+  {
+    if(name.rfind("glDraw", 0) == 0 || name.rfind("glMultiDraw", 0) == 0)
+      total += count;
+  }
+  return total;
+}
+
+Statistics getStatistics()
+{
+  const auto& state = getState();
+
+  Statistics statistics;
+  for(const auto& [name, count] : state.calls)
+    statistics.calls.emplace(std::string{name}, count);
+  statistics.uploadedBufferBytes = state.uploadedBufferBytes;
+  for(const auto& [handle, buffer] : state.buffers)
+    statistics.bufferBytes += buffer.size();
+  for(const auto& [handle, texture] : state.textures)
+    statistics.textureTexels += static_cast<size_t>(texture.width) * texture.height * std::max(texture.depth, 1);
+  statistics.programs = state.programs.size();
+  return statistics;
+}
+
+void resetCallStatistics()
+{
+  getState().calls.clear();
+  getState().uploadedBufferBytes = 0;
+}
+} // namespace gl::null
+
+using gl::null::detail::recordCall;
+using gl::null::getState;
+
+void glCreateBuffers(const GLsizei n, GLuint* buffers)
+{
+  recordCall("glCreateBuffers");
+  getState().createHandles(n, buffers);
+  for(GLsizei i = 0; i < n; ++i)
+    getState().buffers[buffers[i]];
+}
+
+void glCreateFramebuffers(const GLsizei n, GLuint* framebuffers)
+{
+  recordCall("glCreateFramebuffers");
+  getState().createHandles(n, framebuffers);
+}
+
+GLuint glCreateProgram()
+{
+  recordCall("glCreateProgram");
+  const auto handle = getState().createHandle();
+  getState().programs[handle];
+  return handle;
+}
+
+void glCreateQueries(const GLenum /*target*/, const GLsizei n, GLuint* ids)
+{
+  recordCall("glCreateQueries");
+  getState().createHandles(n, ids);
+}
+
+void glCreateRenderbuffers(const GLsizei n, GLuint* renderbuffers)
+{
+  recordCall("glCreateRenderbuffers");
+  getState().createHandles(n, renderbuffers);
+}
+
+void glCreateSamplers(const GLsizei n, GLuint* samplers)
+{
+  recordCall("glCreateSamplers");
+  getState().createHandles(n, samplers);
+}
+
+GLuint glCreateShader(const GLenum type)
+{
+  recordCall("glCreateShader");
+  const auto handle = getState().createHandle();
+  getState().shaders[handle].type = type;
+  return handle;
+}
+
+void glCreateTextures(const GLenum /*target*/, const GLsizei n, GLuint* textures)
+{
+  recordCall("glCreateTextures");
+  getState().createHandles(n, textures);
+  for(GLsizei i = 0; i < n; ++i)
+    getState().textures[textures[i]];
+}
+
+void glCreateVertexArrays(const GLsizei n, GLuint* arrays)
+{
+  recordCall("glCreateVertexArrays");
+  getState().createHandles(n, arrays);
+}
+
+void glDeleteBuffers(const GLsizei n, const GLuint* buffers)
+{
+  recordCall("glDeleteBuffers");
+  for(GLsizei i = 0; i < n; ++i)
+    getState().buffers.erase(buffers[i]);
+}
+
+void glDeleteProgram(const GLuint program)
+{
+  recordCall("glDeleteProgram");
+  getState().programs.erase(program);
+}
+
+void glDeleteShader(const GLuint shader)
+{
+  recordCall("glDeleteShader");
+  getState().shaders.erase(shader);
+}
+
+void glDeleteTextures(const GLsizei n, const GLuint* textures)
+{
+  recordCall("glDeleteTextures");
+  for(GLsizei i = 0; i < n; ++i)
+    getState().textures.erase(textures[i]);
+}
+
+void glGenBuffers(const GLsizei n, GLuint* buffers)
+{
+  recordCall("glGenBuffers");
+  getState().createHandles(n, buffers);
+  for(GLsizei i = 0; i < n; ++i)
+    getState().buffers[buffers[i]];
+}
+
+void glGenFramebuffers(const GLsizei n, GLuint* framebuffers)
+{
+  recordCall("glGenFramebuffers");
+  getState().createHandles(n, framebuffers);
+}
+
+void glGenQueries(const GLsizei n, GLuint* ids)
+{
+  recordCall("glGenQueries");
+  getState().createHandles(n, ids);
+}
+
+void glGenRenderbuffers(const GLsizei n, GLuint* renderbuffers)
+{
+  recordCall("glGenRenderbuffers");
+  getState().createHandles(n, renderbuffers);
+}
+
+void glGenSamplers(const GLsizei n, GLuint* samplers)
+{
+  recordCall("glGenSamplers");
+  getState().createHandles(n, samplers);
+}
+
+void glGenTextures(const GLsizei n, GLuint* textures)
+{
+  recordCall("glGenTextures");
+  getState().createHandles(n, textures);
+  for(GLsizei i = 0; i < n; ++i)
+    getState().textures[textures[i]];
+}
+
+void glGenVertexArrays(const GLsizei n, GLuint* arrays)
+{
+  recordCall("glGenVertexArrays");
+  getState().createHandles(n, arrays);
+}
+
+void* glMapNamedBuffer(const GLuint buffer, const GLenum /*access*/)
+{
+  recordCall("glMapNamedBuffer");
+  auto& data = getState().buffers[buffer];
+  return data.empty() ? nullptr : data.data();
+}
+
+void* glMapNamedBufferRange(const GLuint buffer,
+                            const GLintptr offset,
+                            const GLsizeiptr length,
+                            const GLbitfield /*access*/)
+{
+  recordCall("glMapNamedBufferRange");
+  auto& data = getState().buffers[buffer];
+  if(offset < 0 || length <= 0 || static_cast<size_t>(offset + length) > data.size())
+    return nullptr;
+  return data.data() + offset;
+}
+
+void glNamedBufferData(const GLuint buffer, const GLsizeiptr size, const void* data, const GLenum /*usage*/)
+{
+  recordCall("glNamedBufferData");
+  auto& store = getState().buffers[buffer];
+  store.clear();
+  gl::null::upload(store, 0, static_cast<size_t>(size), data);
+}
+
+void glNamedBufferStorage(const GLuint buffer, const GLsizeiptr size, const void* data, const GLbitfield /*flags*/)
+{
+  recordCall("glNamedBufferStorage");
+  auto& store = getState().buffers[buffer];
+  store.clear();
+  gl::null::upload(store, 0, static_cast<size_t>(size), data);
+}
+
+void glNamedBufferSubData(const GLuint buffer, const GLintptr offset, const GLsizeiptr size, const void* data)
+{
+  recordCall("glNamedBufferSubData");
+  gl::null::upload(getState().buffers[buffer], static_cast<size_t>(offset), static_cast<size_t>(size), data);
+}
+
+GLboolean glUnmapNamedBuffer(const GLuint /*buffer*/)
+{
+  recordCall("glUnmapNamedBuffer");
+  return gl::null::True;
+}
+
+void glGetTextureParameteriv(const GLuint texture, const GLenum pname, GLint* params)
+{
+  recordCall("glGetTextureParameteriv");
+  const auto& state = getState().textures[texture];
+  switch(pname)
+  {
+  case gl::null::TextureWidth: *params = state.width; break;
+  case gl::null::TextureHeight: *params = state.height; break;
+  case gl::null::TextureDepth: *params = state.depth; break;
+  default: *params = 0; break;
+  }
+}
+
+void glTextureStorage2D(const GLuint texture,
+                        const GLsizei /*levels*/,
+                        const GLenum /*internalformat*/,
+                        const GLsizei width,
+                        const GLsizei height)
+{
+  recordCall("glTextureStorage2D");
+  getState().textures[texture] = gl::null::TextureState{width, height, 1};
+}
+
+void glTextureStorage3D(const GLuint texture,
+                        const GLsizei /*levels*/,
+                        const GLenum /*internalformat*/,
+                        const GLsizei width,
+                        const GLsizei height,
+                        const GLsizei depth)
+{
+  recordCall("glTextureStorage3D");
+  getState().textures[texture] = gl::null::TextureState{width, height, depth};
+}
+
+void glAttachShader(const GLuint program, const GLuint shader)
+{
+  recordCall("glAttachShader");
+  getState().programs[program].shaders.emplace_back(shader);
+}
+
+void glGetActiveUniformsiv(const GLuint program,
+                           const GLsizei uniformCount,
+                           const GLuint* uniformIndices,
+                           const GLenum pname,
+                           GLint* params)
+{
+  recordCall("glGetActiveUniformsiv");
+  for(GLsizei i = 0; i < uniformCount; ++i)
+  {
+    const auto resource = gl::null::findResource(program, gl::null::Uniform, uniformIndices[i]);
+    if(resource == nullptr)
+    {
+      params[i] = 0;
+      continue;
+    }
+
+    switch(pname)
+    {
+    case gl::null::UniformType: params[i] = resource->type; break;
+    case gl::null::UniformSize: params[i] = resource->arraySize; break;
+    case gl::null::UniformNameLength: params[i] = static_cast<GLint>(resource->name.size() + 1); break;
+    case gl::null::UniformBlockIndex: params[i] = -1; break;
+    default: params[i] = 0; break;
+    }
+  }
+}
+
+void glGetProgramInfoLog(const GLuint /*program*/, const GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+  recordCall("glGetProgramInfoLog");
+  gl::null::copyString({}, bufSize, length, infoLog);
+}
+
+void glGetProgramInterfaceiv(const GLuint program, const GLenum programInterface, const GLenum pname, GLint* params)
+{
+  recordCall("glGetProgramInterfaceiv");
+  const auto& resources = getState().programs[program].resources[programInterface];
+  switch(pname)
+  {
+  case gl::null::ActiveResources: *params = static_cast<GLint>(resources.size()); break;
+  case gl::null::MaxNameLength:
+    *params = 0;
+    for(const auto& resource : resources)
+      *params = std::max(*params, static_cast<GLint>(resource.name.size() + 1));
+    break;
+  default: *params = 0; break;
+  }
+}
+
+void glGetProgramiv(const GLuint /*program*/, const GLenum pname, GLint* params)
+{
+  recordCall("glGetProgramiv");
+  *params = pname == gl::null::LinkStatus || pname == gl::null::ValidateStatus ? gl::null::True : 0;
+}
+
+void glGetProgramResourceName(const GLuint program,
+                              const GLenum programInterface,
+                              const GLuint index,
+                              const GLsizei bufSize,
+                              GLsizei* length,
+                              GLchar* name)
+{
+  recordCall("glGetProgramResourceName");
+  const auto resource = gl::null::findResource(program, programInterface, index);
+  gl::null::copyString(resource == nullptr ? std::string{} : resource->name, bufSize, length, name);
+}
+
+void glGetProgramResourceiv(const GLuint program,
+                            const GLenum programInterface,
+                            const GLuint index,
+                            const GLsizei propCount,
+                            const GLenum* props,
+                            const GLsizei count,
+                            GLsizei* length,
+                            GLint* params)
+{
+  recordCall("glGetProgramResourceiv");
+  const auto resource = gl::null::findResource(program, programInterface, index);
+  const auto n = std::min(propCount, count);
+  for(GLsizei i = 0; i < n; ++i)
+  {
+    if(resource == nullptr)
+    {
+      params[i] = 0;
+      continue;
+    }
+
+    switch(props[i])
+    {
+    case gl::null::NameLength: params[i] = static_cast<GLint>(resource->name.size() + 1); break;
+    case gl::null::Type: params[i] = resource->type; break;
+    case gl::null::ArraySize: params[i] = resource->arraySize; break;
+    case gl::null::Location: params[i] = resource->location; break;
+    case gl::null::BufferBinding: params[i] = resource->binding; break;
+    case gl::null::BlockIndex: params[i] = -1; break;
+    default: params[i] = 0; break;
+    }
+  }
+  if(length != nullptr)
+    *length = std::max(n, 0);
+}
+
+void glGetShaderInfoLog(const GLuint /*shader*/, const GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+  recordCall("glGetShaderInfoLog");
+  gl::null::copyString({}, bufSize, length, infoLog);
+}
+
+void glGetShaderiv(const GLuint shader, const GLenum pname, GLint* params)
+{
+  recordCall("glGetShaderiv");
+  switch(pname)
+  {
+  case gl::null::CompileStatus: *params = gl::null::True; break;
+  case gl::null::ShaderType: *params = static_cast<GLint>(getState().shaders[shader].type); break;
+  default: *params = 0; break;
+  }
+}
+
+void glLinkProgram(const GLuint program)
+{
+  recordCall("glLinkProgram");
+  gl::null::reflect(getState().programs[program]);
+}
+
+void glShaderSource(const GLuint shader, const GLsizei count, const GLchar* const* string, const GLint* length)
+{
+  recordCall("glShaderSource");
+  auto& source = getState().shaders[shader].source;
+  source.clear();
+  for(GLsizei i = 0; i < count; ++i)
+  {
+    if(length != nullptr && length[i] >= 0)
+      source.append(string[i], static_cast<size_t>(length[i]));
+    else
+      source.append(string[i]);
+  }
+}
+
+GLenum glCheckFramebufferStatus(const GLenum /*target*/)
+{
+  recordCall("glCheckFramebufferStatus");
+  return gl::null::FramebufferComplete;
+}
+
+GLenum glCheckNamedFramebufferStatus(const GLuint /*framebuffer*/, const GLenum /*target*/)
+{
+  recordCall("glCheckNamedFramebufferStatus");
+  return gl::null::FramebufferComplete;
+}
+
+GLenum glClientWaitSync(GLsync /*sync*/, const GLbitfield /*flags*/, const GLuint64 /*timeout*/)
+{
+  recordCall("glClientWaitSync");
+  return gl::null::AlreadySignaled;
+}
+
+void glGetIntegerv(const GLenum pname, GLint* data)
+{
+  recordCall("glGetIntegerv");
+  switch(pname)
+  {
+  case gl::null::MaxLabelLength: *data = 256; break;
+  case gl::null::MaxTextureSize: *data = 16384; break;
+  default: *data = 0; break;
+  }
+}
+
+void glGetQueryObjecti64v(const GLuint /*id*/, const GLenum pname, GLint64* params)
+{
+  recordCall("glGetQueryObjecti64v");
+  gl::null::getQueryObject(pname, params);
+}
+
+void glGetQueryObjectiv(const GLuint /*id*/, const GLenum pname, GLint* params)
+{
+  recordCall("glGetQueryObjectiv");
+  gl::null::getQueryObject(pname, params);
+}
+
+void glGetQueryObjectui64v(const GLuint /*id*/, const GLenum pname, GLuint64* params)
+{
+  recordCall("glGetQueryObjectui64v");
+  gl::null::getQueryObject(pname, params);
+}
+
+void glGetQueryObjectuiv(const GLuint /*id*/, const GLenum pname, GLuint* params)
+{
+  recordCall("glGetQueryObjectuiv");
+  gl::null::getQueryObject(pname, params);
+}
+
+const GLubyte* glGetString(const GLenum name)
+{
+  recordCall("glGetString");
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto toUbyte = [](const char* str) { return reinterpret_cast<const GLubyte*>(str); };
+  switch(name)
+  {
+  case 0x1F00: return toUbyte("EdisonEngine");
+  case 0x1F01: return toUbyte("Null Renderer");
+  case 0x1F02: return toUbyte("4.5 Null");
+  case 0x8B8C: return toUbyte("4.50 Null");
+  default: return toUbyte("");
+  }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+// The OpenGL entry points of the null backend, included by api/gl.cpp instead of GLEW.
+
+#include "../api/soglb_core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+using GLenum = uint32_t;
+using GLboolean = uint8_t;
+using GLbitfield = uint32_t;
+using GLbyte = int8_t;
+using GLubyte = uint8_t;
+using GLshort = int16_t;
+using GLushort = uint16_t;
+using GLint = int32_t;
+using GLuint = uint32_t;
+using GLsizei = int32_t;
+using GLint64 = int64_t;
+using GLuint64 = uint64_t;
+using GLfloat = float;
+using GLdouble = double;
+using GLchar = char;
+using GLintptr = std::ptrdiff_t;
+using GLsizeiptr = std::ptrdiff_t;
+using GLsync = __GLsync*;
+using GLDEBUGPROC = void(SOGLB_API*)(GLenum source,
+                                     GLenum type,
+                                     GLuint id,
+                                     GLenum severity,
+                                     GLsizei length,
+                                     const GLchar* message,
+                                     const void* userParam);
+
+namespace gl::null::detail
+{
+extern void recordCall(const char* entryPoint);
+}
+
+// objects
+extern void glCreateBuffers(GLsizei n, GLuint* buffers);
+extern void glCreateFramebuffers(GLsizei n, GLuint* framebuffers);
+extern GLuint glCreateProgram();
+extern void glCreateQueries(GLenum target, GLsizei n, GLuint* ids);
+extern void glCreateRenderbuffers(GLsizei n, GLuint* renderbuffers);
+extern void glCreateSamplers(GLsizei n, GLuint* samplers);
+extern GLuint glCreateShader(GLenum type);
+extern void glCreateTextures(GLenum target, GLsizei n, GLuint* textures);
+extern void glCreateVertexArrays(GLsizei n, GLuint* arrays);
+extern void glDeleteBuffers(GLsizei n, const GLuint* buffers);
+extern void glDeleteProgram(GLuint program);
+extern void glDeleteShader(GLuint shader);
+extern void glDeleteTextures(GLsizei n, const GLuint* textures);
+extern void glGenBuffers(GLsizei n, GLuint* buffers);
+extern void glGenFramebuffers(GLsizei n, GLuint* framebuffers);
+extern void glGenQueries(GLsizei n, GLuint* ids);
+extern void glGenRenderbuffers(GLsizei n, GLuint* renderbuffers);
+extern void glGenSamplers(GLsizei n, GLuint* samplers);
+extern void glGenTextures(GLsizei n, GLuint* textures);
+extern void glGenVertexArrays(GLsizei n, GLuint* arrays);
+
+// buffers
+extern void* glMapNamedBuffer(GLuint buffer, GLenum access);
+extern void* glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+extern void glNamedBufferData(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage);
+extern void glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags);
+extern void glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+extern GLboolean glUnmapNamedBuffer(GLuint buffer);
+
+// textures
+extern void glGetTextureParameteriv(GLuint texture, GLenum pname, GLint* params);
+extern void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+extern void glTextureStorage3D(
+  GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
+
+// shaders and programs
+extern void glAttachShader(GLuint program, GLuint shader);
+extern void glGetActiveUniformsiv(
+  GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params);
+extern void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+extern void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint* params);
+extern void glGetProgramiv(GLuint program, GLenum pname, GLint* params);
+extern void glGetProgramResourceName(
+  GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name);
+extern void glGetProgramResourceiv(GLuint program,
+                                   GLenum programInterface,
+                                   GLuint index,
+                                   GLsizei propCount,
+                                   const GLenum* props,
+                                   GLsizei count,
+                                   GLsizei* length,
+                                   GLint* params);
+extern void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+extern void glGetShaderiv(GLuint shader, GLenum pname, GLint* params);
+extern void glLinkProgram(GLuint program);
+extern void glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+
+// queries and state
+extern GLenum glCheckFramebufferStatus(GLenum target);
+extern GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target);
+extern GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+extern void glGetIntegerv(GLenum pname, GLint* data);
+extern void glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64* params);
+extern void glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params);
+extern void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params);
+extern void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params);
+extern const GLubyte* glGetString(GLenum name);
+
+// all other entry points only count their calls and return a value-initialized result
+#define SOGLB_NULL_STUB(ResultType, name)                \
+  template<typename... Args>                             \
+  inline ResultType name(const Args&... /*args*/)        \
+  {                                                      \
+    using Result = ResultType;                           \
+    ::gl::null::detail::recordCall(#name);               \
+    return Result();                                     \
+  }
+
+#include "nullgl_stubs.inl"
+
+#undef SOGLB_NULL_STUB
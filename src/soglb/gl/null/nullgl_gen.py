@@ -0,0 +1,127 @@
+"""Generates the stubs of the null OpenGL backend from the generated bindings in api/gl.cpp.
+
+Every OpenGL entry point called by the bindings gets a stub that only counts its calls. Entry points that need a
+behaviour, e.g. creating objects or reporting a successful compilation, are implemented in nullgl.cpp and are listed
+in IMPLEMENTED.
+"""
+
+import logging
+import os
+import re
+from typing import Dict
+
+logging.basicConfig(level=logging.INFO)
+
+BINDINGS_NAME = os.path.join("..", "api", "gl.cpp")
+STUBS_NAME = "nullgl_stubs.inl"
+
+IMPLEMENTED = {
+    'glAttachShader',
+    'glCheckFramebufferStatus',
+    'glCheckNamedFramebufferStatus',
+    'glClientWaitSync',
+    'glCreateBuffers',
+    'glCreateFramebuffers',
+    'glCreateProgram',
+    'glCreateQueries',
+    'glCreateRenderbuffers',
+    'glCreateSamplers',
+    'glCreateShader',
+    'glCreateTextures',
+    'glCreateVertexArrays',
+    'glDeleteBuffers',
+    'glDeleteProgram',
+    'glDeleteShader',
+    'glDeleteTextures',
+    'glGenBuffers',
+    'glGenFramebuffers',
+    'glGenQueries',
+    'glGenRenderbuffers',
+    'glGenSamplers',
+    'glGenTextures',
+    'glGenVertexArrays',
+    'glGetActiveUniformsiv',
+    'glGetIntegerv',
+    'glGetProgramInfoLog',
+    'glGetProgramInterfaceiv',
+    'glGetProgramiv',
+    'glGetProgramResourceName',
+    'glGetProgramResourceiv',
+    'glGetQueryObjecti64v',
+    'glGetQueryObjectiv',
+    'glGetQueryObjectui64v',
+    'glGetQueryObjectuiv',
+    'glGetShaderInfoLog',
+    'glGetShaderiv',
+    'glGetString',
+    'glGetTextureParameteriv',
+    'glLinkProgram',
+    'glMapNamedBuffer',
+    'glMapNamedBufferRange',
+    'glNamedBufferData',
+    'glNamedBufferStorage',
+    'glNamedBufferSubData',
+    'glShaderSource',
+    'glTextureStorage2D',
+    'glTextureStorage3D',
+    'glUnmapNamedBuffer',
+}
+
+RESULT_TYPES = {
+    'bool': 'GLboolean',
+    'uint32_t': 'GLuint',
+    'int32_t': 'GLint',
+    'const uint8_t*': 'const GLubyte*',
+    'core::Sync': 'GLsync',
+}
+
+WRAPPER_RE = re.compile(r'^([\w:*<> ]+?)\s*\b\w+\([^{;]*\)\s*\{\s*return\s+(.*?);\s*\}', re.MULTILINE | re.DOTALL)
+CALL_RE = re.compile(r'\b(gl[A-Z]\w*)\s*\(')
+CAST_RE = re.compile(r'^static_cast<([^>]+)>\(\s*gl[A-Z]')
+
+
+def get_result_type(wrapper_result: str, body: str) -> str:
+    if wrapper_result == 'void':
+        return 'void'
+
+    cast = CAST_RE.match(body)
+    if cast is None:
+        # the entry point's result is returned unchanged
+        return wrapper_result
+
+    target = cast.group(1).strip()
+    if target in RESULT_TYPES:
+        return RESULT_TYPES[target]
+    # all other casts convert to one of the generated enum classes
+    return 'GLenum'
+
+
+def main():
+    with open(BINDINGS_NAME) as f:
+        bindings = f.read()
+
+    result_types: Dict[str, str] = {}
+    for wrapper in WRAPPER_RE.finditer(bindings):
+        body = ' '.join(wrapper.group(2).split())
+        entry_point = CALL_RE.search(body)
+        if entry_point is None:
+            continue
+
+        name = entry_point.group(1)
+        result_type = get_result_type(' '.join(wrapper.group(1).split()), body)
+        if result_types.setdefault(name, result_type) != result_type:
+            raise RuntimeError('Conflicting result types for {}'.format(name))
+
+    logging.info('Found {} entry points, {} are implemented'.format(len(result_types), len(IMPLEMENTED)))
+    missing = IMPLEMENTED - result_types.keys()
+    if missing:
+        raise RuntimeError('Implemented entry points are not used: {}'.format(', '.join(sorted(missing))))
+
+    with open(STUBS_NAME, 'w') as f:
+        f.write('// generated by nullgl_gen.py, do not edit\n\n')
+        for name in sorted(result_types.keys() - IMPLEMENTED):
+            f.write('SOGLB_NULL_STUB({}, {})\n'.format(result_types[name], name))
+
+
+if __name__ == '__main__':
+    main()
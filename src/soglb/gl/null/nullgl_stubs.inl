@@ -0,0 +1,998 @@
+// generated by nullgl_gen.py, do not edit
+
+SOGLB_NULL_STUB(void, glAccum)
+SOGLB_NULL_STUB(void, glActiveShaderProgram)
+SOGLB_NULL_STUB(void, glActiveTexture)
+SOGLB_NULL_STUB(void, glAlphaFunc)
+SOGLB_NULL_STUB(GLboolean, glAreTexturesResident)
+SOGLB_NULL_STUB(void, glArrayElement)
+SOGLB_NULL_STUB(void, glBegin)
+SOGLB_NULL_STUB(void, glBeginConditionalRender)
+SOGLB_NULL_STUB(void, glBeginQuery)
+SOGLB_NULL_STUB(void, glBeginQueryIndexed)
+SOGLB_NULL_STUB(void, glBeginTransformFeedback)
+SOGLB_NULL_STUB(void, glBindAttribLocation)
+SOGLB_NULL_STUB(void, glBindBuffer)
+SOGLB_NULL_STUB(void, glBindBufferBase)
+SOGLB_NULL_STUB(void, glBindBufferRange)
+SOGLB_NULL_STUB(void, glBindBuffersBase)
+SOGLB_NULL_STUB(void, glBindBuffersRange)
+SOGLB_NULL_STUB(void, glBindFragDataLocation)
+SOGLB_NULL_STUB(void, glBindFragDataLocationIndexed)
+SOGLB_NULL_STUB(void, glBindFramebuffer)
+SOGLB_NULL_STUB(void, glBindImageTexture)
+SOGLB_NULL_STUB(void, glBindImageTextures)
+SOGLB_NULL_STUB(void, glBindProgramPipeline)
+SOGLB_NULL_STUB(void, glBindRenderbuffer)
+SOGLB_NULL_STUB(void, glBindSampler)
+SOGLB_NULL_STUB(void, glBindSamplers)
+SOGLB_NULL_STUB(void, glBindTexture)
+SOGLB_NULL_STUB(void, glBindTextureUnit)
+SOGLB_NULL_STUB(void, glBindTextures)
+SOGLB_NULL_STUB(void, glBindTransformFeedback)
+SOGLB_NULL_STUB(void, glBindVertexArray)
+SOGLB_NULL_STUB(void, glBindVertexBuffer)
+SOGLB_NULL_STUB(void, glBindVertexBuffers)
+SOGLB_NULL_STUB(void, glBitmap)
+SOGLB_NULL_STUB(void, glBlendColor)
+SOGLB_NULL_STUB(void, glBlendEquation)
+SOGLB_NULL_STUB(void, glBlendEquationSeparate)
+SOGLB_NULL_STUB(void, glBlendEquationSeparatei)
+SOGLB_NULL_STUB(void, glBlendEquationi)
+SOGLB_NULL_STUB(void, glBlendFunc)
+SOGLB_NULL_STUB(void, glBlendFuncSeparate)
+SOGLB_NULL_STUB(void, glBlendFuncSeparatei)
+SOGLB_NULL_STUB(void, glBlendFunci)
+SOGLB_NULL_STUB(void, glBlitFramebuffer)
+SOGLB_NULL_STUB(void, glBlitNamedFramebuffer)
+SOGLB_NULL_STUB(void, glBufferData)
+SOGLB_NULL_STUB(void, glBufferStorage)
+SOGLB_NULL_STUB(void, glBufferSubData)
+SOGLB_NULL_STUB(void, glCallList)
+SOGLB_NULL_STUB(void, glCallLists)
+SOGLB_NULL_STUB(void, glClampColor)
+SOGLB_NULL_STUB(void, glClear)
+SOGLB_NULL_STUB(void, glClearAccum)
+SOGLB_NULL_STUB(void, glClearBufferData)
+SOGLB_NULL_STUB(void, glClearBufferSubData)
+SOGLB_NULL_STUB(void, glClearBufferfi)
+SOGLB_NULL_STUB(void, glClearBufferfv)
+SOGLB_NULL_STUB(void, glClearBufferiv)
+SOGLB_NULL_STUB(void, glClearBufferuiv)
+SOGLB_NULL_STUB(void, glClearColor)
+SOGLB_NULL_STUB(void, glClearDepth)
+SOGLB_NULL_STUB(void, glClearDepthf)
+SOGLB_NULL_STUB(void, glClearIndex)
+SOGLB_NULL_STUB(void, glClearNamedBufferData)
+SOGLB_NULL_STUB(void, glClearNamedBufferSubData)
+SOGLB_NULL_STUB(void, glClearNamedFramebufferfi)
+SOGLB_NULL_STUB(void, glClearNamedFramebufferfv)
+SOGLB_NULL_STUB(void, glClearNamedFramebufferiv)
+SOGLB_NULL_STUB(void, glClearNamedFramebufferuiv)
+SOGLB_NULL_STUB(void, glClearStencil)
+SOGLB_NULL_STUB(void, glClearTexImage)
+SOGLB_NULL_STUB(void, glClearTexSubImage)
+SOGLB_NULL_STUB(void, glClientActiveTexture)
+SOGLB_NULL_STUB(void, glClipControl)
+SOGLB_NULL_STUB(void, glClipPlane)
+SOGLB_NULL_STUB(void, glColor3b)
+SOGLB_NULL_STUB(void, glColor3bv)
+SOGLB_NULL_STUB(void, glColor3d)
+SOGLB_NULL_STUB(void, glColor3dv)
+SOGLB_NULL_STUB(void, glColor3f)
+SOGLB_NULL_STUB(void, glColor3fv)
+SOGLB_NULL_STUB(void, glColor3i)
+SOGLB_NULL_STUB(void, glColor3iv)
+SOGLB_NULL_STUB(void, glColor3s)
+SOGLB_NULL_STUB(void, glColor3sv)
+SOGLB_NULL_STUB(void, glColor3ub)
+SOGLB_NULL_STUB(void, glColor3ubv)
+SOGLB_NULL_STUB(void, glColor3ui)
+SOGLB_NULL_STUB(void, glColor3uiv)
+SOGLB_NULL_STUB(void, glColor3us)
+SOGLB_NULL_STUB(void, glColor3usv)
+SOGLB_NULL_STUB(void, glColor4b)
+SOGLB_NULL_STUB(void, glColor4bv)
+SOGLB_NULL_STUB(void, glColor4d)
+SOGLB_NULL_STUB(void, glColor4dv)
+SOGLB_NULL_STUB(void, glColor4f)
+SOGLB_NULL_STUB(void, glColor4fv)
+SOGLB_NULL_STUB(void, glColor4i)
+SOGLB_NULL_STUB(void, glColor4iv)
+SOGLB_NULL_STUB(void, glColor4s)
+SOGLB_NULL_STUB(void, glColor4sv)
+SOGLB_NULL_STUB(void, glColor4ub)
+SOGLB_NULL_STUB(void, glColor4ubv)
+SOGLB_NULL_STUB(void, glColor4ui)
+SOGLB_NULL_STUB(void, glColor4uiv)
+SOGLB_NULL_STUB(void, glColor4us)
+SOGLB_NULL_STUB(void, glColor4usv)
+SOGLB_NULL_STUB(void, glColorMask)
+SOGLB_NULL_STUB(void, glColorMaski)
+SOGLB_NULL_STUB(void, glColorMaterial)
+SOGLB_NULL_STUB(void, glColorP3ui)
+SOGLB_NULL_STUB(void, glColorP3uiv)
+SOGLB_NULL_STUB(void, glColorP4ui)
+SOGLB_NULL_STUB(void, glColorP4uiv)
+SOGLB_NULL_STUB(void, glColorPointer)
+SOGLB_NULL_STUB(void, glCompileShader)
+SOGLB_NULL_STUB(void, glCompressedTexImage1D)
+SOGLB_NULL_STUB(void, glCompressedTexImage2D)
+SOGLB_NULL_STUB(void, glCompressedTexImage3D)
+SOGLB_NULL_STUB(void, glCompressedTexSubImage1D)
+SOGLB_NULL_STUB(void, glCompressedTexSubImage2D)
+SOGLB_NULL_STUB(void, glCompressedTexSubImage3D)
+SOGLB_NULL_STUB(void, glCompressedTextureSubImage1D)
+SOGLB_NULL_STUB(void, glCompressedTextureSubImage2D)
+SOGLB_NULL_STUB(void, glCompressedTextureSubImage3D)
+SOGLB_NULL_STUB(void, glCopyBufferSubData)
+SOGLB_NULL_STUB(void, glCopyImageSubData)
+SOGLB_NULL_STUB(void, glCopyNamedBufferSubData)
+SOGLB_NULL_STUB(void, glCopyPixels)
+SOGLB_NULL_STUB(void, glCopyTexImage1D)
+SOGLB_NULL_STUB(void, glCopyTexImage2D)
+SOGLB_NULL_STUB(void, glCopyTexSubImage1D)
+SOGLB_NULL_STUB(void, glCopyTexSubImage2D)
+SOGLB_NULL_STUB(void, glCopyTexSubImage3D)
+SOGLB_NULL_STUB(void, glCopyTextureSubImage1D)
+SOGLB_NULL_STUB(void, glCopyTextureSubImage2D)
+SOGLB_NULL_STUB(void, glCopyTextureSubImage3D)
+SOGLB_NULL_STUB(void, glCreateProgramPipelines)
+SOGLB_NULL_STUB(GLuint, glCreateShaderProgramv)
+SOGLB_NULL_STUB(void, glCreateTransformFeedbacks)
+SOGLB_NULL_STUB(void, glCullFace)
+SOGLB_NULL_STUB(void, glDebugMessageCallback)
+SOGLB_NULL_STUB(void, glDebugMessageControl)
+SOGLB_NULL_STUB(void, glDebugMessageInsert)
+SOGLB_NULL_STUB(void, glDeleteFramebuffers)
+SOGLB_NULL_STUB(void, glDeleteLists)
+SOGLB_NULL_STUB(void, glDeleteProgramPipelines)
+SOGLB_NULL_STUB(void, glDeleteQueries)
+SOGLB_NULL_STUB(void, glDeleteRenderbuffers)
+SOGLB_NULL_STUB(void, glDeleteSamplers)
+SOGLB_NULL_STUB(void, glDeleteSync)
+SOGLB_NULL_STUB(void, glDeleteTransformFeedbacks)
+SOGLB_NULL_STUB(void, glDeleteVertexArrays)
+SOGLB_NULL_STUB(void, glDepthFunc)
+SOGLB_NULL_STUB(void, glDepthMask)
+SOGLB_NULL_STUB(void, glDepthRange)
+SOGLB_NULL_STUB(void, glDepthRangeArrayv)
+SOGLB_NULL_STUB(void, glDepthRangeIndexed)
+SOGLB_NULL_STUB(void, glDepthRangef)
+SOGLB_NULL_STUB(void, glDetachShader)
+SOGLB_NULL_STUB(void, glDisable)
+SOGLB_NULL_STUB(void, glDisableClientState)
+SOGLB_NULL_STUB(void, glDisableVertexArrayAttrib)
+SOGLB_NULL_STUB(void, glDisableVertexAttribArray)
+SOGLB_NULL_STUB(void, glDisablei)
+SOGLB_NULL_STUB(void, glDispatchCompute)
+SOGLB_NULL_STUB(void, glDispatchComputeIndirect)
+SOGLB_NULL_STUB(void, glDrawArrays)
+SOGLB_NULL_STUB(void, glDrawArraysIndirect)
+SOGLB_NULL_STUB(void, glDrawArraysInstanced)
+SOGLB_NULL_STUB(void, glDrawArraysInstancedBaseInstance)
+SOGLB_NULL_STUB(void, glDrawBuffer)
+SOGLB_NULL_STUB(void, glDrawBuffers)
+SOGLB_NULL_STUB(void, glDrawElements)
+SOGLB_NULL_STUB(void, glDrawElementsBaseVertex)
+SOGLB_NULL_STUB(void, glDrawElementsIndirect)
+SOGLB_NULL_STUB(void, glDrawElementsInstanced)
+SOGLB_NULL_STUB(void, glDrawElementsInstancedBaseInstance)
+SOGLB_NULL_STUB(void, glDrawElementsInstancedBaseVertex)
+SOGLB_NULL_STUB(void, glDrawElementsInstancedBaseVertexBaseInstance)
+SOGLB_NULL_STUB(void, glDrawPixels)
+SOGLB_NULL_STUB(void, glDrawRangeElements)
+SOGLB_NULL_STUB(void, glDrawRangeElementsBaseVertex)
+SOGLB_NULL_STUB(void, glDrawTransformFeedback)
+SOGLB_NULL_STUB(void, glDrawTransformFeedbackInstanced)
+SOGLB_NULL_STUB(void, glDrawTransformFeedbackStream)
+SOGLB_NULL_STUB(void, glDrawTransformFeedbackStreamInstanced)
+SOGLB_NULL_STUB(void, glEdgeFlag)
+SOGLB_NULL_STUB(void, glEdgeFlagPointer)
+SOGLB_NULL_STUB(void, glEdgeFlagv)
+SOGLB_NULL_STUB(void, glEnable)
+SOGLB_NULL_STUB(void, glEnableClientState)
+SOGLB_NULL_STUB(void, glEnableVertexArrayAttrib)
+SOGLB_NULL_STUB(void, glEnableVertexAttribArray)
+SOGLB_NULL_STUB(void, glEnablei)
+SOGLB_NULL_STUB(void, glEnd)
+SOGLB_NULL_STUB(void, glEndConditionalRender)
+SOGLB_NULL_STUB(void, glEndList)
+SOGLB_NULL_STUB(void, glEndQuery)
+SOGLB_NULL_STUB(void, glEndQueryIndexed)
+SOGLB_NULL_STUB(void, glEndTransformFeedback)
+SOGLB_NULL_STUB(void, glEvalCoord1d)
+SOGLB_NULL_STUB(void, glEvalCoord1dv)
+SOGLB_NULL_STUB(void, glEvalCoord1f)
+SOGLB_NULL_STUB(void, glEvalCoord1fv)
+SOGLB_NULL_STUB(void, glEvalCoord2d)
+SOGLB_NULL_STUB(void, glEvalCoord2dv)
+SOGLB_NULL_STUB(void, glEvalCoord2f)
+SOGLB_NULL_STUB(void, glEvalCoord2fv)
+SOGLB_NULL_STUB(void, glEvalMesh1)
+SOGLB_NULL_STUB(void, glEvalMesh2)
+SOGLB_NULL_STUB(void, glEvalPoint1)
+SOGLB_NULL_STUB(void, glEvalPoint2)
+SOGLB_NULL_STUB(void, glFeedbackBuffer)
+SOGLB_NULL_STUB(void, glFinish)
+SOGLB_NULL_STUB(void, glFlush)
+SOGLB_NULL_STUB(void, glFlushMappedBufferRange)
+SOGLB_NULL_STUB(void, glFlushMappedNamedBufferRange)
+SOGLB_NULL_STUB(void, glFogCoordPointer)
+SOGLB_NULL_STUB(void, glFogCoordd)
+SOGLB_NULL_STUB(void, glFogCoorddv)
+SOGLB_NULL_STUB(void, glFogCoordf)
+SOGLB_NULL_STUB(void, glFogCoordfv)
+SOGLB_NULL_STUB(void, glFogf)
+SOGLB_NULL_STUB(void, glFogfv)
+SOGLB_NULL_STUB(void, glFogi)
+SOGLB_NULL_STUB(void, glFogiv)
+SOGLB_NULL_STUB(void, glFramebufferParameteri)
+SOGLB_NULL_STUB(void, glFramebufferRenderbuffer)
+SOGLB_NULL_STUB(void, glFramebufferTexture)
+SOGLB_NULL_STUB(void, glFramebufferTexture1D)
+SOGLB_NULL_STUB(void, glFramebufferTexture2D)
+SOGLB_NULL_STUB(void, glFramebufferTexture3D)
+SOGLB_NULL_STUB(void, glFramebufferTextureLayer)
+SOGLB_NULL_STUB(void, glFrontFace)
+SOGLB_NULL_STUB(void, glFrustum)
+SOGLB_NULL_STUB(GLuint, glGenLists)
+SOGLB_NULL_STUB(void, glGenProgramPipelines)
+SOGLB_NULL_STUB(void, glGenTransformFeedbacks)
+SOGLB_NULL_STUB(void, glGenerateMipmap)
+SOGLB_NULL_STUB(void, glGenerateTextureMipmap)
+SOGLB_NULL_STUB(void, glGetActiveAtomicCounterBufferiv)
+SOGLB_NULL_STUB(void, glGetActiveAttrib)
+SOGLB_NULL_STUB(void, glGetActiveSubroutineName)
+SOGLB_NULL_STUB(void, glGetActiveSubroutineUniformName)
+SOGLB_NULL_STUB(void, glGetActiveSubroutineUniformiv)
+SOGLB_NULL_STUB(void, glGetActiveUniform)
+SOGLB_NULL_STUB(void, glGetActiveUniformBlockName)
+SOGLB_NULL_STUB(void, glGetActiveUniformBlockiv)
+SOGLB_NULL_STUB(void, glGetActiveUniformName)
+SOGLB_NULL_STUB(void, glGetAttachedShaders)
+SOGLB_NULL_STUB(GLint, glGetAttribLocation)
+SOGLB_NULL_STUB(void, glGetBooleani_v)
+SOGLB_NULL_STUB(void, glGetBooleanv)
+SOGLB_NULL_STUB(void, glGetBufferParameteri64v)
+SOGLB_NULL_STUB(void, glGetBufferParameteriv)
+SOGLB_NULL_STUB(void, glGetBufferPointerv)
+SOGLB_NULL_STUB(void, glGetBufferSubData)
+SOGLB_NULL_STUB(void, glGetClipPlane)
+SOGLB_NULL_STUB(void, glGetCompressedTexImage)
+SOGLB_NULL_STUB(void, glGetCompressedTextureImage)
+SOGLB_NULL_STUB(void, glGetCompressedTextureSubImage)
+SOGLB_NULL_STUB(GLuint, glGetDebugMessageLog)
+SOGLB_NULL_STUB(void, glGetDoublei_v)
+SOGLB_NULL_STUB(void, glGetDoublev)
+SOGLB_NULL_STUB(GLenum, glGetError)
+SOGLB_NULL_STUB(void, glGetFloati_v)
+SOGLB_NULL_STUB(void, glGetFloatv)
+SOGLB_NULL_STUB(GLint, glGetFragDataIndex)
+SOGLB_NULL_STUB(GLint, glGetFragDataLocation)
+SOGLB_NULL_STUB(void, glGetFramebufferAttachmentParameteriv)
+SOGLB_NULL_STUB(void, glGetFramebufferParameteriv)
+SOGLB_NULL_STUB(GLenum, glGetGraphicsResetStatus)
+SOGLB_NULL_STUB(void, glGetInteger64i_v)
+SOGLB_NULL_STUB(void, glGetInteger64v)
+SOGLB_NULL_STUB(void, glGetIntegeri_v)
+SOGLB_NULL_STUB(void, glGetInternalformati64v)
+SOGLB_NULL_STUB(void, glGetInternalformativ)
+SOGLB_NULL_STUB(void, glGetLightfv)
+SOGLB_NULL_STUB(void, glGetLightiv)
+SOGLB_NULL_STUB(void, glGetMapdv)
+SOGLB_NULL_STUB(void, glGetMapfv)
+SOGLB_NULL_STUB(void, glGetMapiv)
+SOGLB_NULL_STUB(void, glGetMaterialfv)
+SOGLB_NULL_STUB(void, glGetMaterialiv)
+SOGLB_NULL_STUB(void, glGetMultisamplefv)
+SOGLB_NULL_STUB(void, glGetNamedBufferParameteri64v)
+SOGLB_NULL_STUB(void, glGetNamedBufferParameteriv)
+SOGLB_NULL_STUB(void, glGetNamedBufferPointerv)
+SOGLB_NULL_STUB(void, glGetNamedBufferSubData)
+SOGLB_NULL_STUB(void, glGetNamedFramebufferAttachmentParameteriv)
+SOGLB_NULL_STUB(void, glGetNamedFramebufferParameteriv)
+SOGLB_NULL_STUB(void, glGetNamedRenderbufferParameteriv)
+SOGLB_NULL_STUB(void, glGetObjectLabel)
+SOGLB_NULL_STUB(void, glGetObjectPtrLabel)
+SOGLB_NULL_STUB(void, glGetPixelMapfv)
+SOGLB_NULL_STUB(void, glGetPixelMapuiv)
+SOGLB_NULL_STUB(void, glGetPixelMapusv)
+SOGLB_NULL_STUB(void, glGetPointerv)
+SOGLB_NULL_STUB(void, glGetPolygonStipple)
+SOGLB_NULL_STUB(void, glGetProgramBinary)
+SOGLB_NULL_STUB(void, glGetProgramPipelineInfoLog)
+SOGLB_NULL_STUB(void, glGetProgramPipelineiv)
+SOGLB_NULL_STUB(GLuint, glGetProgramResourceIndex)
+SOGLB_NULL_STUB(GLint, glGetProgramResourceLocation)
+SOGLB_NULL_STUB(GLint, glGetProgramResourceLocationIndex)
+SOGLB_NULL_STUB(void, glGetProgramStageiv)
+SOGLB_NULL_STUB(void, glGetQueryBufferObjecti64v)
+SOGLB_NULL_STUB(void, glGetQueryBufferObjectiv)
+SOGLB_NULL_STUB(void, glGetQueryBufferObjectui64v)
+SOGLB_NULL_STUB(void, glGetQueryBufferObjectuiv)
+SOGLB_NULL_STUB(void, glGetQueryIndexediv)
+SOGLB_NULL_STUB(void, glGetQueryiv)
+SOGLB_NULL_STUB(void, glGetRenderbufferParameteriv)
+SOGLB_NULL_STUB(void, glGetSamplerParameterIiv)
+SOGLB_NULL_STUB(void, glGetSamplerParameterIuiv)
+SOGLB_NULL_STUB(void, glGetSamplerParameterfv)
+SOGLB_NULL_STUB(void, glGetSamplerParameteriv)
+SOGLB_NULL_STUB(void, glGetShaderPrecisionFormat)
+SOGLB_NULL_STUB(void, glGetShaderSource)
+SOGLB_NULL_STUB(const GLubyte*, glGetStringi)
+SOGLB_NULL_STUB(GLuint, glGetSubroutineIndex)
+SOGLB_NULL_STUB(GLint, glGetSubroutineUniformLocation)
+SOGLB_NULL_STUB(void, glGetSynciv)
+SOGLB_NULL_STUB(void, glGetTexEnvfv)
+SOGLB_NULL_STUB(void, glGetTexEnviv)
+SOGLB_NULL_STUB(void, glGetTexGendv)
+SOGLB_NULL_STUB(void, glGetTexGenfv)
+SOGLB_NULL_STUB(void, glGetTexGeniv)
+SOGLB_NULL_STUB(void, glGetTexImage)
+SOGLB_NULL_STUB(void, glGetTexLevelParameterfv)
+SOGLB_NULL_STUB(void, glGetTexLevelParameteriv)
+SOGLB_NULL_STUB(void, glGetTexParameterIiv)
+SOGLB_NULL_STUB(void, glGetTexParameterIuiv)
+SOGLB_NULL_STUB(void, glGetTexParameterfv)
+SOGLB_NULL_STUB(void, glGetTexParameteriv)
+SOGLB_NULL_STUB(void, glGetTextureImage)
+SOGLB_NULL_STUB(void, glGetTextureLevelParameterfv)
+SOGLB_NULL_STUB(void, glGetTextureLevelParameteriv)
+SOGLB_NULL_STUB(void, glGetTextureParameterIiv)
+SOGLB_NULL_STUB(void, glGetTextureParameterIuiv)
+SOGLB_NULL_STUB(void, glGetTextureParameterfv)
+SOGLB_NULL_STUB(void, glGetTextureSubImage)
+SOGLB_NULL_STUB(void, glGetTransformFeedbackVarying)
+SOGLB_NULL_STUB(void, glGetTransformFeedbacki64_v)
+SOGLB_NULL_STUB(void, glGetTransformFeedbacki_v)
+SOGLB_NULL_STUB(void, glGetTransformFeedbackiv)
+SOGLB_NULL_STUB(GLuint, glGetUniformBlockIndex)
+SOGLB_NULL_STUB(void, glGetUniformIndices)
+SOGLB_NULL_STUB(GLint, glGetUniformLocation)
+SOGLB_NULL_STUB(void, glGetUniformSubroutineuiv)
+SOGLB_NULL_STUB(void, glGetUniformdv)
+SOGLB_NULL_STUB(void, glGetUniformfv)
+SOGLB_NULL_STUB(void, glGetUniformiv)
+SOGLB_NULL_STUB(void, glGetUniformuiv)
+SOGLB_NULL_STUB(void, glGetVertexArrayIndexed64iv)
+SOGLB_NULL_STUB(void, glGetVertexArrayIndexediv)
+SOGLB_NULL_STUB(void, glGetVertexArrayiv)
+SOGLB_NULL_STUB(void, glGetVertexAttribIiv)
+SOGLB_NULL_STUB(void, glGetVertexAttribIuiv)
+SOGLB_NULL_STUB(void, glGetVertexAttribLdv)
+SOGLB_NULL_STUB(void, glGetVertexAttribPointerv)
+SOGLB_NULL_STUB(void, glGetVertexAttribdv)
+SOGLB_NULL_STUB(void, glGetVertexAttribfv)
+SOGLB_NULL_STUB(void, glGetVertexAttribiv)
+SOGLB_NULL_STUB(void, glGetnColorTable)
+SOGLB_NULL_STUB(void, glGetnCompressedTexImage)
+SOGLB_NULL_STUB(void, glGetnConvolutionFilter)
+SOGLB_NULL_STUB(void, glGetnHistogram)
+SOGLB_NULL_STUB(void, glGetnMapdv)
+SOGLB_NULL_STUB(void, glGetnMapfv)
+SOGLB_NULL_STUB(void, glGetnMapiv)
+SOGLB_NULL_STUB(void, glGetnMinmax)
+SOGLB_NULL_STUB(void, glGetnPixelMapfv)
+SOGLB_NULL_STUB(void, glGetnPixelMapuiv)
+SOGLB_NULL_STUB(void, glGetnPixelMapusv)
+SOGLB_NULL_STUB(void, glGetnPolygonStipple)
+SOGLB_NULL_STUB(void, glGetnSeparableFilter)
+SOGLB_NULL_STUB(void, glGetnTexImage)
+SOGLB_NULL_STUB(void, glGetnUniformdv)
+SOGLB_NULL_STUB(void, glGetnUniformfv)
+SOGLB_NULL_STUB(void, glGetnUniformiv)
+SOGLB_NULL_STUB(void, glGetnUniformuiv)
+SOGLB_NULL_STUB(void, glHint)
+SOGLB_NULL_STUB(void, glIndexMask)
+SOGLB_NULL_STUB(void, glIndexPointer)
+SOGLB_NULL_STUB(void, glIndexd)
+SOGLB_NULL_STUB(void, glIndexdv)
+SOGLB_NULL_STUB(void, glIndexf)
+SOGLB_NULL_STUB(void, glIndexfv)
+SOGLB_NULL_STUB(void, glIndexi)
+SOGLB_NULL_STUB(void, glIndexiv)
+SOGLB_NULL_STUB(void, glIndexs)
+SOGLB_NULL_STUB(void, glIndexsv)
+SOGLB_NULL_STUB(void, glIndexub)
+SOGLB_NULL_STUB(void, glIndexubv)
+SOGLB_NULL_STUB(void, glInitNames)
+SOGLB_NULL_STUB(void, glInterleavedArrays)
+SOGLB_NULL_STUB(void, glInvalidateBufferData)
+SOGLB_NULL_STUB(void, glInvalidateBufferSubData)
+SOGLB_NULL_STUB(void, glInvalidateFramebuffer)
+SOGLB_NULL_STUB(void, glInvalidateNamedFramebufferData)
+SOGLB_NULL_STUB(void, glInvalidateNamedFramebufferSubData)
+SOGLB_NULL_STUB(void, glInvalidateSubFramebuffer)
+SOGLB_NULL_STUB(void, glInvalidateTexImage)
+SOGLB_NULL_STUB(void, glInvalidateTexSubImage)
+SOGLB_NULL_STUB(GLboolean, glIsBuffer)
+SOGLB_NULL_STUB(GLboolean, glIsEnabled)
+SOGLB_NULL_STUB(GLboolean, glIsEnabledi)
+SOGLB_NULL_STUB(GLboolean, glIsFramebuffer)
+SOGLB_NULL_STUB(GLboolean, glIsList)
+SOGLB_NULL_STUB(GLboolean, glIsProgram)
+SOGLB_NULL_STUB(GLboolean, glIsProgramPipeline)
+SOGLB_NULL_STUB(GLboolean, glIsQuery)
+SOGLB_NULL_STUB(GLboolean, glIsRenderbuffer)
+SOGLB_NULL_STUB(GLboolean, glIsSampler)
+SOGLB_NULL_STUB(GLboolean, glIsShader)
+SOGLB_NULL_STUB(GLboolean, glIsSync)
+SOGLB_NULL_STUB(GLboolean, glIsTexture)
+SOGLB_NULL_STUB(GLboolean, glIsTransformFeedback)
+SOGLB_NULL_STUB(GLboolean, glIsVertexArray)
+SOGLB_NULL_STUB(void, glLightModelf)
+SOGLB_NULL_STUB(void, glLightModelfv)
+SOGLB_NULL_STUB(void, glLightModeli)
+SOGLB_NULL_STUB(void, glLightModeliv)
+SOGLB_NULL_STUB(void, glLightf)
+SOGLB_NULL_STUB(void, glLightfv)
+SOGLB_NULL_STUB(void, glLighti)
+SOGLB_NULL_STUB(void, glLightiv)
+SOGLB_NULL_STUB(void, glLineStipple)
+SOGLB_NULL_STUB(void, glLineWidth)
+SOGLB_NULL_STUB(void, glListBase)
+SOGLB_NULL_STUB(void, glLoadIdentity)
+SOGLB_NULL_STUB(void, glLoadMatrixd)
+SOGLB_NULL_STUB(void, glLoadMatrixf)
+SOGLB_NULL_STUB(void, glLoadName)
+SOGLB_NULL_STUB(void, glLoadTransposeMatrixd)
+SOGLB_NULL_STUB(void, glLoadTransposeMatrixf)
+SOGLB_NULL_STUB(void, glLogicOp)
+SOGLB_NULL_STUB(void, glMap1d)
+SOGLB_NULL_STUB(void, glMap1f)
+SOGLB_NULL_STUB(void, glMap2d)
+SOGLB_NULL_STUB(void, glMap2f)
+SOGLB_NULL_STUB(void*, glMapBuffer)
+SOGLB_NULL_STUB(void*, glMapBufferRange)
+SOGLB_NULL_STUB(void, glMapGrid1d)
+SOGLB_NULL_STUB(void, glMapGrid1f)
+SOGLB_NULL_STUB(void, glMapGrid2d)
+SOGLB_NULL_STUB(void, glMapGrid2f)
+SOGLB_NULL_STUB(void, glMaterialf)
+SOGLB_NULL_STUB(void, glMaterialfv)
+SOGLB_NULL_STUB(void, glMateriali)
+SOGLB_NULL_STUB(void, glMaterialiv)
+SOGLB_NULL_STUB(void, glMatrixMode)
+SOGLB_NULL_STUB(void, glMemoryBarrier)
+SOGLB_NULL_STUB(void, glMemoryBarrierByRegion)
+SOGLB_NULL_STUB(void, glMinSampleShading)
+SOGLB_NULL_STUB(void, glMultMatrixd)
+SOGLB_NULL_STUB(void, glMultMatrixf)
+SOGLB_NULL_STUB(void, glMultTransposeMatrixd)
+SOGLB_NULL_STUB(void, glMultTransposeMatrixf)
+SOGLB_NULL_STUB(void, glMultiDrawArrays)
+SOGLB_NULL_STUB(void, glMultiDrawArraysIndirect)
+SOGLB_NULL_STUB(void, glMultiDrawArraysIndirectCount)
+SOGLB_NULL_STUB(void, glMultiDrawElements)
+SOGLB_NULL_STUB(void, glMultiDrawElementsBaseVertex)
+SOGLB_NULL_STUB(void, glMultiDrawElementsIndirect)
+SOGLB_NULL_STUB(void, glMultiDrawElementsIndirectCount)
+SOGLB_NULL_STUB(void, glMultiTexCoord1d)
+SOGLB_NULL_STUB(void, glMultiTexCoord1dv)
+SOGLB_NULL_STUB(void, glMultiTexCoord1f)
+SOGLB_NULL_STUB(void, glMultiTexCoord1fv)
+SOGLB_NULL_STUB(void, glMultiTexCoord1i)
+SOGLB_NULL_STUB(void, glMultiTexCoord1iv)
+SOGLB_NULL_STUB(void, glMultiTexCoord1s)
+SOGLB_NULL_STUB(void, glMultiTexCoord1sv)
+SOGLB_NULL_STUB(void, glMultiTexCoord2d)
+SOGLB_NULL_STUB(void, glMultiTexCoord2dv)
+SOGLB_NULL_STUB(void, glMultiTexCoord2f)
+SOGLB_NULL_STUB(void, glMultiTexCoord2fv)
+SOGLB_NULL_STUB(void, glMultiTexCoord2i)
+SOGLB_NULL_STUB(void, glMultiTexCoord2iv)
+SOGLB_NULL_STUB(void, glMultiTexCoord2s)
+SOGLB_NULL_STUB(void, glMultiTexCoord2sv)
+SOGLB_NULL_STUB(void, glMultiTexCoord3d)
+SOGLB_NULL_STUB(void, glMultiTexCoord3dv)
+SOGLB_NULL_STUB(void, glMultiTexCoord3f)
+SOGLB_NULL_STUB(void, glMultiTexCoord3fv)
+SOGLB_NULL_STUB(void, glMultiTexCoord3i)
+SOGLB_NULL_STUB(void, glMultiTexCoord3iv)
+SOGLB_NULL_STUB(void, glMultiTexCoord3s)
+SOGLB_NULL_STUB(void, glMultiTexCoord3sv)
+SOGLB_NULL_STUB(void, glMultiTexCoord4d)
+SOGLB_NULL_STUB(void, glMultiTexCoord4dv)
+SOGLB_NULL_STUB(void, glMultiTexCoord4f)
+SOGLB_NULL_STUB(void, glMultiTexCoord4fv)
+SOGLB_NULL_STUB(void, glMultiTexCoord4i)
+SOGLB_NULL_STUB(void, glMultiTexCoord4iv)
+SOGLB_NULL_STUB(void, glMultiTexCoord4s)
+SOGLB_NULL_STUB(void, glMultiTexCoord4sv)
+SOGLB_NULL_STUB(void, glMultiTexCoordP1ui)
+SOGLB_NULL_STUB(void, glMultiTexCoordP1uiv)
+SOGLB_NULL_STUB(void, glMultiTexCoordP2ui)
+SOGLB_NULL_STUB(void, glMultiTexCoordP2uiv)
+SOGLB_NULL_STUB(void, glMultiTexCoordP3ui)
+SOGLB_NULL_STUB(void, glMultiTexCoordP3uiv)
+SOGLB_NULL_STUB(void, glMultiTexCoordP4ui)
+SOGLB_NULL_STUB(void, glMultiTexCoordP4uiv)
+SOGLB_NULL_STUB(void, glNamedFramebufferDrawBuffer)
+SOGLB_NULL_STUB(void, glNamedFramebufferDrawBuffers)
+SOGLB_NULL_STUB(void, glNamedFramebufferParameteri)
+SOGLB_NULL_STUB(void, glNamedFramebufferReadBuffer)
+SOGLB_NULL_STUB(void, glNamedFramebufferRenderbuffer)
+SOGLB_NULL_STUB(void, glNamedFramebufferTexture)
+SOGLB_NULL_STUB(void, glNamedFramebufferTextureLayer)
+SOGLB_NULL_STUB(void, glNamedRenderbufferStorage)
+SOGLB_NULL_STUB(void, glNamedRenderbufferStorageMultisample)
+SOGLB_NULL_STUB(void, glNewList)
+SOGLB_NULL_STUB(void, glNormal3b)
+SOGLB_NULL_STUB(void, glNormal3bv)
+SOGLB_NULL_STUB(void, glNormal3d)
+SOGLB_NULL_STUB(void, glNormal3dv)
+SOGLB_NULL_STUB(void, glNormal3f)
+SOGLB_NULL_STUB(void, glNormal3fv)
+SOGLB_NULL_STUB(void, glNormal3i)
+SOGLB_NULL_STUB(void, glNormal3iv)
+SOGLB_NULL_STUB(void, glNormal3s)
+SOGLB_NULL_STUB(void, glNormal3sv)
+SOGLB_NULL_STUB(void, glNormalP3ui)
+SOGLB_NULL_STUB(void, glNormalP3uiv)
+SOGLB_NULL_STUB(void, glNormalPointer)
+SOGLB_NULL_STUB(void, glObjectLabel)
+SOGLB_NULL_STUB(void, glObjectPtrLabel)
+SOGLB_NULL_STUB(void, glOrtho)
+SOGLB_NULL_STUB(void, glPassThrough)
+SOGLB_NULL_STUB(void, glPatchParameterfv)
+SOGLB_NULL_STUB(void, glPatchParameteri)
+SOGLB_NULL_STUB(void, glPauseTransformFeedback)
+SOGLB_NULL_STUB(void, glPixelMapfv)
+SOGLB_NULL_STUB(void, glPixelMapuiv)
+SOGLB_NULL_STUB(void, glPixelMapusv)
+SOGLB_NULL_STUB(void, glPixelStoref)
+SOGLB_NULL_STUB(void, glPixelStorei)
+SOGLB_NULL_STUB(void, glPixelTransferf)
+SOGLB_NULL_STUB(void, glPixelTransferi)
+SOGLB_NULL_STUB(void, glPixelZoom)
+SOGLB_NULL_STUB(void, glPointParameterf)
+SOGLB_NULL_STUB(void, glPointParameterfv)
+SOGLB_NULL_STUB(void, glPointParameteri)
+SOGLB_NULL_STUB(void, glPointParameteriv)
+SOGLB_NULL_STUB(void, glPointSize)
+SOGLB_NULL_STUB(void, glPolygonMode)
+SOGLB_NULL_STUB(void, glPolygonOffset)
+SOGLB_NULL_STUB(void, glPolygonOffsetClamp)
+SOGLB_NULL_STUB(void, glPolygonStipple)
+SOGLB_NULL_STUB(void, glPopAttrib)
+SOGLB_NULL_STUB(void, glPopClientAttrib)
+SOGLB_NULL_STUB(void, glPopDebugGroup)
+SOGLB_NULL_STUB(void, glPopMatrix)
+SOGLB_NULL_STUB(void, glPopName)
+SOGLB_NULL_STUB(void, glPrimitiveRestartIndex)
+SOGLB_NULL_STUB(void, glPrioritizeTextures)
+SOGLB_NULL_STUB(void, glProgramBinary)
+SOGLB_NULL_STUB(void, glProgramParameteri)
+SOGLB_NULL_STUB(void, glProgramUniform1d)
+SOGLB_NULL_STUB(void, glProgramUniform1dv)
+SOGLB_NULL_STUB(void, glProgramUniform1f)
+SOGLB_NULL_STUB(void, glProgramUniform1fv)
+SOGLB_NULL_STUB(void, glProgramUniform1i)
+SOGLB_NULL_STUB(void, glProgramUniform1iv)
+SOGLB_NULL_STUB(void, glProgramUniform1ui)
+SOGLB_NULL_STUB(void, glProgramUniform1uiv)
+SOGLB_NULL_STUB(void, glProgramUniform2d)
+SOGLB_NULL_STUB(void, glProgramUniform2dv)
+SOGLB_NULL_STUB(void, glProgramUniform2f)
+SOGLB_NULL_STUB(void, glProgramUniform2fv)
+SOGLB_NULL_STUB(void, glProgramUniform2i)
+SOGLB_NULL_STUB(void, glProgramUniform2iv)
+SOGLB_NULL_STUB(void, glProgramUniform2ui)
+SOGLB_NULL_STUB(void, glProgramUniform2uiv)
+SOGLB_NULL_STUB(void, glProgramUniform3d)
+SOGLB_NULL_STUB(void, glProgramUniform3dv)
+SOGLB_NULL_STUB(void, glProgramUniform3f)
+SOGLB_NULL_STUB(void, glProgramUniform3fv)
+SOGLB_NULL_STUB(void, glProgramUniform3i)
+SOGLB_NULL_STUB(void, glProgramUniform3iv)
+SOGLB_NULL_STUB(void, glProgramUniform3ui)
+SOGLB_NULL_STUB(void, glProgramUniform3uiv)
+SOGLB_NULL_STUB(void, glProgramUniform4d)
+SOGLB_NULL_STUB(void, glProgramUniform4dv)
+SOGLB_NULL_STUB(void, glProgramUniform4f)
+SOGLB_NULL_STUB(void, glProgramUniform4fv)
+SOGLB_NULL_STUB(void, glProgramUniform4i)
+SOGLB_NULL_STUB(void, glProgramUniform4iv)
+SOGLB_NULL_STUB(void, glProgramUniform4ui)
+SOGLB_NULL_STUB(void, glProgramUniform4uiv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2x3dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2x3fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2x4dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix2x4fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3x2dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3x2fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3x4dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix3x4fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4x2dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4x2fv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4x3dv)
+SOGLB_NULL_STUB(void, glProgramUniformMatrix4x3fv)
+SOGLB_NULL_STUB(void, glProvokingVertex)
+SOGLB_NULL_STUB(void, glPushAttrib)
+SOGLB_NULL_STUB(void, glPushClientAttrib)
+SOGLB_NULL_STUB(void, glPushDebugGroup)
+SOGLB_NULL_STUB(void, glPushMatrix)
+SOGLB_NULL_STUB(void, glPushName)
+SOGLB_NULL_STUB(void, glQueryCounter)
+SOGLB_NULL_STUB(void, glRasterPos2d)
+SOGLB_NULL_STUB(void, glRasterPos2dv)
+SOGLB_NULL_STUB(void, glRasterPos2f)
+SOGLB_NULL_STUB(void, glRasterPos2fv)
+SOGLB_NULL_STUB(void, glRasterPos2i)
+SOGLB_NULL_STUB(void, glRasterPos2iv)
+SOGLB_NULL_STUB(void, glRasterPos2s)
+SOGLB_NULL_STUB(void, glRasterPos2sv)
+SOGLB_NULL_STUB(void, glRasterPos3d)
+SOGLB_NULL_STUB(void, glRasterPos3dv)
+SOGLB_NULL_STUB(void, glRasterPos3f)
+SOGLB_NULL_STUB(void, glRasterPos3fv)
+SOGLB_NULL_STUB(void, glRasterPos3i)
+SOGLB_NULL_STUB(void, glRasterPos3iv)
+SOGLB_NULL_STUB(void, glRasterPos3s)
+SOGLB_NULL_STUB(void, glRasterPos3sv)
+SOGLB_NULL_STUB(void, glRasterPos4d)
+SOGLB_NULL_STUB(void, glRasterPos4dv)
+SOGLB_NULL_STUB(void, glRasterPos4f)
+SOGLB_NULL_STUB(void, glRasterPos4fv)
+SOGLB_NULL_STUB(void, glRasterPos4i)
+SOGLB_NULL_STUB(void, glRasterPos4iv)
+SOGLB_NULL_STUB(void, glRasterPos4s)
+SOGLB_NULL_STUB(void, glRasterPos4sv)
+SOGLB_NULL_STUB(void, glReadBuffer)
+SOGLB_NULL_STUB(void, glReadPixels)
+SOGLB_NULL_STUB(void, glReadnPixels)
+SOGLB_NULL_STUB(void, glRectd)
+SOGLB_NULL_STUB(void, glRectdv)
+SOGLB_NULL_STUB(void, glRectf)
+SOGLB_NULL_STUB(void, glRectfv)
+SOGLB_NULL_STUB(void, glRecti)
+SOGLB_NULL_STUB(void, glRectiv)
+SOGLB_NULL_STUB(void, glRects)
+SOGLB_NULL_STUB(void, glRectsv)
+SOGLB_NULL_STUB(void, glReleaseShaderCompiler)
+SOGLB_NULL_STUB(GLint, glRenderMode)
+SOGLB_NULL_STUB(void, glRenderbufferStorage)
+SOGLB_NULL_STUB(void, glRenderbufferStorageMultisample)
+SOGLB_NULL_STUB(void, glResumeTransformFeedback)
+SOGLB_NULL_STUB(void, glRotated)
+SOGLB_NULL_STUB(void, glRotatef)
+SOGLB_NULL_STUB(void, glSampleCoverage)
+SOGLB_NULL_STUB(void, glSampleMaski)
+SOGLB_NULL_STUB(void, glSamplerParameterIiv)
+SOGLB_NULL_STUB(void, glSamplerParameterIuiv)
+SOGLB_NULL_STUB(void, glSamplerParameterf)
+SOGLB_NULL_STUB(void, glSamplerParameterfv)
+SOGLB_NULL_STUB(void, glSamplerParameteri)
+SOGLB_NULL_STUB(void, glSamplerParameteriv)
+SOGLB_NULL_STUB(void, glScaled)
+SOGLB_NULL_STUB(void, glScalef)
+SOGLB_NULL_STUB(void, glScissor)
+SOGLB_NULL_STUB(void, glScissorArrayv)
+SOGLB_NULL_STUB(void, glScissorIndexed)
+SOGLB_NULL_STUB(void, glScissorIndexedv)
+SOGLB_NULL_STUB(void, glSecondaryColor3b)
+SOGLB_NULL_STUB(void, glSecondaryColor3bv)
+SOGLB_NULL_STUB(void, glSecondaryColor3d)
+SOGLB_NULL_STUB(void, glSecondaryColor3dv)
+SOGLB_NULL_STUB(void, glSecondaryColor3f)
+SOGLB_NULL_STUB(void, glSecondaryColor3fv)
+SOGLB_NULL_STUB(void, glSecondaryColor3i)
+SOGLB_NULL_STUB(void, glSecondaryColor3iv)
+SOGLB_NULL_STUB(void, glSecondaryColor3s)
+SOGLB_NULL_STUB(void, glSecondaryColor3sv)
+SOGLB_NULL_STUB(void, glSecondaryColor3ub)
+SOGLB_NULL_STUB(void, glSecondaryColor3ubv)
+SOGLB_NULL_STUB(void, glSecondaryColor3ui)
+SOGLB_NULL_STUB(void, glSecondaryColor3uiv)
+SOGLB_NULL_STUB(void, glSecondaryColor3us)
+SOGLB_NULL_STUB(void, glSecondaryColor3usv)
+SOGLB_NULL_STUB(void, glSecondaryColorP3ui)
+SOGLB_NULL_STUB(void, glSecondaryColorP3uiv)
+SOGLB_NULL_STUB(void, glSecondaryColorPointer)
+SOGLB_NULL_STUB(void, glSelectBuffer)
+SOGLB_NULL_STUB(void, glShadeModel)
+SOGLB_NULL_STUB(void, glShaderStorageBlockBinding)
+SOGLB_NULL_STUB(void, glSpecializeShader)
+SOGLB_NULL_STUB(void, glStencilFunc)
+SOGLB_NULL_STUB(void, glStencilFuncSeparate)
+SOGLB_NULL_STUB(void, glStencilMask)
+SOGLB_NULL_STUB(void, glStencilMaskSeparate)
+SOGLB_NULL_STUB(void, glStencilOp)
+SOGLB_NULL_STUB(void, glStencilOpSeparate)
+SOGLB_NULL_STUB(void, glTexBuffer)
+SOGLB_NULL_STUB(void, glTexBufferRange)
+SOGLB_NULL_STUB(void, glTexCoord1d)
+SOGLB_NULL_STUB(void, glTexCoord1dv)
+SOGLB_NULL_STUB(void, glTexCoord1f)
+SOGLB_NULL_STUB(void, glTexCoord1fv)
+SOGLB_NULL_STUB(void, glTexCoord1i)
+SOGLB_NULL_STUB(void, glTexCoord1iv)
+SOGLB_NULL_STUB(void, glTexCoord1s)
+SOGLB_NULL_STUB(void, glTexCoord1sv)
+SOGLB_NULL_STUB(void, glTexCoord2d)
+SOGLB_NULL_STUB(void, glTexCoord2dv)
+SOGLB_NULL_STUB(void, glTexCoord2f)
+SOGLB_NULL_STUB(void, glTexCoord2fv)
+SOGLB_NULL_STUB(void, glTexCoord2i)
+SOGLB_NULL_STUB(void, glTexCoord2iv)
+SOGLB_NULL_STUB(void, glTexCoord2s)
+SOGLB_NULL_STUB(void, glTexCoord2sv)
+SOGLB_NULL_STUB(void, glTexCoord3d)
+SOGLB_NULL_STUB(void, glTexCoord3dv)
+SOGLB_NULL_STUB(void, glTexCoord3f)
+SOGLB_NULL_STUB(void, glTexCoord3fv)
+SOGLB_NULL_STUB(void, glTexCoord3i)
+SOGLB_NULL_STUB(void, glTexCoord3iv)
+SOGLB_NULL_STUB(void, glTexCoord3s)
+SOGLB_NULL_STUB(void, glTexCoord3sv)
+SOGLB_NULL_STUB(void, glTexCoord4d)
+SOGLB_NULL_STUB(void, glTexCoord4dv)
+SOGLB_NULL_STUB(void, glTexCoord4f)
+SOGLB_NULL_STUB(void, glTexCoord4fv)
+SOGLB_NULL_STUB(void, glTexCoord4i)
+SOGLB_NULL_STUB(void, glTexCoord4iv)
+SOGLB_NULL_STUB(void, glTexCoord4s)
+SOGLB_NULL_STUB(void, glTexCoord4sv)
+SOGLB_NULL_STUB(void, glTexCoordP1ui)
+SOGLB_NULL_STUB(void, glTexCoordP1uiv)
+SOGLB_NULL_STUB(void, glTexCoordP2ui)
+SOGLB_NULL_STUB(void, glTexCoordP2uiv)
+SOGLB_NULL_STUB(void, glTexCoordP3ui)
+SOGLB_NULL_STUB(void, glTexCoordP3uiv)
+SOGLB_NULL_STUB(void, glTexCoordP4ui)
+SOGLB_NULL_STUB(void, glTexCoordP4uiv)
+SOGLB_NULL_STUB(void, glTexCoordPointer)
+SOGLB_NULL_STUB(void, glTexEnvf)
+SOGLB_NULL_STUB(void, glTexEnvfv)
+SOGLB_NULL_STUB(void, glTexEnvi)
+SOGLB_NULL_STUB(void, glTexEnviv)
+SOGLB_NULL_STUB(void, glTexGend)
+SOGLB_NULL_STUB(void, glTexGendv)
+SOGLB_NULL_STUB(void, glTexGenf)
+SOGLB_NULL_STUB(void, glTexGenfv)
+SOGLB_NULL_STUB(void, glTexGeni)
+SOGLB_NULL_STUB(void, glTexGeniv)
+SOGLB_NULL_STUB(void, glTexImage1D)
+SOGLB_NULL_STUB(void, glTexImage2D)
+SOGLB_NULL_STUB(void, glTexImage2DMultisample)
+SOGLB_NULL_STUB(void, glTexImage3D)
+SOGLB_NULL_STUB(void, glTexImage3DMultisample)
+SOGLB_NULL_STUB(void, glTexParameterIiv)
+SOGLB_NULL_STUB(void, glTexParameterIuiv)
+SOGLB_NULL_STUB(void, glTexParameterf)
+SOGLB_NULL_STUB(void, glTexParameterfv)
+SOGLB_NULL_STUB(void, glTexParameteri)
+SOGLB_NULL_STUB(void, glTexParameteriv)
+SOGLB_NULL_STUB(void, glTexStorage1D)
+SOGLB_NULL_STUB(void, glTexStorage2D)
+SOGLB_NULL_STUB(void, glTexStorage2DMultisample)
+SOGLB_NULL_STUB(void, glTexStorage3D)
+SOGLB_NULL_STUB(void, glTexStorage3DMultisample)
+SOGLB_NULL_STUB(void, glTexSubImage1D)
+SOGLB_NULL_STUB(void, glTexSubImage2D)
+SOGLB_NULL_STUB(void, glTexSubImage3D)
+SOGLB_NULL_STUB(void, glTextureBarrier)
+SOGLB_NULL_STUB(void, glTextureBuffer)
+SOGLB_NULL_STUB(void, glTextureBufferRange)
+SOGLB_NULL_STUB(void, glTextureParameterIiv)
+SOGLB_NULL_STUB(void, glTextureParameterIuiv)
+SOGLB_NULL_STUB(void, glTextureParameterf)
+SOGLB_NULL_STUB(void, glTextureParameterfv)
+SOGLB_NULL_STUB(void, glTextureParameteri)
+SOGLB_NULL_STUB(void, glTextureParameteriv)
+SOGLB_NULL_STUB(void, glTextureStorage1D)
+SOGLB_NULL_STUB(void, glTextureStorage2DMultisample)
+SOGLB_NULL_STUB(void, glTextureStorage3DMultisample)
+SOGLB_NULL_STUB(void, glTextureSubImage1D)
+SOGLB_NULL_STUB(void, glTextureSubImage2D)
+SOGLB_NULL_STUB(void, glTextureSubImage3D)
+SOGLB_NULL_STUB(void, glTextureView)
+SOGLB_NULL_STUB(void, glTransformFeedbackBufferBase)
+SOGLB_NULL_STUB(void, glTransformFeedbackBufferRange)
+SOGLB_NULL_STUB(void, glTransformFeedbackVaryings)
+SOGLB_NULL_STUB(void, glTranslated)
+SOGLB_NULL_STUB(void, glTranslatef)
+SOGLB_NULL_STUB(void, glUniform1d)
+SOGLB_NULL_STUB(void, glUniform1dv)
+SOGLB_NULL_STUB(void, glUniform1f)
+SOGLB_NULL_STUB(void, glUniform1fv)
+SOGLB_NULL_STUB(void, glUniform1i)
+SOGLB_NULL_STUB(void, glUniform1iv)
+SOGLB_NULL_STUB(void, glUniform1ui)
+SOGLB_NULL_STUB(void, glUniform1uiv)
+SOGLB_NULL_STUB(void, glUniform2d)
+SOGLB_NULL_STUB(void, glUniform2dv)
+SOGLB_NULL_STUB(void, glUniform2f)
+SOGLB_NULL_STUB(void, glUniform2fv)
+SOGLB_NULL_STUB(void, glUniform2i)
+SOGLB_NULL_STUB(void, glUniform2iv)
+SOGLB_NULL_STUB(void, glUniform2ui)
+SOGLB_NULL_STUB(void, glUniform2uiv)
+SOGLB_NULL_STUB(void, glUniform3d)
+SOGLB_NULL_STUB(void, glUniform3dv)
+SOGLB_NULL_STUB(void, glUniform3f)
+SOGLB_NULL_STUB(void, glUniform3fv)
+SOGLB_NULL_STUB(void, glUniform3i)
+SOGLB_NULL_STUB(void, glUniform3iv)
+SOGLB_NULL_STUB(void, glUniform3ui)
+SOGLB_NULL_STUB(void, glUniform3uiv)
+SOGLB_NULL_STUB(void, glUniform4d)
+SOGLB_NULL_STUB(void, glUniform4dv)
+SOGLB_NULL_STUB(void, glUniform4f)
+SOGLB_NULL_STUB(void, glUniform4fv)
+SOGLB_NULL_STUB(void, glUniform4i)
+SOGLB_NULL_STUB(void, glUniform4iv)
+SOGLB_NULL_STUB(void, glUniform4ui)
+SOGLB_NULL_STUB(void, glUniform4uiv)
+SOGLB_NULL_STUB(void, glUniformBlockBinding)
+SOGLB_NULL_STUB(void, glUniformMatrix2dv)
+SOGLB_NULL_STUB(void, glUniformMatrix2fv)
+SOGLB_NULL_STUB(void, glUniformMatrix2x3dv)
+SOGLB_NULL_STUB(void, glUniformMatrix2x3fv)
+SOGLB_NULL_STUB(void, glUniformMatrix2x4dv)
+SOGLB_NULL_STUB(void, glUniformMatrix2x4fv)
+SOGLB_NULL_STUB(void, glUniformMatrix3dv)
+SOGLB_NULL_STUB(void, glUniformMatrix3fv)
+SOGLB_NULL_STUB(void, glUniformMatrix3x2dv)
+SOGLB_NULL_STUB(void, glUniformMatrix3x2fv)
+SOGLB_NULL_STUB(void, glUniformMatrix3x4dv)
+SOGLB_NULL_STUB(void, glUniformMatrix3x4fv)
+SOGLB_NULL_STUB(void, glUniformMatrix4dv)
+SOGLB_NULL_STUB(void, glUniformMatrix4fv)
+SOGLB_NULL_STUB(void, glUniformMatrix4x2dv)
+SOGLB_NULL_STUB(void, glUniformMatrix4x2fv)
+SOGLB_NULL_STUB(void, glUniformMatrix4x3dv)
+SOGLB_NULL_STUB(void, glUniformMatrix4x3fv)
+SOGLB_NULL_STUB(void, glUniformSubroutinesuiv)
+SOGLB_NULL_STUB(GLboolean, glUnmapBuffer)
+SOGLB_NULL_STUB(void, glUseProgram)
+SOGLB_NULL_STUB(void, glUseProgramStages)
+SOGLB_NULL_STUB(void, glValidateProgram)
+SOGLB_NULL_STUB(void, glValidateProgramPipeline)
+SOGLB_NULL_STUB(void, glVertex2d)
+SOGLB_NULL_STUB(void, glVertex2dv)
+SOGLB_NULL_STUB(void, glVertex2f)
+SOGLB_NULL_STUB(void, glVertex2fv)
+SOGLB_NULL_STUB(void, glVertex2i)
+SOGLB_NULL_STUB(void, glVertex2iv)
+SOGLB_NULL_STUB(void, glVertex2s)
+SOGLB_NULL_STUB(void, glVertex2sv)
+SOGLB_NULL_STUB(void, glVertex3d)
+SOGLB_NULL_STUB(void, glVertex3dv)
+SOGLB_NULL_STUB(void, glVertex3f)
+SOGLB_NULL_STUB(void, glVertex3fv)
+SOGLB_NULL_STUB(void, glVertex3i)
+SOGLB_NULL_STUB(void, glVertex3iv)
+SOGLB_NULL_STUB(void, glVertex3s)
+SOGLB_NULL_STUB(void, glVertex3sv)
+SOGLB_NULL_STUB(void, glVertex4d)
+SOGLB_NULL_STUB(void, glVertex4dv)
+SOGLB_NULL_STUB(void, glVertex4f)
+SOGLB_NULL_STUB(void, glVertex4fv)
+SOGLB_NULL_STUB(void, glVertex4i)
+SOGLB_NULL_STUB(void, glVertex4iv)
+SOGLB_NULL_STUB(void, glVertex4s)
+SOGLB_NULL_STUB(void, glVertex4sv)
+SOGLB_NULL_STUB(void, glVertexArrayAttribBinding)
+SOGLB_NULL_STUB(void, glVertexArrayAttribFormat)
+SOGLB_NULL_STUB(void, glVertexArrayAttribIFormat)
+SOGLB_NULL_STUB(void, glVertexArrayAttribLFormat)
+SOGLB_NULL_STUB(void, glVertexArrayBindingDivisor)
+SOGLB_NULL_STUB(void, glVertexArrayElementBuffer)
+SOGLB_NULL_STUB(void, glVertexArrayVertexBuffer)
+SOGLB_NULL_STUB(void, glVertexArrayVertexBuffers)
+SOGLB_NULL_STUB(void, glVertexAttrib1d)
+SOGLB_NULL_STUB(void, glVertexAttrib1dv)
+SOGLB_NULL_STUB(void, glVertexAttrib1f)
+SOGLB_NULL_STUB(void, glVertexAttrib1fv)
+SOGLB_NULL_STUB(void, glVertexAttrib1s)
+SOGLB_NULL_STUB(void, glVertexAttrib1sv)
+SOGLB_NULL_STUB(void, glVertexAttrib2d)
+SOGLB_NULL_STUB(void, glVertexAttrib2dv)
+SOGLB_NULL_STUB(void, glVertexAttrib2f)
+SOGLB_NULL_STUB(void, glVertexAttrib2fv)
+SOGLB_NULL_STUB(void, glVertexAttrib2s)
+SOGLB_NULL_STUB(void, glVertexAttrib2sv)
+SOGLB_NULL_STUB(void, glVertexAttrib3d)
+SOGLB_NULL_STUB(void, glVertexAttrib3dv)
+SOGLB_NULL_STUB(void, glVertexAttrib3f)
+SOGLB_NULL_STUB(void, glVertexAttrib3fv)
+SOGLB_NULL_STUB(void, glVertexAttrib3s)
+SOGLB_NULL_STUB(void, glVertexAttrib3sv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nbv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Niv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nsv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nub)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nubv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nuiv)
+SOGLB_NULL_STUB(void, glVertexAttrib4Nusv)
+SOGLB_NULL_STUB(void, glVertexAttrib4bv)
+SOGLB_NULL_STUB(void, glVertexAttrib4d)
+SOGLB_NULL_STUB(void, glVertexAttrib4dv)
+SOGLB_NULL_STUB(void, glVertexAttrib4f)
+SOGLB_NULL_STUB(void, glVertexAttrib4fv)
+SOGLB_NULL_STUB(void, glVertexAttrib4iv)
+SOGLB_NULL_STUB(void, glVertexAttrib4s)
+SOGLB_NULL_STUB(void, glVertexAttrib4sv)
+SOGLB_NULL_STUB(void, glVertexAttrib4ubv)
+SOGLB_NULL_STUB(void, glVertexAttrib4uiv)
+SOGLB_NULL_STUB(void, glVertexAttrib4usv)
+SOGLB_NULL_STUB(void, glVertexAttribBinding)
+SOGLB_NULL_STUB(void, glVertexAttribDivisor)
+SOGLB_NULL_STUB(void, glVertexAttribFormat)
+SOGLB_NULL_STUB(void, glVertexAttribI1i)
+SOGLB_NULL_STUB(void, glVertexAttribI1iv)
+SOGLB_NULL_STUB(void, glVertexAttribI1ui)
+SOGLB_NULL_STUB(void, glVertexAttribI1uiv)
+SOGLB_NULL_STUB(void, glVertexAttribI2i)
+SOGLB_NULL_STUB(void, glVertexAttribI2iv)
+SOGLB_NULL_STUB(void, glVertexAttribI2ui)
+SOGLB_NULL_STUB(void, glVertexAttribI2uiv)
+SOGLB_NULL_STUB(void, glVertexAttribI3i)
+SOGLB_NULL_STUB(void, glVertexAttribI3iv)
+SOGLB_NULL_STUB(void, glVertexAttribI3ui)
+SOGLB_NULL_STUB(void, glVertexAttribI3uiv)
+SOGLB_NULL_STUB(void, glVertexAttribI4bv)
+SOGLB_NULL_STUB(void, glVertexAttribI4i)
+SOGLB_NULL_STUB(void, glVertexAttribI4iv)
+SOGLB_NULL_STUB(void, glVertexAttribI4sv)
+SOGLB_NULL_STUB(void, glVertexAttribI4ubv)
+SOGLB_NULL_STUB(void, glVertexAttribI4ui)
+SOGLB_NULL_STUB(void, glVertexAttribI4uiv)
+SOGLB_NULL_STUB(void, glVertexAttribI4usv)
+SOGLB_NULL_STUB(void, glVertexAttribIFormat)
+SOGLB_NULL_STUB(void, glVertexAttribIPointer)
+SOGLB_NULL_STUB(void, glVertexAttribL1d)
+SOGLB_NULL_STUB(void, glVertexAttribL1dv)
+SOGLB_NULL_STUB(void, glVertexAttribL2d)
+SOGLB_NULL_STUB(void, glVertexAttribL2dv)
+SOGLB_NULL_STUB(void, glVertexAttribL3d)
+SOGLB_NULL_STUB(void, glVertexAttribL3dv)
+SOGLB_NULL_STUB(void, glVertexAttribL4d)
+SOGLB_NULL_STUB(void, glVertexAttribL4dv)
+SOGLB_NULL_STUB(void, glVertexAttribLFormat)
+SOGLB_NULL_STUB(void, glVertexAttribLPointer)
+SOGLB_NULL_STUB(void, glVertexAttribP1ui)
+SOGLB_NULL_STUB(void, glVertexAttribP1uiv)
+SOGLB_NULL_STUB(void, glVertexAttribP2ui)
+SOGLB_NULL_STUB(void, glVertexAttribP2uiv)
+SOGLB_NULL_STUB(void, glVertexAttribP3ui)
+SOGLB_NULL_STUB(void, glVertexAttribP3uiv)
+SOGLB_NULL_STUB(void, glVertexAttribP4ui)
+SOGLB_NULL_STUB(void, glVertexAttribP4uiv)
+SOGLB_NULL_STUB(void, glVertexAttribPointer)
+SOGLB_NULL_STUB(void, glVertexBindingDivisor)
+SOGLB_NULL_STUB(void, glVertexP2ui)
+SOGLB_NULL_STUB(void, glVertexP2uiv)
+SOGLB_NULL_STUB(void, glVertexP3ui)
+SOGLB_NULL_STUB(void, glVertexP3uiv)
+SOGLB_NULL_STUB(void, glVertexP4ui)
+SOGLB_NULL_STUB(void, glVertexP4uiv)
+SOGLB_NULL_STUB(void, glVertexPointer)
+SOGLB_NULL_STUB(void, glViewport)
+SOGLB_NULL_STUB(void, glViewportArrayv)
+SOGLB_NULL_STUB(void, glViewportIndexedf)
+SOGLB_NULL_STUB(void, glViewportIndexedfv)
+SOGLB_NULL_STUB(void, glWindowPos2d)
+SOGLB_NULL_STUB(void, glWindowPos2dv)
+SOGLB_NULL_STUB(void, glWindowPos2f)
+SOGLB_NULL_STUB(void, glWindowPos2fv)
+SOGLB_NULL_STUB(void, glWindowPos2i)
+SOGLB_NULL_STUB(void, glWindowPos2iv)
+SOGLB_NULL_STUB(void, glWindowPos2s)
+SOGLB_NULL_STUB(void, glWindowPos2sv)
+SOGLB_NULL_STUB(void, glWindowPos3d)
+SOGLB_NULL_STUB(void, glWindowPos3dv)
+SOGLB_NULL_STUB(void, glWindowPos3f)
+SOGLB_NULL_STUB(void, glWindowPos3fv)
+SOGLB_NULL_STUB(void, glWindowPos3i)
+SOGLB_NULL_STUB(void, glWindowPos3iv)
+SOGLB_NULL_STUB(void, glWindowPos3s)
+SOGLB_NULL_STUB(void, glWindowPos3sv)
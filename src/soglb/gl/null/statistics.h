@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace gl::null
+{
+//! What the null backend has recorded since it was started, or since the last resetCallStatistics()
+struct Statistics
+{
+  //! The number of calls per OpenGL entry point
+  std::map<std::string, size_t> calls{};
+  //! Bytes passed to buffer uploads
+  size_t uploadedBufferBytes = 0;
+
+  //! Bytes allocated by the buffers currently alive
+  size_t bufferBytes = 0;
+  //! Texels allocated by the base levels of the textures currently alive
+  size_t textureTexels = 0;
+  size_t programs = 0;
+
+  [[nodiscard]] size_t getTotalCalls() const;
+  [[nodiscard]] size_t getDrawCalls() const;
+};
+
+[[nodiscard]] extern Statistics getStatistics();
+
+//! Resets the call counts and uploaded bytes; the sizes of the allocated objects are kept
+extern void resetCallStatistics();
+} // namespace gl::null
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "api/gl.hpp"
+#include "glassert.h"
+
+#include <gsl-lite.hpp>
+#include <optional>
+
+namespace gl
+{
+// NOLINTNEXTLINE(bugprone-reserved-identifier)
+template<api::QueryTarget _Target>
+class Query final
+{
+public:
+  static constexpr api::QueryTarget Target = _Target;
+
+  explicit Query(const std::string& label = {})
+  {
+    GL_ASSERT(api::createQuerie(Target, 1, &m_handle));
+    Expects(m_handle != 0);
+
+    if(!label.empty())
+    {
+      GL_ASSERT(api::objectLabel(api::ObjectIdentifier::Query, m_handle, -1, label.c_str()));
+    }
+  }
+
+  Query(const Query&) = delete;
+
+  Query(Query&&) = delete;
+
+  Query& operator=(const Query&) = delete;
+
+  Query& operator=(Query&&) = delete;
+
+  ~Query()
+  {
+    GL_ASSERT(api::deleteQuerie(1, &m_handle));
+  }
+
+  // ReSharper disable once CppMemberFunctionMayBeConst
+  void begin()
+  {
+    GL_ASSERT(api::beginQuery(Target, m_handle));
+  }
+
+  // ReSharper disable once CppMemberFunctionMayBeConst
+  void end()
+  {
+    GL_ASSERT(api::endQuery(Target));
+  }
+
+  //! Returns the query result if it is available, without stalling the pipeline
+  [[nodiscard]] std::optional<uint64_t> tryGetResult() const
+  {
+    uint32_t available = 0;
+    GL_ASSERT(api::getQueryObject(m_handle, api::QueryObjectParameterName::QueryResultAvailable, &available));
+    if(available == 0)
+      return std::nullopt;
+
+    uint64_t result = 0;
+    GL_ASSERT(api::getQueryObject(m_handle, api::QueryObjectParameterName::QueryResult, &result));
+    return result;
+  }
+
+  [[nodiscard]] auto getHandle() const
+  {
+    return m_handle;
+  }
+
+private:
+  uint32_t m_handle = 0;
+};
+} // namespace gl
@@ -33,6 +33,9 @@ template<api::ProgramInterface _Type, api::BufferTargetARB _Target>
 class ProgramBlock;
 class Uniform;
 class Program;
+// NOLINTNEXTLINE(bugprone-reserved-identifier)
+template<api::QueryTarget _Target>
+class Query;
 class RenderState;
 // NOLINTNEXTLINE(bugprone-reserved-identifier)
 template<api::ShaderType _Type>
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "query.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace gl
+{
+//! Measures the GPU time spent between begin() and end(), using a ring of queries so that the results are read a few
+//! frames late instead of stalling the pipeline. Time elapsed queries cannot be nested.
+class TimerQuery final
+{
+public:
+  //! The number of measurements which may be in flight
+  static constexpr size_t Latency = 4;
+
+  using Clock = std::chrono::steady_clock;
+
+  explicit TimerQuery(const std::string& label = {})
+  {
+    for(size_t i = 0; i < Latency; ++i)
+      m_slots[i].query = std::make_unique<Query<api::QueryTarget::TimeElapsed>>(
+        label.empty() ? std::string{} : label + "/" + std::to_string(i));
+  }
+
+  //! Starts a measurement; if the GPU is too far behind, the measurement is dropped
+  void begin()
+  {
+    Expects(!m_active);
+    auto& slot = m_slots[m_next];
+    if(slot.pending)
+    {
+      ++m_dropped;
+      return;
+    }
+
+    slot.issued = Clock::now();
+    slot.query->begin();
+    m_active = true;
+  }
+
+  void end()
+  {
+    if(!m_active)
+      return;
+
+    auto& slot = m_slots[m_next];
+    slot.query->end();
+    slot.pending = true;
+    m_next = (m_next + 1) % Latency;
+    m_active = false;
+  }
+
+  //! Calls @a fn with the time a measurement began on the CPU and its GPU duration, for all measurements which have
+  //! become available, oldest first
+  template<typename F>
+  void collect(const F& fn)
+  {
+    for(size_t i = 0; i < Latency; ++i)
+    {
+      auto& slot = m_slots[(m_next + i) % Latency];
+      if(!slot.pending)
+        continue;
+
+      const auto result = slot.query->tryGetResult();
+      if(!result.has_value())
+        return;
+
+      slot.pending = false;
+      fn(slot.issued, std::chrono::nanoseconds{*result});
+    }
+  }
+
+  //! The number of measurements dropped because all queries were still in flight
+  [[nodiscard]] size_t getDropped() const noexcept
+  {
+    return m_dropped;
+  }
+
+private:
+  struct Slot
+  {
+    std::unique_ptr<Query<api::QueryTarget::TimeElapsed>> query;
+    Clock::time_point issued{};
+    bool pending = false;
+  };
+
+  std::array<Slot, Latency> m_slots{};
+  size_t m_next = 0;
+  bool m_active = false;
+  size_t m_dropped = 0;
+};
+} // namespace gl
@@ -145,16 +145,55 @@ struct TypeTraits<glm::vec4>
   static constexpr api::PixelType PixelType = api::PixelType::Float;
   static constexpr api::core::SizeType ElementCount = 4;
 };
+template<typename T, glm::precision P>
+struct TypeTraits<glm::tvec2<T, P>>
+{
+  static constexpr api::VertexAttribType VertexAttribType = TypeTraits<T>::VertexAttribType;
+  static constexpr api::PixelType PixelType = TypeTraits<T>::PixelType;
+  static constexpr api::core::SizeType ElementCount = 2;
+};
+template<typename T, glm::precision P>
+struct TypeTraits<glm::tvec3<T, P>>
+{
+  static constexpr api::VertexAttribType VertexAttribType = TypeTraits<T>::VertexAttribType;
+  static constexpr api::PixelType PixelType = TypeTraits<T>::PixelType;
+  static constexpr api::core::SizeType ElementCount = 3;
+};
+template<typename T, glm::precision P>
+struct TypeTraits<glm::tvec4<T, P>>
+{
+  static constexpr api::VertexAttribType VertexAttribType = TypeTraits<T>::VertexAttribType;
+  static constexpr api::PixelType PixelType = TypeTraits<T>::PixelType;
+  static constexpr api::core::SizeType ElementCount = 4;
+};
 #else
-template<int N>
-struct TypeTraits<glm::vec<N, float, glm::defaultp>>
+template<int N, typename T>
+struct TypeTraits<glm::vec<N, T, glm::defaultp>>
 {
-  static constexpr api::VertexAttribType VertexAttribType = api::VertexAttribType::Float;
-  static constexpr api::PixelType PixelType = api::PixelType::Float;
+  static constexpr api::VertexAttribType VertexAttribType = TypeTraits<T>::VertexAttribType;
+  static constexpr api::PixelType PixelType = TypeTraits<T>::PixelType;
   static constexpr api::core::SizeType ElementCount = N;
 };
 #endif
 
+//! A signed 10/10/10/2 packed vector, e.g. for normalized vertex normals
+struct Int2101010Rev
+{
+  uint32_t value = 0;
+
+  bool operator==(const Int2101010Rev& rhs) const noexcept
+  {
+    return value == rhs.value;
+  }
+};
+
+template<>
+struct TypeTraits<Int2101010Rev>
+{
+  static constexpr api::VertexAttribType VertexAttribType = api::VertexAttribType::Int2101010Rev;
+  static constexpr api::core::SizeType ElementCount = 4;
+};
+
 template<>
 struct TypeTraits<api::core::Half>
 {
@@ -93,6 +93,13 @@ public:
     unbind();
   }
 
+  void drawIndexBufferInstanced(api::PrimitiveType primitiveType, const api::core::SizeType instanceCount)
+  {
+    bind();
+    m_indexBuffer->drawElementsInstanced(primitiveType, instanceCount);
+    unbind();
+  }
+
 private:
   IndexBufferPtr m_indexBuffer;
   VertexBuffers m_vertexBuffers;
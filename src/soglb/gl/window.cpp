@@ -9,6 +9,7 @@
 
 namespace gl
 {
+#ifndef SOGLB_NULL_BACKEND
 namespace
 {
 void glErrorCallback(const int err, const gsl::czstring msg)
@@ -16,11 +17,17 @@ void glErrorCallback(const int err, const gsl::czstring msg)
   BOOST_LOG_TRIVIAL(error) << "glfw Error " << err << ": " << msg;
 }
 } // namespace
+#endif
 
-Window::Window(const bool fullscreen, const glm::ivec2& resolution)
+Window::Window([[maybe_unused]] const bool fullscreen, const glm::ivec2& resolution)
     : m_windowPos{0, 0}
     , m_windowSize{resolution}
 {
+#ifdef SOGLB_NULL_BACKEND
+  // there is nothing to present, so neither GLFW nor a window is needed
+  initializeGl();
+  updateWindowSize();
+#else
   glfwSetErrorCallback(&glErrorCallback);
 
   if(glfwInit() != GLFW_TRUE)
@@ -76,11 +83,15 @@ Window::Window(const bool fullscreen, const glm::ivec2& resolution)
 #ifdef NDEBUG
   glfwSetInputMode(m_window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 #endif
+#endif
 }
 
 void Window::setVsync(const bool enable)
 {
   m_vsync = enable;
+  if(m_window == nullptr)
+    return;
+
   glfwSwapInterval(enable ? 1 : 0);
 }
 
@@ -91,8 +102,9 @@ bool Window::isVsync() const
 
 void Window::updateWindowSize()
 {
-  glm::ivec2 tmpSize;
-  glfwGetFramebufferSize(m_window, &tmpSize.x, &tmpSize.y);
+  glm::ivec2 tmpSize = m_windowSize;
+  if(m_window != nullptr)
+    glfwGetFramebufferSize(m_window, &tmpSize.x, &tmpSize.y);
 
   if(tmpSize == m_viewport)
     return;
@@ -103,12 +115,15 @@ void Window::updateWindowSize()
 
 void Window::swapBuffers() const
 {
+  if(m_window == nullptr)
+    return;
+
   glfwSwapBuffers(m_window);
 }
 
 void Window::setFullscreen()
 {
-  if(m_isFullscreen)
+  if(m_isFullscreen || m_window == nullptr)
     return;
 
   const auto mode = glfwGetVideoMode(glfwGetPrimaryMonitor());
@@ -127,7 +142,7 @@ void Window::setFullscreen()
 
 void Window::setWindowed()
 {
-  if(!m_isFullscreen)
+  if(!m_isFullscreen || m_window == nullptr)
     return;
 
   glfwSetWindowMonitor(m_window, nullptr, m_windowPos.x, m_windowPos.y, m_windowSize.x, m_windowSize.y, GLFW_DONT_CARE);
@@ -19,6 +19,9 @@ public:
 
   [[nodiscard]] bool windowShouldClose() const
   {
+    if(m_window == nullptr)
+      return false;
+
     glfwPollEvents();
 
     return glfwWindowShouldClose(m_window) == GLFW_TRUE;
@@ -26,6 +29,7 @@ public:
 
   void swapBuffers() const;
 
+  //! Null if there is no window, i.e. when using the null backend
   [[nodiscard]] GLFWwindow* getWindow() const
   {
     return m_window;
@@ -0,0 +1,195 @@
+#define BOOST_TEST_MODULE soglb_test
+
+#include "gl/api/gl.hpp"
+#include "gl/null/statistics.h"
+#include "gl/timerquery.h"
+
+#include <boost/test/included/unit_test.hpp>
+#include <cstring>
+#include <string>
+
+using namespace gl;
+
+namespace
+{
+uint32_t createShader(const api::ShaderType type, const std::string& source)
+{
+  const auto shader = api::createShader(type);
+  const char* const sources[] = {source.c_str()};
+  api::shaderSource(shader, 1, sources, nullptr);
+  api::compileShader(shader);
+  return shader;
+}
+
+std::string getResourceName(const uint32_t program, const api::ProgramInterface what, const uint32_t index)
+{
+  char name[64];
+  api::getProgramResourceName(program, what, index, sizeof(name), nullptr, name);
+  return name;
+}
+
+int32_t getResourceProperty(const uint32_t program,
+                            const api::ProgramInterface what,
+                            const uint32_t index,
+                            const api::ProgramResourceProperty property)
+{
+  int32_t result = 0;
+  api::getProgramResource(program, what, index, 1, &property, 1, nullptr, &result);
+  return result;
+}
+
+int32_t getResourceCount(const uint32_t program, const api::ProgramInterface what)
+{
+  int32_t result = 0;
+  api::getProgramInterface(program, what, api::ProgramInterfacePName::ActiveResources, &result);
+  return result;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(null_backend_tests)
+
+BOOST_AUTO_TEST_CASE(test_program_reflection)
+{
+  const auto vertexShader = createShader(api::ShaderType::VertexShader, R"(#version 450
+#define SKELETAL
+layout(location=0) in vec3 a_position;
+layout(location=3) in vec2 a_uv;
+layout(std140, binding=0) uniform Transform {
+  mat4 u_modelMatrix;
+};
+#ifdef SKELETAL
+layout(std140, binding=2) readonly buffer BoneTransform {
+  mat4 u_bones[];
+};
+#else
+uniform mat4 u_notSkeletal;
+#endif
+// uniform float u_commentedOut;
+uniform float u_time;
+uniform vec4 u_colors[3];
+)");
+  const auto fragmentShader = createShader(api::ShaderType::FragmentShader, R"(#version 450
+layout(binding=1) uniform sampler2D u_diffuse;
+uniform float u_time;
+layout(location=0) out vec4 out_color;
+)");
+
+  const auto program = api::createProgram();
+  api::attachShader(program, vertexShader);
+  api::attachShader(program, fragmentShader);
+  api::linkProgram(program);
+
+  int32_t linkStatus = 0;
+  api::getProgram(program, api::ProgramPropertyARB::LinkStatus, &linkStatus);
+  BOOST_CHECK_EQUAL(linkStatus, 1);
+
+  BOOST_REQUIRE_EQUAL(getResourceCount(program, api::ProgramInterface::Uniform), 3);
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::Uniform, 0), "u_time");
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::Uniform, 1), "u_colors");
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::Uniform, 2), "u_diffuse");
+  BOOST_CHECK_EQUAL(
+    getResourceProperty(program, api::ProgramInterface::Uniform, 1, api::ProgramResourceProperty::ArraySize), 3);
+  // implicit locations don't overlap, even for arrays
+  BOOST_CHECK_EQUAL(
+    getResourceProperty(program, api::ProgramInterface::Uniform, 0, api::ProgramResourceProperty::Location), 0);
+  BOOST_CHECK_EQUAL(
+    getResourceProperty(program, api::ProgramInterface::Uniform, 1, api::ProgramResourceProperty::Location), 1);
+  BOOST_CHECK_EQUAL(
+    getResourceProperty(program, api::ProgramInterface::Uniform, 2, api::ProgramResourceProperty::Location), 4);
+
+  BOOST_REQUIRE_EQUAL(getResourceCount(program, api::ProgramInterface::UniformBlock), 1);
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::UniformBlock, 0), "Transform");
+  BOOST_REQUIRE_EQUAL(getResourceCount(program, api::ProgramInterface::ShaderStorageBlock), 1);
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::ShaderStorageBlock, 0), "BoneTransform");
+  BOOST_CHECK_EQUAL(getResourceProperty(
+                      program, api::ProgramInterface::ShaderStorageBlock, 0, api::ProgramResourceProperty::BufferBinding),
+                    2);
+
+  BOOST_REQUIRE_EQUAL(getResourceCount(program, api::ProgramInterface::ProgramInput), 2);
+  BOOST_CHECK_EQUAL(
+    getResourceProperty(program, api::ProgramInterface::ProgramInput, 1, api::ProgramResourceProperty::Location), 3);
+  BOOST_REQUIRE_EQUAL(getResourceCount(program, api::ProgramInterface::ProgramOutput), 1);
+  BOOST_CHECK_EQUAL(getResourceName(program, api::ProgramInterface::ProgramOutput, 0), "out_color");
+
+  api::deleteProgram(program);
+  api::deleteShader(vertexShader);
+  api::deleteShader(fragmentShader);
+}
+
+BOOST_AUTO_TEST_CASE(test_resources)
+{
+  uint32_t buffer = 0;
+  api::createBuffers(1, &buffer);
+  BOOST_CHECK_NE(buffer, 0u);
+
+  const uint32_t data[] = {1, 2, 3, 4};
+  api::namedBufferData(buffer, sizeof(data), data, api::BufferUsageARB::StaticDraw);
+  const auto mapped = api::mapNamedBuffer(buffer, api::BufferAccessARB::ReadWrite);
+  BOOST_REQUIRE(mapped != nullptr);
+  BOOST_CHECK_EQUAL(std::memcmp(mapped, data, sizeof(data)), 0);
+  BOOST_CHECK(api::unmapNamedBuffer(buffer));
+
+  uint32_t texture = 0;
+  api::createTextures(api::TextureTarget::Texture2d, 1, &texture);
+  BOOST_CHECK_NE(texture, buffer);
+  api::textureStorage2D(texture, 1, api::InternalFormat::Rgba8, 64, 32);
+  int32_t width = 0;
+  api::getTextureParameter(texture, api::GetTextureParameter::TextureWidth, &width);
+  BOOST_CHECK_EQUAL(width, 64);
+
+  const auto statistics = null::getStatistics();
+  BOOST_CHECK_EQUAL(statistics.bufferBytes, sizeof(data));
+  BOOST_CHECK_EQUAL(statistics.textureTexels, 64u * 32u);
+
+  api::deleteBuffers(1, &buffer);
+  api::deleteTextures(1, &texture);
+  BOOST_CHECK_EQUAL(null::getStatistics().bufferBytes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_call_statistics)
+{
+  null::resetCallStatistics();
+  api::drawArrays(api::PrimitiveType::Triangles, 0, 3);
+  api::drawArrays(api::PrimitiveType::Triangles, 0, 3);
+  api::clear(api::ClearBufferMask::ColorBufferBit);
+
+  const auto statistics = null::getStatistics();
+  BOOST_CHECK_EQUAL(statistics.getTotalCalls(), 3u);
+  BOOST_CHECK_EQUAL(statistics.getDrawCalls(), 2u);
+  BOOST_CHECK_EQUAL(statistics.calls.at("glDrawArrays"), 2u);
+  BOOST_CHECK_EQUAL(statistics.uploadedBufferBytes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_timer_query)
+{
+  TimerQuery timer{"timer"};
+
+  // the results of the null backend are available immediately
+  size_t results = 0;
+  for(size_t i = 0; i < 2 * TimerQuery::Latency; ++i)
+  {
+    const auto before = TimerQuery::Clock::now();
+    timer.begin();
+    timer.end();
+    timer.collect([&results, &before](const TimerQuery::Clock::time_point& issued, const std::chrono::nanoseconds&) {
+      BOOST_CHECK(issued >= before);
+      ++results;
+    });
+  }
+  BOOST_CHECK_EQUAL(results, 2 * TimerQuery::Latency);
+  BOOST_CHECK_EQUAL(timer.getDropped(), 0u);
+
+  // without collecting the results, all queries stay in flight
+  for(size_t i = 0; i < TimerQuery::Latency + 1; ++i)
+  {
+    timer.begin();
+    timer.end();
+  }
+  BOOST_CHECK_EQUAL(timer.getDropped(), 1u);
+
+  results = 0;
+  timer.collect([&results](const TimerQuery::Clock::time_point&, const std::chrono::nanoseconds&) { ++results; });
+  BOOST_CHECK_EQUAL(results, TimerQuery::Latency);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
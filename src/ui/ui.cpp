@@ -6,6 +6,7 @@
 #include "render/scene/mesh.h"
 #include "render/scene/names.h"
 #include "render/scene/rendercontext.h"
+#include "util/profiler.h"
 
 #include <gl/debuggroup.h>
 #include <gl/vertexarray.h>
@@ -160,6 +161,7 @@ void Ui::drawBox(const glm::ivec2& xy, const glm::ivec2& size, const gl::SRGBA8&
 
 void Ui::render(const glm::vec2& screenSize)
 {
+  UTIL_PROFILE_ZONE("ui-render");
   SOGLB_DEBUGGROUP("ui");
   render::scene::RenderContext ctx{render::scene::RenderMode::Full, std::nullopt};
   for(const auto& mesh : m_meshes)
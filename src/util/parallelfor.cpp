@@ -0,0 +1,95 @@
+#include "parallelfor.h"
+
+#include <utility>
+
+namespace util
+{
+WorkerPool::WorkerPool(const size_t threadCount)
+{
+  m_threads.reserve(threadCount);
+  for(size_t i = 0; i < threadCount; ++i)
+    m_threads.emplace_back([this, i]() { workerLoop(i); });
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_wakeup.notify_all();
+
+  for(auto& thread : m_threads)
+    thread.join();
+}
+
+WorkerPool& WorkerPool::getShared()
+{
+  static WorkerPool pool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+  return pool;
+}
+
+void WorkerPool::run(const size_t count, const std::function<void(size_t)>& fn, const size_t maxWorkers)
+{
+  std::lock_guard runLock{m_runMutex};
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_job = &fn;
+    m_count = count;
+    m_next = 0;
+    m_workers = std::min(maxWorkers, m_threads.size());
+    m_busy = m_workers;
+    m_error = nullptr;
+    ++m_generation;
+  }
+  m_wakeup.notify_all();
+
+  work();
+
+  std::unique_lock lock{m_mutex};
+  m_done.wait(lock, [this]() { return m_busy == 0; });
+  m_job = nullptr;
+  if(const auto error = std::exchange(m_error, nullptr); error != nullptr)
+    std::rethrow_exception(error);
+}
+
+void WorkerPool::workerLoop(const size_t index)
+{
+  uint64_t generation = 0;
+  std::unique_lock lock{m_mutex};
+  while(true)
+  {
+    m_wakeup.wait(lock, [this, &generation]() { return m_stop || m_generation != generation; });
+    if(m_stop)
+      return;
+
+    generation = m_generation;
+    // a job only ends when all of its workers are done, so a worker cannot miss a job it takes part in
+    if(index >= m_workers)
+      continue;
+
+    lock.unlock();
+    work();
+    lock.lock();
+
+    if(--m_busy == 0)
+      m_done.notify_all();
+  }
+}
+
+void WorkerPool::work()
+{
+  try
+  {
+    for(auto i = m_next++; i < m_count; i = m_next++)
+      (*m_job)(i);
+  }
+  catch(...)
+  {
+    std::lock_guard lock{m_mutex};
+    if(m_error == nullptr)
+      m_error = std::current_exception();
+  }
+}
+} // namespace util
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+//! A fixed set of threads that is kept alive between jobs, so that a job does not need to spawn threads.
+class WorkerPool final
+{
+public:
+  explicit WorkerPool(size_t threadCount);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  void operator=(const WorkerPool&) = delete;
+  void operator=(WorkerPool&&) = delete;
+
+  //! The pool used by parallelFor, with one thread less than the hardware supports, as the calling thread works, too
+  static WorkerPool& getShared();
+
+  [[nodiscard]] size_t getThreadCount() const noexcept
+  {
+    return m_threads.size();
+  }
+
+  //! Calls @a fn for every index in [0, count) on the calling thread and up to @a maxWorkers pool threads, and returns
+  //! when all calls are done. If @a fn throws, the first exception is rethrown. Must not be called from within a job.
+  void run(size_t count, const std::function<void(size_t)>& fn, size_t maxWorkers);
+
+private:
+  void workerLoop(size_t index);
+  void work();
+
+  std::vector<std::thread> m_threads;
+  //! Serializes concurrent run() calls
+  std::mutex m_runMutex;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::condition_variable m_done;
+  bool m_stop = false;
+  uint64_t m_generation = 0;
+  const std::function<void(size_t)>* m_job = nullptr;
+  size_t m_count = 0;
+  std::atomic<size_t> m_next{0};
+  //! The pool threads with an index below this take part in the current job
+  size_t m_workers = 0;
+  //! The pool threads still working on the current job
+  size_t m_busy = 0;
+  std::exception_ptr m_error;
+};
+
+//! Calls @a fn for every index in [0, count), distributed over up to @a maxThreads threads including the calling one.
+//!
+//! The calls for different indices must not modify shared data. If @a fn throws, the first exception is rethrown
+//! after all threads have finished. The threads are taken from WorkerPool::getShared().
+template<typename F>
+void parallelFor(const size_t count, const F& fn, const size_t maxThreads = std::thread::hardware_concurrency())
+{
+  const auto threadCount = std::min(std::max(maxThreads, size_t{1}), count);
+  if(threadCount <= 1)
+  {
+    for(size_t i = 0; i < count; ++i)
+      fn(i);
+    return;
+  }
+
+  WorkerPool::getShared().run(
+    count, [&fn](const size_t i) { fn(i); }, threadCount - 1);
+}
+} // namespace util
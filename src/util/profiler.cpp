@@ -0,0 +1,275 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <bitset>
+#include <boost/log/trivial.hpp>
+#include <boost/throw_exception.hpp>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace util::profiler
+{
+namespace detail
+{
+std::atomic<bool> enabled{false};
+}
+
+namespace
+{
+// the number of zones kept per thread; older zones are overwritten
+constexpr size_t MaxEvents = size_t{1} << 18u;
+
+struct Event
+{
+  gsl::czstring name;
+  Clock::time_point start;
+  Clock::time_point end;
+};
+
+struct ThreadBuffer
+{
+  explicit ThreadBuffer(const size_t id, const bool gpu)
+      : id{id}
+      , gpu{gpu}
+  {
+  }
+
+  const size_t id;
+  //! Whether the buffer holds GPU zones instead of the zones of a thread
+  const bool gpu;
+  std::mutex mutex{};
+  std::vector<Event> events{};
+  //! The index of the oldest event once the buffer is full
+  size_t next = 0;
+
+  void record(const gsl::czstring name, const Clock::time_point& start, const Clock::time_point& end)
+  {
+    std::lock_guard lock{mutex};
+    if(events.size() < MaxEvents)
+    {
+      events.emplace_back(Event{name, start, end});
+      return;
+    }
+
+    events[next] = Event{name, start, end};
+    next = (next + 1) % MaxEvents;
+  }
+
+  template<typename F>
+  void forEach(const F& fn) const
+  {
+    for(size_t i = 0; i < events.size(); ++i)
+      fn(events[(next + i) % events.size()]);
+  }
+};
+
+struct Registry
+{
+  std::mutex mutex{};
+  // buffers outlive their threads, so that the zones of finished threads can still be exported
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers{};
+};
+
+Registry& getRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+std::shared_ptr<ThreadBuffer> registerBuffer(const bool gpu)
+{
+  auto& registry = getRegistry();
+  std::lock_guard lock{registry.mutex};
+  return registry.buffers.emplace_back(std::make_shared<ThreadBuffer>(registry.buffers.size(), gpu));
+}
+
+ThreadBuffer& getThreadBuffer()
+{
+  thread_local const std::shared_ptr<ThreadBuffer> buffer = registerBuffer(false);
+  return *buffer;
+}
+
+ThreadBuffer& getGpuBuffer()
+{
+  static const std::shared_ptr<ThreadBuffer> buffer = registerBuffer(true);
+  return *buffer;
+}
+
+struct Consumers
+{
+  std::mutex mutex{};
+  std::bitset<3> enabled{};
+};
+
+Consumers& getConsumers()
+{
+  static Consumers consumers;
+  return consumers;
+}
+
+void writeEscaped(std::ofstream& file, const gsl::czstring str)
+{
+  for(auto c = str; *c != '\0'; ++c)
+  {
+    if(*c == '"' || *c == '\\')
+      file << '\\';
+    file << *c;
+  }
+}
+} // namespace
+
+void detail::record(const gsl::czstring name, const Clock::time_point& start, const Clock::time_point& end)
+{
+  getThreadBuffer().record(name, start, end);
+}
+
+void recordGpuZone(const gsl::czstring name, const Clock::time_point& start, const Clock::duration& duration)
+{
+  if(isEnabled())
+    getGpuBuffer().record(name, start, start + duration);
+}
+
+bool isEnabled(const Consumer consumer)
+{
+  auto& consumers = getConsumers();
+  std::lock_guard lock{consumers.mutex};
+  return consumers.enabled.test(static_cast<size_t>(consumer));
+}
+
+void setEnabled(const Consumer consumer, const bool enabled)
+{
+  auto& consumers = getConsumers();
+  std::lock_guard lock{consumers.mutex};
+  consumers.enabled.set(static_cast<size_t>(consumer), enabled);
+
+  const auto anyEnabled = consumers.enabled.any();
+  if(detail::enabled.exchange(anyEnabled) != anyEnabled)
+    BOOST_LOG_TRIVIAL(info) << "Profiler " << (anyEnabled ? "enabled" : "disabled");
+}
+
+void clear()
+{
+  auto& registry = getRegistry();
+  std::lock_guard lock{registry.mutex};
+  for(const auto& buffer : registry.buffers)
+  {
+    std::lock_guard bufferLock{buffer->mutex};
+    buffer->events.clear();
+    buffer->next = 0;
+  }
+}
+
+std::vector<ZoneSummary> getSummary(const Clock::duration& window)
+{
+  const auto since = Clock::now() - window;
+
+  std::map<std::pair<bool, gsl::czstring>, ZoneSummary> summaries;
+  auto& registry = getRegistry();
+  std::lock_guard lock{registry.mutex};
+  for(const auto& buffer : registry.buffers)
+  {
+    std::lock_guard bufferLock{buffer->mutex};
+    buffer->forEach([&summaries, &since, &buffer](const Event& event) {
+      if(event.end < since)
+        return;
+
+      auto& summary = summaries[{buffer->gpu, event.name}];
+      const auto duration = event.end - event.start;
+      ++summary.calls;
+      summary.total += duration;
+      summary.max = std::max(summary.max, duration);
+    });
+  }
+
+  // identical literals in different translation units may have different addresses
+  std::map<std::pair<bool, std::string>, ZoneSummary> byName;
+  for(const auto& [key, summary] : summaries)
+  {
+    auto& merged = byName[key];
+    merged.calls += summary.calls;
+    merged.total += summary.total;
+    merged.max = std::max(merged.max, summary.max);
+  }
+
+  std::vector<ZoneSummary> result;
+  result.reserve(byName.size());
+  for(auto& [key, summary] : byName)
+  {
+    std::tie(summary.gpu, summary.name) = key;
+    result.emplace_back(std::move(summary));
+  }
+  std::sort(result.begin(), result.end(), [](const ZoneSummary& a, const ZoneSummary& b) {
+    return a.total > b.total;
+  });
+  return result;
+}
+
+void writeChromeTrace(const std::filesystem::path& filename)
+{
+  std::ofstream file{filename, std::ios::out | std::ios::trunc};
+  if(!file.is_open())
+  {
+    BOOST_LOG_TRIVIAL(error) << "Failed to write profiler trace " << filename;
+    BOOST_THROW_EXCEPTION(std::runtime_error("Failed to write profiler trace"));
+  }
+
+  const auto toMicroseconds = [](const Clock::duration& d) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(d).count();
+  };
+
+  auto& registry = getRegistry();
+  std::lock_guard lock{registry.mutex};
+
+  auto epoch = Clock::time_point::max();
+  for(const auto& buffer : registry.buffers)
+  {
+    std::lock_guard bufferLock{buffer->mutex};
+    buffer->forEach([&epoch](const Event& event) { epoch = std::min(epoch, event.start); });
+  }
+
+  size_t events = 0;
+  const auto beginEvent = [&file, &events]() { file << (events++ == 0 ? "\n" : ",\n"); };
+
+  // GPU zones are placed where their commands were issued, so zones of different passes may overlap; each pass gets
+  // its own track
+  std::map<std::string, size_t> gpuTracks;
+  const auto getTrack = [&gpuTracks, &registry, &beginEvent, &file](const ThreadBuffer& buffer, const Event& event) {
+    if(!buffer.gpu)
+      return buffer.id;
+
+    const auto [it, inserted] = gpuTracks.emplace(event.name, registry.buffers.size() + gpuTracks.size());
+    if(inserted)
+    {
+      beginEvent();
+      file << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << it->second << R"(,"args":{"name":"GPU )";
+      writeEscaped(file, event.name);
+      file << R"("}})";
+    }
+    return it->second;
+  };
+
+  file << std::fixed << std::setprecision(3);
+  file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+  for(const auto& buffer : registry.buffers)
+  {
+    std::lock_guard bufferLock{buffer->mutex};
+    buffer->forEach([&file, &epoch, &buffer, &toMicroseconds, &beginEvent, &getTrack](const Event& event) {
+      const auto track = getTrack(*buffer, event);
+      beginEvent();
+      file << R"({"name":")";
+      writeEscaped(file, event.name);
+      file << R"(","ph":"X","pid":1,"tid":)" << track << R"(,"ts":)" << toMicroseconds(event.start - epoch)
+           << R"(,"dur":)" << toMicroseconds(event.end - event.start) << "}";
+    });
+  }
+  file << "\n]}\n";
+
+  BOOST_LOG_TRIVIAL(info) << "Wrote " << events << " trace events to " << filename;
+}
+} // namespace util::profiler
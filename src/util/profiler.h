@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <gsl-lite.hpp>
+#include <string>
+#include <vector>
+
+namespace util::profiler
+{
+using Clock = std::chrono::steady_clock;
+
+namespace detail
+{
+extern std::atomic<bool> enabled;
+
+extern void record(gsl::czstring name, const Clock::time_point& start, const Clock::time_point& end);
+} // namespace detail
+
+#define UTIL_PROFILER_DETAIL_PASTE(x, y) x##y
+#define UTIL_PROFILER_DETAIL_CAT(x, y) UTIL_PROFILER_DETAIL_PASTE(x, y)
+
+//! Measures the remainder of the enclosing scope as a zone named @a name, which must be a string literal
+#define UTIL_PROFILE_ZONE(name)                                                                     \
+  [[maybe_unused]] const ::util::profiler::Zone UTIL_PROFILER_DETAIL_CAT(utilProfileZone, __LINE__) \
+  {                                                                                                 \
+    name                                                                                            \
+  }
+
+//! The users of the recorded zones, each of which enables recording independently of the others
+enum class Consumer
+{
+  Benchmark,
+  DebugOverlay,
+  Trace,
+};
+
+//! Whether zones are recorded, i.e. whether any consumer is enabled
+[[nodiscard]] inline bool isEnabled() noexcept
+{
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+[[nodiscard]] extern bool isEnabled(Consumer consumer);
+
+extern void setEnabled(Consumer consumer, bool enabled);
+
+//! Records a zone measured on the GPU, placed at the time its commands were issued
+extern void recordGpuZone(gsl::czstring name, const Clock::time_point& start, const Clock::duration& duration);
+
+//! Discards the recorded zones of all threads
+extern void clear();
+
+struct ZoneSummary
+{
+  std::string name;
+  bool gpu = false;
+  size_t calls = 0;
+  Clock::duration total{0};
+  Clock::duration max{0};
+};
+
+//! Summarizes the zones that ended within the last @a window, ordered by their total duration
+[[nodiscard]] extern std::vector<ZoneSummary> getSummary(const Clock::duration& window);
+
+//! Writes the recorded zones of all threads as trace events, to be viewed with chrome://tracing or Perfetto
+extern void writeChromeTrace(const std::filesystem::path& filename);
+
+//! Records the time between construction and destruction; when profiling is disabled, this only checks a flag
+class Zone final
+{
+public:
+  explicit Zone(const gsl::czstring name)
+      : m_name{isEnabled() ? name : nullptr}
+  {
+    if(m_name != nullptr)
+      m_start = Clock::now();
+  }
+
+  Zone(const Zone&) = delete;
+
+  Zone(Zone&&) noexcept = delete;
+
+  Zone& operator=(const Zone&) = delete;
+
+  Zone& operator=(Zone&&) = delete;
+
+  ~Zone()
+  {
+    if(m_name != nullptr)
+      detail::record(m_name, m_start, Clock::now());
+  }
+
+private:
+  const gsl::czstring m_name;
+  Clock::time_point m_start{};
+};
+} // namespace util::profiler
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <boost/assert.hpp>
+#include <memory>
+
+namespace util
+{
+//! A lock-free queue for exactly one producer thread and one consumer thread. Neither side allocates, locks or blocks,
+//! so the consumer may be a real-time thread like an audio callback.
+template<typename T>
+class RingBuffer final
+{
+public:
+  //! @a capacity must be a power of two
+  explicit RingBuffer(const size_t capacity)
+      : m_data{std::make_unique<T[]>(capacity)}
+      , m_capacity{capacity}
+  {
+    BOOST_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+  }
+
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer(RingBuffer&&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+  RingBuffer& operator=(RingBuffer&&) = delete;
+  ~RingBuffer() = default;
+
+  [[nodiscard]] size_t getCapacity() const noexcept
+  {
+    return m_capacity;
+  }
+
+  //! Producer side: the number of elements which can be written without overwriting unread ones
+  [[nodiscard]] size_t getWriteAvailable() const noexcept
+  {
+    const auto used = m_writePosition.load(std::memory_order_relaxed) - m_readPosition.load(std::memory_order_acquire);
+    return m_capacity - used;
+  }
+
+  //! Producer side: the total number of elements written so far
+  [[nodiscard]] size_t getWritePosition() const noexcept
+  {
+    return m_writePosition.load(std::memory_order_relaxed);
+  }
+
+  //! Producer side: writes up to @a count elements, returns the number of elements written
+  size_t write(const T* data, size_t count)
+  {
+    const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    count = std::min(count, getWriteAvailable());
+    for(size_t i = 0; i < count;)
+    {
+      const auto offset = (writePosition + i) & (m_capacity - 1);
+      const auto span = std::min(count - i, m_capacity - offset);
+      std::copy_n(data + i, span, &m_data[offset]);
+      i += span;
+    }
+    m_writePosition.store(writePosition + count, std::memory_order_release);
+    return count;
+  }
+
+  //! Consumer side: the number of elements which can be read
+  [[nodiscard]] size_t getReadAvailable() const noexcept
+  {
+    return m_writePosition.load(std::memory_order_acquire) - m_readPosition.load(std::memory_order_relaxed);
+  }
+
+  //! Consumer side: passes up to @a count elements to @a fn as at most two contiguous spans of (data, count), then
+  //! releases them to the producer; returns the number of elements consumed
+  template<typename F>
+  size_t consume(size_t count, const F& fn)
+  {
+    const auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    count = std::min(count, getReadAvailable());
+    for(size_t i = 0; i < count;)
+    {
+      const auto offset = (readPosition + i) & (m_capacity - 1);
+      const auto span = std::min(count - i, m_capacity - offset);
+      fn(static_cast<const T*>(&m_data[offset]), span);
+      i += span;
+    }
+    m_readPosition.store(readPosition + count, std::memory_order_release);
+    return count;
+  }
+
+  //! Consumer side: drops all elements written before the producer reached @a writePosition
+  void discardUntil(const size_t writePosition)
+  {
+    BOOST_ASSERT(writePosition <= m_writePosition.load(std::memory_order_acquire));
+    if(writePosition > m_readPosition.load(std::memory_order_relaxed))
+      m_readPosition.store(writePosition, std::memory_order_release);
+  }
+
+private:
+  const std::unique_ptr<T[]> m_data;
+  const size_t m_capacity;
+  // positions increase monotonically and are wrapped on access
+  std::atomic<size_t> m_writePosition{0};
+  std::atomic<size_t> m_readPosition{0};
+};
+} // namespace util
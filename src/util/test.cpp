@@ -0,0 +1,225 @@
+#define BOOST_TEST_MODULE util_test
+
+#include "profiler.h"
+#include "ringbuffer.h"
+
+#include <array>
+#include <boost/test/included/unit_test.hpp>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+using namespace util;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::string readFile(const std::filesystem::path& filename)
+{
+  std::ifstream file{filename};
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+size_t countOccurrences(const std::string& haystack, const std::string& needle)
+{
+  size_t count = 0;
+  for(auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1))
+    ++count;
+  return count;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(profiler_tests)
+
+BOOST_AUTO_TEST_CASE(test_disabled_records_nothing)
+{
+  profiler::setEnabled(profiler::Consumer::Benchmark, false);
+  profiler::clear();
+  {
+    UTIL_PROFILE_ZONE("disabled");
+  }
+  BOOST_CHECK(profiler::getSummary(1h).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_summary)
+{
+  profiler::clear();
+  profiler::setEnabled(profiler::Consumer::Benchmark, true);
+  for(int i = 0; i < 3; ++i)
+  {
+    UTIL_PROFILE_ZONE("outer");
+    {
+      UTIL_PROFILE_ZONE("inner");
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+  std::thread{[]() {
+    UTIL_PROFILE_ZONE("inner");
+  }}.join();
+  profiler::setEnabled(profiler::Consumer::Benchmark, false);
+
+  const auto summary = profiler::getSummary(1h);
+  BOOST_REQUIRE_EQUAL(summary.size(), 2u);
+  // the enclosing zone takes longer than the one it encloses
+  BOOST_CHECK_EQUAL(summary[0].name, "outer");
+  BOOST_CHECK_EQUAL(summary[0].calls, 3u);
+  BOOST_CHECK(summary[0].total >= 3ms);
+  BOOST_CHECK_EQUAL(summary[1].name, "inner");
+  BOOST_CHECK_EQUAL(summary[1].calls, 4u);
+  BOOST_CHECK(summary[1].max >= 1ms);
+  BOOST_CHECK(summary[1].max <= summary[1].total);
+
+  BOOST_CHECK(profiler::getSummary(0s).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_consumers_are_independent)
+{
+  profiler::setEnabled(profiler::Consumer::DebugOverlay, true);
+  profiler::setEnabled(profiler::Consumer::Trace, true);
+  BOOST_CHECK(profiler::isEnabled());
+
+  // stopping a trace keeps the overlay's zones coming
+  profiler::setEnabled(profiler::Consumer::Trace, false);
+  BOOST_CHECK(profiler::isEnabled());
+  BOOST_CHECK(profiler::isEnabled(profiler::Consumer::DebugOverlay));
+  BOOST_CHECK(!profiler::isEnabled(profiler::Consumer::Trace));
+
+  profiler::setEnabled(profiler::Consumer::DebugOverlay, false);
+  BOOST_CHECK(!profiler::isEnabled());
+}
+
+BOOST_AUTO_TEST_CASE(test_chrome_trace)
+{
+  profiler::clear();
+  profiler::setEnabled(profiler::Consumer::Benchmark, true);
+  {
+    UTIL_PROFILE_ZONE("frame");
+    UTIL_PROFILE_ZONE("a \"quoted\" zone");
+  }
+  profiler::setEnabled(profiler::Consumer::Benchmark, false);
+
+  const auto filename = boost::unit_test::framework::current_test_case().p_name.get() + ".json";
+  profiler::writeChromeTrace(filename);
+  const auto trace = readFile(filename);
+  std::filesystem::remove(filename);
+
+  BOOST_CHECK_EQUAL(trace.rfind(R"({"displayTimeUnit":"ms","traceEvents":[)", 0), 0u);
+  BOOST_CHECK_EQUAL(countOccurrences(trace, R"("ph":"X")"), 2u);
+  BOOST_CHECK_EQUAL(countOccurrences(trace, R"("name":"frame")"), 1u);
+  BOOST_CHECK_EQUAL(countOccurrences(trace, R"("name":"a \"quoted\" zone")"), 1u);
+  // the earliest zone starts the trace
+  BOOST_CHECK(trace.find(R"("ts":0.000,)") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(test_gpu_zones)
+{
+  profiler::clear();
+  profiler::recordGpuZone("disabled", profiler::Clock::now(), 1ms);
+  profiler::setEnabled(profiler::Consumer::Benchmark, true);
+  {
+    UTIL_PROFILE_ZONE("pass");
+    profiler::recordGpuZone("pass", profiler::Clock::now(), 2ms);
+    profiler::recordGpuZone("pass", profiler::Clock::now(), 3ms);
+  }
+  profiler::setEnabled(profiler::Consumer::Benchmark, false);
+
+  // GPU zones are summarized separately from CPU zones of the same name
+  const auto summary = profiler::getSummary(1h);
+  BOOST_REQUIRE_EQUAL(summary.size(), 2u);
+  BOOST_CHECK(summary[0].gpu);
+  BOOST_CHECK_EQUAL(summary[0].name, "pass");
+  BOOST_CHECK_EQUAL(summary[0].calls, 2u);
+  BOOST_CHECK(summary[0].total == 5ms);
+  BOOST_CHECK(summary[0].max == 3ms);
+  BOOST_CHECK(!summary[1].gpu);
+
+  const auto filename = boost::unit_test::framework::current_test_case().p_name.get() + ".json";
+  profiler::writeChromeTrace(filename);
+  const auto trace = readFile(filename);
+  std::filesystem::remove(filename);
+
+  BOOST_CHECK_EQUAL(countOccurrences(trace, R"("ph":"X")"), 3u);
+  BOOST_CHECK_EQUAL(countOccurrences(trace, R"("args":{"name":"GPU pass"})"), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(ring_buffer_tests)
+
+BOOST_AUTO_TEST_CASE(test_wraparound)
+{
+  RingBuffer<int> buffer{8};
+  const std::array<int, 6> data{1, 2, 3, 4, 5, 6};
+  BOOST_CHECK_EQUAL(buffer.write(data.data(), data.size()), 6u);
+  BOOST_CHECK_EQUAL(buffer.getWriteAvailable(), 2u);
+  BOOST_CHECK_EQUAL(buffer.getReadAvailable(), 6u);
+
+  std::vector<int> read;
+  const auto append = [&read](const int* values, size_t n) { read.insert(read.end(), values, values + n); };
+  BOOST_CHECK_EQUAL(buffer.consume(4, append), 4u);
+  BOOST_CHECK((read == std::vector<int>{1, 2, 3, 4}));
+
+  // only the available space is written, wrapping around the end
+  BOOST_CHECK_EQUAL(buffer.write(data.data(), data.size()), 6u);
+  BOOST_CHECK_EQUAL(buffer.write(data.data(), data.size()), 0u);
+
+  // the wrapped elements are passed as two spans
+  size_t spans = 0;
+  read.clear();
+  const auto consumed = buffer.consume(100, [&spans, &append](const int* values, size_t n) {
+    ++spans;
+    append(values, n);
+  });
+  BOOST_CHECK_EQUAL(consumed, 8u);
+  BOOST_CHECK_EQUAL(spans, 2u);
+  BOOST_CHECK((read == std::vector<int>{5, 6, 1, 2, 3, 4, 5, 6}));
+  BOOST_CHECK_EQUAL(buffer.getReadAvailable(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_discard)
+{
+  RingBuffer<int> buffer{8};
+  const std::array<int, 3> data{1, 2, 3};
+  buffer.write(data.data(), data.size());
+  const auto position = buffer.getWritePosition();
+  buffer.write(data.data(), data.size());
+
+  buffer.discardUntil(position);
+  BOOST_CHECK_EQUAL(buffer.getReadAvailable(), 3u);
+  // discarding up to an older position keeps the unread elements
+  buffer.discardUntil(0);
+  BOOST_CHECK_EQUAL(buffer.getReadAvailable(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(test_threads)
+{
+  static constexpr int Count = 1000000;
+  RingBuffer<int> buffer{1024};
+
+  std::thread producer{[&buffer]() {
+    std::array<int, 100> chunk{};
+    for(int next = 0; next < Count;)
+    {
+      std::iota(chunk.begin(), chunk.end(), next);
+      const auto n = std::min(static_cast<int>(chunk.size()), Count - next);
+      next += static_cast<int>(buffer.write(chunk.data(), static_cast<size_t>(n)));
+    }
+  }};
+
+  int expected = 0;
+  bool ordered = true;
+  while(expected < Count)
+  {
+    buffer.consume(buffer.getCapacity(), [&expected, &ordered](const int* values, size_t n) {
+      for(size_t i = 0; i < n; ++i)
+        ordered &= values[i] == expected++;
+    });
+  }
+  producer.join();
+  BOOST_CHECK(ordered);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
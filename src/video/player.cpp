@@ -1,6 +1,7 @@
 #include "player.h"
 
 #include "audio/soundengine.h"
+#include "util/ringbuffer.h"
 
 #include <optional>
 #include <soloud.h>
@@ -14,22 +15,23 @@ extern "C"
 #include <libavfilter/buffersrc.h>
 #include <libavformat/avformat.h>
 #include <libavutil/channel_layout.h>
-#include <libavutil/imgutils.h>
 #include <libavutil/opt.h>
 #include <libavutil/samplefmt.h>
 #include <libavutil/timestamp.h>
 #include <libswresample/swresample.h>
-#include <libswscale/swscale.h>
 }
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <filesystem>
 #include <functional>
-#include <gl/image.h>
 #include <gsl-lite.hpp>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace video
@@ -180,7 +182,14 @@ struct FilterGraph
     inputs->filter_ctx = output;
     inputs->pad_idx = 0;
     inputs->next = nullptr;
-    if(avfilter_graph_parse_ptr(graph, "gblur, noise=alls=10:allf=t+u", &inputs, &outputs, nullptr) < 0)
+    // the frames are converted to the limited range BT.601 which yuv.frag expects, whatever the source uses
+    if(avfilter_graph_parse_ptr(graph,
+                                "gblur, noise=alls=10:allf=t+u, "
+                                "scale=out_color_matrix=bt601:out_range=tv, format=yuv420p",
+                                &inputs,
+                                &outputs,
+                                nullptr)
+       < 0)
       BOOST_THROW_EXCEPTION(std::runtime_error("Failed to initialize filter graph"));
 
     if(avfilter_graph_config(graph, nullptr) < 0)
@@ -188,6 +197,15 @@ struct FilterGraph
   }
 };
 
+struct VideoFrame
+{
+  AVFramePtr frame;
+  //! The presentation time in seconds, relative to the start of the audio stream
+  double timestamp;
+};
+
+//! Demuxes and decodes on a dedicated thread into bounded queues; the audio callback only consumes PCM, and the
+//! render loop presents the video frames which became due according to the audio clock
 struct AVDecoder final : public SoLoud::AudioSource
 {
   class AVDecoderAudioInstance : public SoLoud::AudioSourceInstance
@@ -206,58 +224,28 @@ struct AVDecoder final : public SoLoud::AudioSource
       return m_decoder->stopped;
     }
 
-    unsigned int getAudio(float* buffer, unsigned int framesToRead, unsigned int /*aBufferSize*/) override
+    unsigned int getAudio(float* buffer, unsigned int framesToRead, unsigned int aBufferSize) override
     {
-      m_decoder->fillQueues();
-
-      size_t written = 0;
-      const auto stride = framesToRead;
-      while(framesToRead != 0 && !m_decoder->audioQueue.empty())
-      {
-        auto& src = m_decoder->audioQueue.front();
-        const auto frames
-          = std::min(static_cast<size_t>(framesToRead), src.size() / m_decoder->audioStream->context->channels);
-        auto srcPtr = src.cbegin();
-
-        for(size_t i = 0; i < frames; ++i)
+      const auto channels = m_decoder->channels;
+      size_t frames = 0;
+      const auto deinterlace = [buffer, aBufferSize, channels, &frames](const float* src, size_t n) {
+        BOOST_ASSERT(n % channels == 0);
+        for(; n > 0; n -= channels, ++frames)
         {
-          for(int c = 0; c < m_decoder->audioStream->context->channels; ++c)
-          {
-            // deinterlace
-            BOOST_ASSERT(srcPtr != src.cend());
-            buffer[c * stride] = *srcPtr++;
-          }
-          BOOST_ASSERT(framesToRead > 0);
-          --framesToRead;
-          ++written;
-          ++buffer;
+          for(size_t c = 0; c < channels; ++c)
+            buffer[c * aBufferSize + frames] = *src++;
         }
+      };
+      m_decoder->audioBuffer->consume(framesToRead * channels, deinterlace);
 
-        src.erase(src.begin(), std::next(src.begin(), m_decoder->audioStream->context->channels * frames));
-        if(src.empty())
-        {
-          m_decoder->audioQueue.pop();
-        }
-      }
-
-      for(int c = 0; c < m_decoder->audioStream->context->channels; ++c)
-      {
-        std::fill_n(&buffer[c * stride], framesToRead, 0.0f);
-      }
-      buffer += framesToRead;
-      written += framesToRead;
-
-      m_decoder->audioFrameOffset += written;
-      Expects(m_decoder->audioFrameSize > 0);
-      while(m_decoder->audioFrameOffset >= m_decoder->audioFrameSize)
+      for(size_t c = 0; c < channels; ++c)
       {
-        m_decoder->audioFrameOffset -= m_decoder->audioFrameSize;
-        std::unique_lock lock{m_decoder->imgQueueMutex};
-        m_decoder->frameReady = true;
-        m_decoder->frameReadyCondition.notify_one();
+        std::fill_n(&buffer[c * aBufferSize + frames], framesToRead - frames, 0.0f);
       }
 
-      return written;
+      // the clock keeps running on underruns and after the end of the audio stream, so that the video never stalls
+      m_decoder->audioFramesPlayed += framesToRead;
+      return framesToRead;
     }
   };
 
@@ -268,8 +256,45 @@ struct AVDecoder final : public SoLoud::AudioSource
   SwrContext* swrContext = nullptr;
   FilterGraph filterGraph;
 
+  static constexpr size_t QueueLimit = 30;
+  //! The number of audio frames buffered ahead
+  static constexpr size_t AudioBufferFrames = 65536;
+  //! How long the decoder thread and the render loop sleep while waiting for the other side
+  static constexpr auto PollInterval = std::chrono::milliseconds{5};
+
+  size_t channels = 0;
+  int sampleRate = 0;
+  //! The presentation time in seconds of the first audio frame, from which on the audio clock counts
+  double audioStartTime = 0;
+  double videoFrameDuration = 0;
+  double nextVideoTimestamp = 0;
+
+  std::unique_ptr<util::RingBuffer<float>> audioBuffer;
+  //! Decoder thread side: the converted samples of the last audio frame
+  std::vector<float> audioSamples;
+  std::atomic<size_t> audioFramesPlayed{0};
+
+  std::queue<VideoFrame> videoQueue;
+  mutable std::mutex queueMutex;
+  //! Notified when the render loop takes video frames, or the decoder shall stop
+  std::condition_variable decoderCondition;
+  std::atomic<bool> demuxEnded{false};
+  std::exception_ptr decoderError;
+
+  std::atomic<bool> stopped{false};
+  std::atomic<bool> stopDecoder{false};
+  std::thread decoderThread;
+
   ~AVDecoder() override
   {
+    {
+      std::lock_guard lock{queueMutex};
+      stopDecoder = true;
+    }
+    decoderCondition.notify_one();
+    if(decoderThread.joinable())
+      decoderThread.join();
+
     swr_free(&swrContext);
     avformat_close_input(&fmtContext);
   }
@@ -295,6 +320,10 @@ struct AVDecoder final : public SoLoud::AudioSource
 #endif
 
     Expects(audioStream->context->channels == 1 || audioStream->context->channels == 2);
+    channels = static_cast<size_t>(audioStream->context->channels);
+    sampleRate = audioStream->context->sample_rate;
+    Expects(sampleRate > 0);
+    audioBuffer = std::make_unique<util::RingBuffer<float>>(AudioBufferFrames * channels);
 
     swrContext = swr_alloc_set_opts(nullptr,
                                     audioStream->context->channels == 1 ? AV_CH_LAYOUT_MONO : AV_CH_LAYOUT_STEREO,
@@ -317,76 +346,120 @@ struct AVDecoder final : public SoLoud::AudioSource
 
     filterGraph.init(*videoStream);
 
-    Expects(videoStream->stream->time_base.den != 0);
-    audioFrameSize
-      = audioStream->context->sample_rate * videoStream->stream->time_base.num / videoStream->stream->time_base.den;
+    const auto videoTimeBase = videoStream->stream->time_base;
+    Expects(videoTimeBase.den != 0);
+    // the video timestamps are compared to the audio clock, so they must share its origin; if the audio stream doesn't
+    // tell when it starts, it is assumed to start with the video
+    if(audioStream->stream->start_time != AV_NOPTS_VALUE)
+      audioStartTime = static_cast<double>(audioStream->stream->start_time) * av_q2d(audioStream->stream->time_base);
+    else if(videoStream->stream->start_time != AV_NOPTS_VALUE)
+      audioStartTime = static_cast<double>(videoStream->stream->start_time) * av_q2d(videoTimeBase);
+    // streams without a frame rate have one frame per time base unit
+    videoFrameDuration = videoStream->stream->avg_frame_rate.num != 0
+                           ? av_q2d(av_inv_q(videoStream->stream->avg_frame_rate))
+                           : av_q2d(videoTimeBase);
 
     av_init_packet(&packet);
     packet.data = nullptr;
     packet.size = 0;
-    fillQueues();
+
+    // decode the first video frame before starting the playback, so that the audio clock doesn't run ahead of it
+    while(videoQueue.empty() && audioBuffer->getWriteAvailable() >= audioBuffer->getCapacity() / 4)
+    {
+      if(!decodeNextPacket())
+        break;
+    }
 
     SoLoud::AudioSource::mBaseSamplerate = static_cast<float>(audioStream->context->sample_rate);
     SoLoud::AudioSource::mChannels = audioStream->context->channels;
+
+    decoderThread = std::thread{&AVDecoder::decodeLoop, this};
   }
 
-  bool stopped = false;
   AVPacket packet{};
 
-  void fillQueues()
+  [[nodiscard]] double getAudioClock() const
   {
+    return static_cast<double>(audioFramesPlayed.load()) / sampleRate;
+  }
+
+  void decodeLoop()
+  {
+    try
     {
-      std::unique_lock lock(imgQueueMutex);
-      if(audioQueue.size() >= QueueLimit || imgQueue.size() >= QueueLimit)
+      while(!stopDecoder)
       {
-        return;
+        {
+          std::unique_lock lock{queueMutex};
+          if(videoQueue.size() >= QueueLimit || audioBuffer->getWriteAvailable() < audioBuffer->getCapacity() / 4)
+          {
+            decoderCondition.wait_for(lock, PollInterval);
+            continue;
+          }
+        }
+
+        if(!decodeNextPacket())
+          break;
       }
     }
-
-    int err;
-    while((err = av_read_frame(fmtContext, &packet)) == 0)
+    catch(...)
     {
-      decodePacket();
-      av_packet_unref(&packet);
+      std::lock_guard lock{queueMutex};
+      decoderError = std::current_exception();
+      demuxEnded = true;
+    }
+  }
 
-      std::unique_lock lock(imgQueueMutex);
-      if(audioQueue.size() >= QueueLimit || imgQueue.size() >= QueueLimit)
-      {
-        break;
-      }
+  //! Returns false when the end of the input is reached
+  bool decodeNextPacket()
+  {
+    if(const auto err = av_read_frame(fmtContext, &packet); err != 0)
+    {
+      BOOST_LOG_TRIVIAL(debug) << "Demuxing done: " << getAvError(err);
+      demuxEnded = true;
+      return false;
     }
 
-    BOOST_LOG_TRIVIAL(trace) << "fillQueues done: " << getAvError(err) << "; audio=" << audioQueue.size()
-                             << ", video=" << imgQueue.size();
+    decodePacket();
+    av_packet_unref(&packet);
+    return true;
   }
 
-  std::queue<AVFramePtr> imgQueue;
-  std::queue<std::vector<float>> audioQueue;
-  mutable std::mutex imgQueueMutex;
-  std::condition_variable frameReadyCondition;
-  bool frameReady = false;
-
-  auto takeFrame()
+  //! Waits until a video frame is due and returns it, dropping frames which are already late; returns nothing once the
+  //! video has ended
+  std::optional<AVFramePtr> takeFrame()
   {
-    std::unique_lock lock{imgQueueMutex};
-    while(!frameReady)
-      frameReadyCondition.wait(lock);
-    frameReady = false;
+    std::unique_lock lock{queueMutex};
+    if(decoderError != nullptr)
+      std::rethrow_exception(decoderError);
 
-    std::optional<AVFramePtr> img;
-    if(!imgQueue.empty())
+    while(videoQueue.empty() || videoQueue.front().timestamp > getAudioClock())
     {
-      img = std::move(imgQueue.front());
-      imgQueue.pop();
-    }
+      if(videoQueue.empty() && demuxEnded)
+      {
+        stopped = audioBuffer->getReadAvailable() == 0;
+        return std::nullopt;
+      }
 
-    stopped = imgQueue.empty() && audioQueue.empty();
+      auto wait = PollInterval;
+      if(!videoQueue.empty())
+        wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::duration<double>{videoQueue.front().timestamp - getAudioClock()});
+      decoderCondition.wait_for(lock, std::clamp(wait, std::chrono::milliseconds{1}, 4 * PollInterval));
+    }
 
+    std::optional<AVFramePtr> img;
+    while(!videoQueue.empty() && videoQueue.front().timestamp <= getAudioClock())
+    {
+      if(img.has_value())
+        BOOST_LOG_TRIVIAL(debug) << "Dropping late video frame";
+      img = std::move(videoQueue.front().frame);
+      videoQueue.pop();
+    }
+    decoderCondition.notify_one();
     return img;
   }
 
-  static constexpr size_t QueueLimit = 30;
-
   void decodeVideoPacket()
   {
     if(const auto sendPacketErr = avcodec_send_packet(videoStream->context, &packet))
@@ -410,6 +483,7 @@ struct AVDecoder final : public SoLoud::AudioSource
       }
     }
 
+    const auto timeBase = av_q2d(av_buffersink_get_time_base(filterGraph.output));
     AVFramePtr videoFrame;
     int err;
     while((err = avcodec_receive_frame(videoStream->context, videoFrame.frame)) == 0)
@@ -433,8 +507,13 @@ struct AVDecoder final : public SoLoud::AudioSource
           BOOST_THROW_EXCEPTION(std::runtime_error("Filter error"));
         }
 
-        std::unique_lock lock(imgQueueMutex);
-        imgQueue.push(std::move(filteredFrame));
+        auto timestamp = nextVideoTimestamp;
+        if(filteredFrame.frame->pts != AV_NOPTS_VALUE)
+          timestamp = static_cast<double>(filteredFrame.frame->pts) * timeBase - audioStartTime;
+        nextVideoTimestamp = timestamp + videoFrameDuration;
+
+        std::unique_lock lock(queueMutex);
+        videoQueue.push(VideoFrame{std::move(filteredFrame), timestamp});
       }
     }
     if(err != AVERROR(EAGAIN))
@@ -474,8 +553,9 @@ struct AVDecoder final : public SoLoud::AudioSource
         BOOST_THROW_EXCEPTION(std::runtime_error("Failed to receive resampled audio data"));
       }
 
-      std::vector<float> audio(outSamples * 2, 0);
-      auto* audioData = reinterpret_cast<uint8_t*>(audio.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      audioSamples.resize(outSamples * channels);
+      auto* audioData
+        = reinterpret_cast<uint8_t*>(audioSamples.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
 
       const auto framesDecoded = swr_convert(
         swrContext,
@@ -488,10 +568,16 @@ struct AVDecoder final : public SoLoud::AudioSource
         BOOST_THROW_EXCEPTION(std::runtime_error("Error while converting"));
       }
 
-      // cppcheck-suppress invalidFunctionArg
-      audio.resize(framesDecoded * 2);
-
-      audioQueue.push(std::move(audio));
+      // the audio buffer drains while the mixer plays, so this only waits if the container interleaves poorly
+      const float* samples = audioSamples.data();
+      for(auto remaining = static_cast<size_t>(framesDecoded) * channels; remaining > 0 && !stopDecoder;)
+      {
+        const auto written = audioBuffer->write(samples, remaining);
+        samples += written;
+        remaining -= written;
+        if(remaining > 0)
+          std::this_thread::sleep_for(PollInterval);
+      }
     }
     if(err != AVERROR(EAGAIN))
       BOOST_LOG_TRIVIAL(info) << "Audio stream chunk decoded: " << getAvError(err);
@@ -509,134 +595,41 @@ struct AVDecoder final : public SoLoud::AudioSource
     }
   }
 
-  size_t audioFrameSize = 0;
-  size_t audioFrameOffset = 0;
-
   SoLoud::AudioSourceInstance* createInstance() override
   {
     return new AVDecoderAudioInstance(this);
   }
 };
 
-struct Scaler
-{
-  static constexpr auto OutputPixFmt = AV_PIX_FMT_RGBA;
-
-  int currentSwsWidth = -1;
-  int currentSwsHeight = -1;
-  int scaledWidth = -1;
-  int scaledHeight = -1;
-  SwsContext* context = nullptr;
-  AVFilterLink* filter;
-  std::array<uint8_t*, 4> dstVideoData{nullptr};
-  std::array<int, 4> dstVideoLinesize{0};
-
-  explicit Scaler(AVFilterLink* filter)
-      : filter{filter}
-  {
-  }
-
-  ~Scaler()
-  {
-    sws_freeContext(context);
-    av_freep(dstVideoData.data());
-  }
-
-  void resize(int targetWidth, int targetHeight)
-  {
-    if(currentSwsWidth == targetWidth && currentSwsHeight == targetHeight)
-      return;
-
-    currentSwsWidth = targetWidth;
-    currentSwsHeight = targetHeight;
-
-    const auto imgScale = std::min(float(targetWidth) / filter->w, float(targetHeight) / filter->h);
-    scaledWidth = static_cast<int>(gsl::narrow<float>(filter->w) * imgScale);
-    scaledHeight = static_cast<int>(gsl::narrow<float>(filter->h) * imgScale);
-
-    sws_freeContext(context);
-    context = sws_getContext(filter->w,
-                             filter->h,
-                             static_cast<AVPixelFormat>(filter->format),
-                             scaledWidth,
-                             scaledHeight,
-                             OutputPixFmt,
-                             SWS_LANCZOS,
-                             nullptr,
-                             nullptr,
-                             nullptr);
-    if(context == nullptr)
-    {
-      BOOST_THROW_EXCEPTION(std::runtime_error("Failed to create SWS context"));
-    }
-
-    av_freep(dstVideoData.data());
-    if(av_image_alloc(dstVideoData.data(), dstVideoLinesize.data(), targetWidth, targetHeight, OutputPixFmt, 1) < 0)
-    {
-      BOOST_THROW_EXCEPTION(std::runtime_error("Could not allocate raw video buffer"));
-    }
-  };
-
-  void scale(const AVFramePtr& videoFrame, gl::Image<gl::SRGBA8>& img)
-  {
-    sws_scale(context,
-              static_cast<const uint8_t* const*>(videoFrame.frame->data),
-              videoFrame.frame->linesize,
-              0,
-              videoFrame.frame->height,
-              dstVideoData.data(),
-              dstVideoLinesize.data());
-
-    auto srcLineRaw = dstVideoData[0];
-    auto dst = img.getRawData();
-
-    Expects(img.getSize().x <= dstVideoLinesize[0] / int(sizeof(gl::SRGBA8)));
-
-    img.fill({0, 0, 0, 255});
-
-    Expects(img.getSize().x >= scaledWidth);
-    Expects(img.getSize().y >= scaledHeight);
-    const auto xOffset = static_cast<int32_t>((img.getSize().x - scaledWidth) / 2);
-    const auto yOffset = static_cast<int32_t>((img.getSize().y - scaledHeight) / 2);
-    dst += img.getSize().x * yOffset;
-    dst += xOffset;
-    for(int32_t y = 0; y < scaledHeight; ++y)
-    {
-      std::copy_n(reinterpret_cast<gl::SRGBA8*>(srcLineRaw), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                  scaledWidth,
-                  dst);
-      dst += img.getSize().x;
-      srcLineRaw += dstVideoLinesize[0];
-    }
-  }
-};
-
 void play(const std::filesystem::path& filename,
           SoLoud::Soloud& soLoud,
-          const std::shared_ptr<gl::Image<gl::SRGBA8>>& img,
-          const std::function<bool()>& onFrame)
+          const std::function<bool(const YuvFrame*)>& onFrame)
 {
   if(!is_regular_file(filename))
     BOOST_THROW_EXCEPTION(std::runtime_error("Video file not found"));
 
   auto decoderPtr = std::make_unique<AVDecoder>(filename.string());
   const auto decoder = decoderPtr.get();
-  Expects(decoder->filterGraph.graph->sink_links_count == 1);
-  Scaler sws{decoder->filterGraph.graph->sink_links[0]};
-
   const auto handle = soLoud.play(*decoderPtr);
 
   const auto streamFinisher = gsl::finally([&handle, &soLoud]() { soLoud.stop(handle); });
 
   while(!decoder->stopped)
   {
-    if(const auto f = decoder->takeFrame())
+    const auto f = decoder->takeFrame();
+    std::optional<YuvFrame> frame;
+    if(f.has_value())
     {
-      sws.resize(img->getSize().x, img->getSize().y);
-      sws.scale(*f, *img);
+      const auto* src = f->frame;
+      Expects(src->format == AV_PIX_FMT_YUV420P);
+      Expects(src->linesize[0] > 0 && src->linesize[1] > 0 && src->linesize[2] > 0);
+      frame = YuvFrame{{src->width, src->height},
+                       {src->data[0], src->data[1], src->data[2]},
+                       {src->linesize[0], src->linesize[1], src->linesize[2]}};
     }
 
-    decoder->stopped |= !onFrame();
+    if(!onFrame(frame.has_value() ? &frame.value() : nullptr))
+      decoder->stopped = true;
   }
 }
 } // namespace video
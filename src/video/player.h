@@ -1,9 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
-#include <gl/pixel.h>
-#include <gl/soglb_fwd.h>
+#include <glm/glm.hpp>
 
 namespace SoLoud
 {
@@ -12,8 +13,19 @@ class Soloud;
 
 namespace video
 {
+//! A decoded 4:2:0 frame, referencing the decoder's buffers
+struct YuvFrame
+{
+  //! The size of the Y plane; the U and V planes have half the resolution, rounded up
+  glm::ivec2 size;
+  std::array<const uint8_t*, 3> planes;
+  //! The number of bytes per row of each plane
+  std::array<int, 3> strides;
+};
+
+//! Calls @a onFrame once per iteration of the playback loop with the frame which became due, or nullptr if there is
+//! none; the frame is only valid during the call. Playback stops when @a onFrame returns false.
 extern void play(const std::filesystem::path& filename,
                  SoLoud::Soloud& soLoud,
-                 const std::shared_ptr<gl::Image<gl::SRGBA8>>& img,
-                 const std::function<bool()>& onFrame);
-}
+                 const std::function<bool(const YuvFrame*)>& onFrame);
+} // namespace video